@@ -136,6 +136,12 @@ public:
      */
     bool StoppingEventOccurred();
 
+    /**
+     * @return the underlying ODE solver (used, for example, by BatchedOdeSolverModifier
+     * to determine which integration scheme a model has been set up with).
+     */
+    boost::shared_ptr<AbstractIvpOdeSolver> GetIvpOdeSolver();
+
     /**
      * Call mpOdeSolver->GetStoppingTime.
      *
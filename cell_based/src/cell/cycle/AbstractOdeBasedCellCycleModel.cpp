@@ -103,6 +103,11 @@ bool AbstractOdeBasedCellCycleModel::ReadyToDivide()
     return mReadyToDivide;
 }
 
+bool AbstractOdeBasedCellCycleModel::CanSolveOdeInBatch(double currentTime)
+{
+    return (!mReadyToDivide) && (currentTime > mLastTime);
+}
+
 void AbstractOdeBasedCellCycleModel::ResetForDivision()
 {
     assert(mReadyToDivide);
@@ -140,6 +140,14 @@ public:
      */
     virtual bool ReadyToDivide();
 
+    /**
+     * Overridden CanSolveOdeInBatch() method.
+     *
+     * @param currentTime  the time up to which the system would be solved
+     * @return whether the cell is not yet ready to divide and its ODEs have not yet been solved to currentTime
+     */
+    virtual bool CanSolveOdeInBatch(double currentTime);
+
     /**
      * For a naturally cycling model this does not need to be overridden in the
      * subclasses. But most models should override this function and then
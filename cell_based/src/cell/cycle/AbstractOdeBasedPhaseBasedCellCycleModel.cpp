@@ -145,6 +145,13 @@ void AbstractOdeBasedPhaseBasedCellCycleModel::UpdateCellCyclePhase()
     }
 }
 
+bool AbstractOdeBasedPhaseBasedCellCycleModel::CanSolveOdeInBatch(double currentTime)
+{
+    return (mCurrentCellCyclePhase == G_ONE_PHASE)
+           && (!this->mFinishedRunningOdes)
+           && (currentTime > mLastTime);
+}
+
 void AbstractOdeBasedPhaseBasedCellCycleModel::ResetForDivision()
 {
     assert(this->mFinishedRunningOdes);
@@ -128,6 +128,18 @@ public:
      */
     virtual void UpdateCellCyclePhase();
 
+    /**
+     * Overridden CanSolveOdeInBatch() method.
+     *
+     * Only cells in G1 phase whose ODEs are still running may be solved in a batch;
+     * the transition out of M phase and the handling of stopping events are left
+     * to UpdateCellCyclePhase().
+     *
+     * @param currentTime  the time up to which the system would be solved
+     * @return whether the ODEs may be advanced to currentTime by a batched integrator
+     */
+    virtual bool CanSolveOdeInBatch(double currentTime);
+
     /**
      * Get the time at which the ODE stopping event occurred.
      * Only called in those subclasses for which stopping events
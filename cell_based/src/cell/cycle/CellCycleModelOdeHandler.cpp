@@ -129,6 +129,22 @@ void CellCycleModelOdeHandler::SetLastTime(double lastTime)
     mLastTime = lastTime;
 }
 
+double CellCycleModelOdeHandler::GetLastTime() const
+{
+    return mLastTime;
+}
+
+bool CellCycleModelOdeHandler::CanSolveOdeInBatch(double currentTime)
+{
+    return false;
+}
+
+void CellCycleModelOdeHandler::PrepareForBatchedSolve(double currentTime)
+{
+    assert(mpOdeSystem != nullptr);
+    AdjustOdeParameters(currentTime);
+}
+
 void CellCycleModelOdeHandler::SetStateVariables(const std::vector<double>& rStateVariables)
 {
     assert(mpOdeSystem);
@@ -167,6 +167,31 @@ public:
      */
     void SetLastTime(double lastTime);
 
+    /**
+     * @return #mLastTime.
+     */
+    double GetLastTime() const;
+
+    /**
+     * @return whether the ODE system may be advanced from #mLastTime to currentTime by an
+     * external batched integrator (see BatchedOdeSolverModifier) instead of by SolveOdeToTime().
+     *
+     * The default implementation returns false. Subclasses override this method when
+     * the bookkeeping they perform after a solve depends only on #mLastTime, so that
+     * a later call to SolveOdeToTime() with the same time is a no-op.
+     *
+     * @param currentTime  the time up to which the system would be solved
+     */
+    virtual bool CanSolveOdeInBatch(double currentTime);
+
+    /**
+     * Prepare the ODE system for an external batched solve until currentTime.
+     * This calls AdjustOdeParameters(), exactly as SolveOdeToTime() would.
+     *
+     * @param currentTime  the time up to which the system will be solved
+     */
+    void PrepareForBatchedSolve(double currentTime);
+
     /**
      * @return #mDt.  This sets it to a default value if it hasn't
      * been set by calling SetDt.
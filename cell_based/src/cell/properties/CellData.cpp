@@ -35,45 +35,94 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "CellData.hpp"
 
+#include <algorithm>
+
 CellData::~CellData()
 {
 }
 
+std::map<std::string, unsigned>& CellData::rGetHandleMap()
+{
+    static std::map<std::string, unsigned> handle_map;
+    return handle_map;
+}
+
+std::vector<std::string>& CellData::rGetItemNames()
+{
+    static std::vector<std::string> item_names;
+    return item_names;
+}
+
+unsigned CellData::GetItemHandle(const std::string& rVariableName)
+{
+    std::map<std::string, unsigned>& r_handle_map = rGetHandleMap();
+    std::map<std::string, unsigned>::const_iterator it = r_handle_map.find(rVariableName);
+    if (it != r_handle_map.end())
+    {
+        return it->second;
+    }
+
+    // Register a new item name
+    std::vector<std::string>& r_item_names = rGetItemNames();
+    unsigned handle = r_item_names.size();
+    r_item_names.push_back(rVariableName);
+    r_handle_map[rVariableName] = handle;
+    return handle;
+}
+
+const std::string& CellData::rGetItemName(unsigned handle)
+{
+    assert(handle < rGetItemNames().size());
+    return rGetItemNames()[handle];
+}
+
+void CellData::ThrowItemNotStored(unsigned handle) const
+{
+    if (handle < rGetItemNames().size())
+    {
+        EXCEPTION("The item " << rGetItemName(handle) << " is not stored");
+    }
+    EXCEPTION("The item with handle " << handle << " is not registered");
+}
+
 void CellData::SetItem(const std::string& rVariableName, double data)
 {
-    mCellData[rVariableName] = data;
+    SetItem(GetItemHandle(rVariableName), data);
 }
 
 double CellData::GetItem(const std::string& rVariableName) const
 {
     /*
-     * Note that mCellData[rVariableName] is not const. If rVariableName is not
-     * a key, then mCellData[rVariableName] will create a new item in the map
-     * and increase the size by one.  Using a const_iterator ensures that the
-     * map remains const.
+     * Look up the handle without registering rVariableName, so that
+     * querying an unknown item does not grow the shared registry.
      */
-    std::map<std::string, double>::const_iterator it = mCellData.find(rVariableName);
-    if (it == mCellData.end())
+    const std::map<std::string, unsigned>& r_handle_map = rGetHandleMap();
+    std::map<std::string, unsigned>::const_iterator it = r_handle_map.find(rVariableName);
+    if (it == r_handle_map.end() || it->second >= mIsStored.size() || !mIsStored[it->second])
     {
         EXCEPTION("The item " << rVariableName << " is not stored");
     }
-    return(it->second);
+    return mValues[it->second];
 }
 
 unsigned CellData::GetNumItems() const
 {
-    return mCellData.size();
+    return std::count(mIsStored.begin(), mIsStored.end(), true);
 }
 
 std::vector<std::string> CellData::GetKeys() const
 {
     std::vector<std::string> keys;
-    for (std::map<std::string, double>::const_iterator it = mCellData.begin(); it != mCellData.end(); ++it)
+    for (unsigned handle=0; handle<mIsStored.size(); handle++)
     {
-        keys.push_back(it->first);
+        if (mIsStored[handle])
+        {
+            keys.push_back(rGetItemName(handle));
+        }
     }
 
-    // From STL documentation we assume that the iterator is returning sorted keys sort(keys.begin(), keys.end());
+    // Handles are assigned in order of registration, so sort the keys alphabetically
+    std::sort(keys.begin(), keys.end());
     return keys;
 }
 
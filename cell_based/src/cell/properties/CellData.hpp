@@ -45,6 +45,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ChasteSerialization.hpp"
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/map.hpp>
+#include <boost/serialization/split_member.hpp>
 #include "Exception.hpp"
 
 /**
@@ -56,31 +57,94 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  * Within the Cell constructor, an empty CellData object is created and passed to the Cell
  * (unless there is already a CellData object present in mCellPropertyCollection).
+ *
+ * Item names are interned, once, to integer handles shared by all CellData objects (see
+ * GetItemHandle()), and each object stores its values in a vector indexed by handle. The
+ * string-based methods look up the handle on every call; code that accesses the same item
+ * for every cell in a population should obtain the handle once and use the handle-based
+ * overloads of SetItem() and GetItem().
  */
 class CellData : public AbstractCellProperty
 {
 private:
 
     /**
-     * The cell data.
+     * The cell data, indexed by item handle.
+     */
+    std::vector<double> mValues;
+
+    /**
+     * Whether each item, indexed by handle, has been stored in this object.
+     */
+    std::vector<bool> mIsStored;
+
+    /**
+     * @return the map from item names to handles, shared by all CellData objects.
      */
-    std::map<std::string, double> mCellData;
+    static std::map<std::string, unsigned>& rGetHandleMap();
+
+    /**
+     * @return the item names, indexed by handle, shared by all CellData objects.
+     */
+    static std::vector<std::string>& rGetItemNames();
+
+    /**
+     * Throw an exception reporting that the item with a given handle is not stored.
+     *
+     * @param handle the handle of the item
+     */
+    void ThrowItemNotStored(unsigned handle) const;
 
     /** Needed for serialization. */
     friend class boost::serialization::access;
     /**
      * Archive the member variables.
      *
+     * Item handles depend on the order in which names are registered, so the data
+     * are archived by name, in the same format as when they were stored in a map.
+     *
      * @param archive the archive
      * @param version the current version of this class
      */
     template<class Archive>
-    void serialize(Archive & archive, const unsigned int version)
+    void save(Archive & archive, const unsigned int version) const
     {
         archive & boost::serialization::base_object<AbstractCellProperty>(*this);
-        archive & mCellData;
+
+        std::map<std::string, double> cell_data;
+        for (unsigned handle=0; handle<mIsStored.size(); handle++)
+        {
+            if (mIsStored[handle])
+            {
+                cell_data[rGetItemName(handle)] = mValues[handle];
+            }
+        }
+        archive & cell_data;
     }
 
+    /**
+     * Load the member variables.
+     *
+     * @param archive the archive
+     * @param version the current version of this class
+     */
+    template<class Archive>
+    void load(Archive & archive, const unsigned int version)
+    {
+        archive & boost::serialization::base_object<AbstractCellProperty>(*this);
+
+        std::map<std::string, double> cell_data;
+        archive & cell_data;
+
+        mValues.clear();
+        mIsStored.clear();
+        for (std::map<std::string, double>::const_iterator it = cell_data.begin(); it != cell_data.end(); ++it)
+        {
+            SetItem(it->first, it->second);
+        }
+    }
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
+
 public:
 
     /**
@@ -89,6 +153,22 @@ public:
      */
     virtual ~CellData();
 
+    /**
+     * Get the handle of a named item, registering the name if this has not been done before.
+     * Handles are shared by all CellData objects and remain valid for the lifetime of the program.
+     *
+     * @param rVariableName the name of the item
+     * @return the handle of the item
+     */
+    static unsigned GetItemHandle(const std::string& rVariableName);
+
+    /**
+     * @return the name of a registered item.
+     *
+     * @param handle the handle of the item
+     */
+    static const std::string& rGetItemName(unsigned handle);
+
     /**
      * This assigns the cell data.
      *
@@ -97,6 +177,23 @@ public:
      */
     void SetItem(const std::string& rVariableName, double data);
 
+    /**
+     * This assigns the cell data, using a handle obtained from GetItemHandle().
+     *
+     * @param handle the handle of the data to be set.
+     * @param data the value to set it to.
+     */
+    inline void SetItem(unsigned handle, double data)
+    {
+        if (handle >= mValues.size())
+        {
+            mValues.resize(handle+1, 0.0);
+            mIsStored.resize(handle+1, false);
+        }
+        mValues[handle] = data;
+        mIsStored[handle] = true;
+    }
+
     /**
      * @return data.
      *
@@ -105,6 +202,21 @@ public:
      */
     double GetItem(const std::string& rVariableName) const;
 
+    /**
+     * @return data, using a handle obtained from GetItemHandle().
+     *
+     * @param handle the handle of the data required.
+     * throws if the item has not been stored
+     */
+    inline double GetItem(unsigned handle) const
+    {
+        if (handle >= mIsStored.size() || !mIsStored[handle])
+        {
+            ThrowItemNotStored(handle);
+        }
+        return mValues[handle];
+    }
+
     /**
      * @return number of data items
      */
@@ -113,7 +225,7 @@ public:
     /**
      * @return all keys.
      *
-     * According to STL these are sorted in lexicographical/alphabetic order (so that the ordering here is predictable).
+     * These are sorted in lexicographical/alphabetic order (so that the ordering here is predictable).
      */
     std::vector<std::string> GetKeys() const;
 };
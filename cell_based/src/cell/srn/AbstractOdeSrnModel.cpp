@@ -94,6 +94,11 @@ void AbstractOdeSrnModel::SimulateToCurrentTime()
     SetSimulatedToTime(current_time);
 }
 
+bool AbstractOdeSrnModel::CanSolveOdeInBatch(double currentTime)
+{
+    return (!this->mFinishedRunningOdes) && (currentTime > mLastTime);
+}
+
 void AbstractOdeSrnModel::Initialise(AbstractOdeSystem* pOdeSystem)
 {
     assert(mpOdeSystem == nullptr);
@@ -130,6 +130,14 @@ public:
      */
     virtual void SimulateToCurrentTime();
 
+    /**
+     * Overridden CanSolveOdeInBatch() method.
+     *
+     * @param currentTime  the time up to which the system would be solved
+     * @return whether the ODEs are still running and have not yet been solved to currentTime
+     */
+    virtual bool CanSolveOdeInBatch(double currentTime);
+
      /**
      * For a naturally cycling model this does not need to be overridden in the
      * subclasses. But most models should override this function and then
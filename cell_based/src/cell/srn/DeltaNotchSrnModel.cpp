@@ -99,10 +99,16 @@ void DeltaNotchSrnModel::UpdateDeltaNotch()
     assert(mpOdeSystem != nullptr);
     assert(mpCell != nullptr);
 
-    double mean_delta = mpCell->GetCellData()->GetItem("mean delta");
+    static const unsigned mean_delta_handle = CellData::GetItemHandle("mean delta");
+    double mean_delta = mpCell->GetCellData()->GetItem(mean_delta_handle);
     mpOdeSystem->SetParameter("Mean Delta", mean_delta);
 }
 
+void DeltaNotchSrnModel::AdjustOdeParameters(double currentTime)
+{
+    UpdateDeltaNotch();
+}
+
 double DeltaNotchSrnModel::GetNotch()
 {
     assert(mpOdeSystem != nullptr);
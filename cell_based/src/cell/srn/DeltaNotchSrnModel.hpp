@@ -122,6 +122,16 @@ public:
      */
     void UpdateDeltaNotch();
 
+    /**
+     * Overridden AdjustOdeParameters() method.
+     *
+     * Calls UpdateDeltaNotch(), so that the mean neighbouring Delta is also
+     * passed to the ODE system when it is solved by a batched integrator.
+     *
+     * @param currentTime  the time up to which the system will be solved
+     */
+    void AdjustOdeParameters(double currentTime);
+
     /**
      * @return the current Notch level in this cell.
      */
@@ -135,6 +135,21 @@ public:
                                                            c_vector<double, SPACE_DIM>& oldLocation,
                                                            double dt);
 
+    /**
+     * Helper method to return the expected step location for RK23NumericalMethod.
+     *
+     * @return the expected location after one step
+     *
+     * @param nodeIndex the index of the node
+     * @param damping the damping constant
+     * @param oldLocation the old location of the node
+     * @param dt the step size
+     */
+    c_vector<double, SPACE_DIM> GetExpectedOneStepLocationRK23(unsigned nodeIndex,
+                                                           double damping,
+                                                           c_vector<double, SPACE_DIM>& oldLocation,
+                                                           double dt);
+
     /**
      * Helper method to return the expected step location for AdamsMoultonNumericalMethod.
      *
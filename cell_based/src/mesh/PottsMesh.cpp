@@ -134,6 +134,7 @@ void PottsMesh<DIM>::Clear()
     this->mNodes.clear();
 
     mDeletedElementIndices.clear();
+    mSublattices.clear();
 
     // Delete neighbour info
     //mVonNeumannNeighbouringNodeIndices.clear();
@@ -241,6 +242,63 @@ std::set<unsigned> PottsMesh<DIM>::GetVonNeumannNeighbouringNodeIndices(unsigned
     return mVonNeumannNeighbouringNodeIndices[nodeIndex];
 }
 
+template<unsigned DIM>
+const std::vector<std::vector<unsigned> >& PottsMesh<DIM>::rGetSublattices()
+{
+    if (mSublattices.empty())
+    {
+        unsigned num_nodes = this->mNodes.size();
+        assert(mMooreNeighbouringNodeIndices.size() == num_nodes);
+
+        // Greedily assign to each node the lowest colour not used within two Moore steps of it
+        std::vector<unsigned> node_colours(num_nodes, UINT_MAX);
+        for (unsigned node_index=0; node_index<num_nodes; node_index++)
+        {
+            if (this->mNodes[node_index]->IsDeleted())
+            {
+                continue;
+            }
+
+            std::vector<bool> colour_is_used(mSublattices.size(), false);
+            const std::set<unsigned>& r_neighbours = mMooreNeighbouringNodeIndices[node_index];
+            for (std::set<unsigned>::const_iterator neighbour_iter = r_neighbours.begin();
+                 neighbour_iter != r_neighbours.end();
+                 ++neighbour_iter)
+            {
+                if (node_colours[*neighbour_iter] != UINT_MAX)
+                {
+                    colour_is_used[node_colours[*neighbour_iter]] = true;
+                }
+
+                const std::set<unsigned>& r_next_neighbours = mMooreNeighbouringNodeIndices[*neighbour_iter];
+                for (std::set<unsigned>::const_iterator next_iter = r_next_neighbours.begin();
+                     next_iter != r_next_neighbours.end();
+                     ++next_iter)
+                {
+                    if (node_colours[*next_iter] != UINT_MAX)
+                    {
+                        colour_is_used[node_colours[*next_iter]] = true;
+                    }
+                }
+            }
+
+            unsigned colour = 0;
+            while (colour < colour_is_used.size() && colour_is_used[colour])
+            {
+                colour++;
+            }
+            if (colour == mSublattices.size())
+            {
+                mSublattices.push_back(std::vector<unsigned>());
+            }
+
+            node_colours[node_index] = colour;
+            mSublattices[colour].push_back(node_index);
+        }
+    }
+    return mSublattices;
+}
+
 template<unsigned DIM>
 void PottsMesh<DIM>::DeleteElement(unsigned index)
 {
@@ -293,6 +351,7 @@ void PottsMesh<DIM>::DeleteNode(unsigned index)
     }
 
     // Remove from connectivity
+    mSublattices.clear();
     mVonNeumannNeighbouringNodeIndices[index].clear();
     mMooreNeighbouringNodeIndices[index].clear();
 
@@ -635,6 +694,7 @@ void PottsMesh<DIM>::ConstructFromMeshReader(AbstractMeshReader<DIM, DIM>& rMesh
     {
         mMooreNeighbouringNodeIndices.resize(num_nodes);
     }
+    mSublattices.clear();
 }
 
 // Explicit instantiation
@@ -80,6 +80,13 @@ protected:
     /** Vector of set of Moore neighbours for each node. */
     std::vector< std::set<unsigned> > mMooreNeighbouringNodeIndices;
 
+    /**
+     * Partition of the (non-deleted) nodes into sublattices, computed on demand
+     * by rGetSublattices() and cleared whenever the connectivity changes.
+     * Not archived, since it can be reconstructed from the neighbour information.
+     */
+    std::vector< std::vector<unsigned> > mSublattices;
+
     /**
      * Solve node mapping method. This overridden method is required
      * as it is pure virtual in the base class.
@@ -284,6 +291,23 @@ public:
      */
     std::set<unsigned> GetVonNeumannNeighbouringNodeIndices(unsigned nodeIndex);
 
+    /**
+     * Get a partition of the nodes of the mesh into sublattices.
+     *
+     * Two nodes are placed in the same sublattice only if they are not Moore
+     * neighbours and do not share a Moore neighbour, so the neighbourhoods read
+     * by lattice updates at two nodes of a sublattice do not overlap. Note that
+     * terms depending on a whole element (such as a Potts volume constraint)
+     * can still couple updates within a sublattice. On a regular square (cubic)
+     * lattice this gives the usual 3x3 (3x3x3) checkerboard decomposition.
+     *
+     * The partition is computed by a greedy distance-2 colouring in node index
+     * order, so is deterministic, and is cached until the connectivity changes.
+     *
+     * @return a vector of sublattices, each containing node indices in increasing order
+     */
+    const std::vector< std::vector<unsigned> >& rGetSublattices();
+
     /**
      * Mark a node as deleted. Note that in a Potts mesh this requires the elements and connectivity to be updated accordingly.
      *
@@ -74,7 +74,8 @@ AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::AbstractCellPopulation( Abstract
       mCells(rCells.begin(), rCells.end()),
       mCentroid(zero_vector<double>(SPACE_DIM)),
       mpCellPropertyRegistry(CellPropertyRegistry::Instance()->TakeOwnership()),
-      mOutputResultsForChasteVisualizer(true)
+      mOutputResultsForChasteVisualizer(true),
+      mUseBinaryCellWriterOutput(false)
 {
     /*
      * To avoid double-counting problems, clear the passed-in cells vector.
@@ -110,7 +111,8 @@ AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::AbstractCellPopulation( Abstract
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::AbstractCellPopulation(AbstractMesh<ELEMENT_DIM, SPACE_DIM>& rMesh)
-    : mrMesh(rMesh)
+    : mrMesh(rMesh),
+      mUseBinaryCellWriterOutput(false)
 {
 }
 
@@ -471,10 +473,17 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::UpdateCellProcessLocation()
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::CloseRoundRobinWritersFiles()
 {
-    typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
-    BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+    if (mpBinaryCellColumnWriter)
     {
-        p_cell_writer->CloseFile();
+        mpBinaryCellColumnWriter->CloseFile();
+    }
+    else
+    {
+        typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
+        BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+        {
+            p_cell_writer->CloseFile();
+        }
     }
 
     typedef AbstractCellPopulationWriter<ELEMENT_DIM, SPACE_DIM> pop_writer_t;
@@ -487,10 +496,17 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::CloseRoundRobinWritersFiles
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::CloseWritersFiles()
 {
-    typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
-    BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+    if (mpBinaryCellColumnWriter)
+    {
+        mpBinaryCellColumnWriter->CloseFile();
+    }
+    else
     {
-        p_cell_writer->CloseFile();
+        typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
+        BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+        {
+            p_cell_writer->CloseFile();
+        }
     }
 
     typedef AbstractCellPopulationWriter<ELEMENT_DIM, SPACE_DIM> pop_writer_t;
@@ -536,11 +552,20 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::OpenWritersFiles(OutputFile
         }
     }
 
-    // Open output files for any cell writers
-    typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
-    BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+    // Open output files for any cell writers, or a single binary file for all of them
+    if (mUseBinaryCellWriterOutput)
     {
-        p_cell_writer->OpenOutputFile(rOutputFileHandler);
+        mpBinaryCellColumnWriter.reset(new BinaryCellColumnWriter<ELEMENT_DIM, SPACE_DIM>);
+        mpBinaryCellColumnWriter->OpenOutputFile(rOutputFileHandler, mCellWriters);
+    }
+    else
+    {
+        mpBinaryCellColumnWriter.reset();
+        typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
+        BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+        {
+            p_cell_writer->OpenOutputFile(rOutputFileHandler);
+        }
     }
 
     // Open output files and write headers for any population writers
@@ -573,9 +598,16 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::OpenRoundRobinWritersFilesF
 {
     typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
     typedef AbstractCellPopulationWriter<ELEMENT_DIM, SPACE_DIM> pop_writer_t;
-    BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+    if (mpBinaryCellColumnWriter)
     {
-        p_cell_writer->OpenOutputFileForAppend(rOutputFileHandler);
+        mpBinaryCellColumnWriter->OpenOutputFileForAppend(rOutputFileHandler);
+    }
+    else
+    {
+        BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+        {
+            p_cell_writer->OpenOutputFileForAppend(rOutputFileHandler);
+        }
     }
     BOOST_FOREACH(boost::shared_ptr<pop_writer_t> p_pop_writer, mCellPopulationWriters)
     {
@@ -602,9 +634,12 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::WriteResultsToFiles(const s
             // The master process writes time stamps
             if (PetscTools::AmMaster())
             {
-                BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+                if (!mpBinaryCellColumnWriter)
                 {
-                    p_cell_writer->WriteTimeStamp();
+                    BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+                    {
+                        p_cell_writer->WriteTimeStamp();
+                    }
                 }
                 BOOST_FOREACH(boost::shared_ptr<pop_writer_t> p_pop_writer, mCellPopulationWriters)
                 {
@@ -619,14 +654,25 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::WriteResultsToFiles(const s
                 AcceptPopulationWriter(*pop_writer_iter);
             }
 
-            AcceptCellWritersAcrossPopulation();
+            if (mpBinaryCellColumnWriter)
+            {
+                // Each process appends a single chunk holding all the cell writers' data for its cells
+                mpBinaryCellColumnWriter->WriteTimeStep(this, mCellWriters);
+            }
+            else
+            {
+                AcceptCellWritersAcrossPopulation();
+            }
 
             // The top-most process adds a newline
             if (PetscTools::AmTopMost())
             {
-                BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+                if (!mpBinaryCellColumnWriter)
                 {
-                    p_cell_writer->WriteNewline();
+                    BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+                    {
+                        p_cell_writer->WriteNewline();
+                    }
                 }
                 BOOST_FOREACH(boost::shared_ptr<pop_writer_t> p_pop_writer, mCellPopulationWriters)
                 {
@@ -813,6 +859,18 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::SetOutputResultsForChasteVi
     mOutputResultsForChasteVisualizer = outputResultsForChasteVisualizer;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::SetUseBinaryCellWriterOutput(bool useBinaryCellWriterOutput)
+{
+    mUseBinaryCellWriterOutput = useBinaryCellWriterOutput;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::GetUseBinaryCellWriterOutput() const
+{
+    return mUseBinaryCellWriterOutput;
+}
+
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 std::vector<std::string> AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::GetDivisionsInformation()
 {
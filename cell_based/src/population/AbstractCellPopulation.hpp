@@ -45,6 +45,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <boost/shared_ptr.hpp>
 
 #include "ChasteSerialization.hpp"
+#include "ChasteSerializationVersion.hpp"
 #include "ClassIsAbstract.hpp"
 
 #include <boost/serialization/vector.hpp>
@@ -63,6 +64,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractCellPopulationCountWriter.hpp"
 #include "AbstractCellPopulationWriter.hpp"
 #include "AbstractCellWriter.hpp"
+#include "BinaryCellColumnWriter.hpp"
 
 // Forward declaration prevents circular include chain
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM> class AbstractCellBasedSimulation;
@@ -97,6 +99,10 @@ private:
         archive & mCellWriters;
         archive & mCellPopulationWriters;
         archive & mCellPopulationCountWriters;
+        if (version >= 1)
+        {
+            archive & mUseBinaryCellWriterOutput;
+        }
     }
 
     /**
@@ -144,9 +150,21 @@ protected:
     /** Whether to write results to file for visualization using the Chaste java visualizer (defaults to true). */
     bool mOutputResultsForChasteVisualizer;
 
+    /**
+     * Whether the output of the cell writers is written as columns to a single binary file
+     * by mpBinaryCellColumnWriter, rather than to a text file per writer (defaults to false).
+     */
+    bool mUseBinaryCellWriterOutput;
+
     /** A list of cell writers. */
     std::vector<boost::shared_ptr<AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> > > mCellWriters;
 
+    /**
+     * The writer used for the output of the cell writers. Created by OpenWritersFiles() if
+     * mUseBinaryCellWriterOutput is true, and NULL otherwise.
+     */
+    boost::shared_ptr<BinaryCellColumnWriter<ELEMENT_DIM, SPACE_DIM> > mpBinaryCellColumnWriter;
+
     /** A list of cell population writers. */
     std::vector<boost::shared_ptr<AbstractCellPopulationWriter<ELEMENT_DIM, SPACE_DIM> > > mCellPopulationWriters;
 
@@ -930,6 +948,22 @@ public:
      */
     void SetOutputResultsForChasteVisualizer(bool outputResultsForChasteVisualizer);
 
+    /**
+     * Set mUseBinaryCellWriterOutput. If true, the output of all cell writers is written to a
+     * single binary file, results.cellcols, which may be read using BinaryCellColumnReader,
+     * instead of to a text file per writer. Population writers are unaffected. Note that the
+     * Chaste java visualizer cannot read this file. The new value takes effect the next time
+     * OpenWritersFiles() is called.
+     *
+     * @param useBinaryCellWriterOutput the new value of mUseBinaryCellWriterOutput
+     */
+    void SetUseBinaryCellWriterOutput(bool useBinaryCellWriterOutput);
+
+    /**
+     * @return mUseBinaryCellWriterOutput
+     */
+    bool GetUseBinaryCellWriterOutput() const;
+
     /**
      * @return The width (maximum distance to centroid) of the cell population
      *     in each dimension
@@ -1041,6 +1075,23 @@ public:
 
 TEMPLATED_CLASS_IS_ABSTRACT_1_UNSIGNED(AbstractCellPopulation)
 
+namespace boost {
+namespace serialization {
+/**
+ * Specify a version number for archive backwards compatibility.
+ *
+ * This is how to do BOOST_CLASS_VERSION(AbstractCellPopulation, 1)
+ * with a templated class.
+ */
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+struct version<AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM> >
+{
+    ///Macro to set the version number of templated archive in known versions of Boost
+    CHASTE_VERSION_CONTENT(1);
+};
+} // namespace serialization
+} // namespace boost
+
 //////////////////////////////////////////////////////////////////////////////
 //         Iterator class implementation - most methods are inlined         //
 //////////////////////////////////////////////////////////////////////////////
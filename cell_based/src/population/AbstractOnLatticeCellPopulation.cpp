@@ -33,6 +33,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#include <algorithm>
 #include "AbstractOnLatticeCellPopulation.hpp"
 
 template<unsigned DIM>
@@ -43,7 +44,9 @@ AbstractOnLatticeCellPopulation<DIM>::AbstractOnLatticeCellPopulation(AbstractMe
     : AbstractCellPopulation<DIM>(rMesh, rCells, locationIndices),
       mDeleteMesh(deleteMesh),
       mUpdateNodesInRandomOrder(true),
-      mIterateRandomlyOverUpdateRuleCollection(false)
+      mIterateRandomlyOverUpdateRuleCollection(false),
+      mUpdateNodesBySublattice(false),
+      mNumSublatticeSweeps(0)
 {
     std::list<CellPtr>::iterator it = this->mCells.begin();
     for (unsigned i=0; it != this->mCells.end(); ++it, ++i)
@@ -58,7 +61,9 @@ AbstractOnLatticeCellPopulation<DIM>::AbstractOnLatticeCellPopulation(AbstractMe
     : AbstractCellPopulation<DIM>(rMesh),
       mDeleteMesh(true),
       mUpdateNodesInRandomOrder(true),
-      mIterateRandomlyOverUpdateRuleCollection(false)
+      mIterateRandomlyOverUpdateRuleCollection(false),
+      mUpdateNodesBySublattice(false),
+      mNumSublatticeSweeps(0)
 {
 }
 
@@ -91,6 +96,74 @@ bool AbstractOnLatticeCellPopulation<DIM>::GetIterateRandomlyOverUpdateRuleColle
     return mIterateRandomlyOverUpdateRuleCollection;
 }
 
+template<unsigned DIM>
+void AbstractOnLatticeCellPopulation<DIM>::SetUpdateNodesBySublattice(bool updateNodesBySublattice)
+{
+    mUpdateNodesBySublattice = updateNodesBySublattice;
+}
+
+template<unsigned DIM>
+bool AbstractOnLatticeCellPopulation<DIM>::GetUpdateNodesBySublattice()
+{
+    return mUpdateNodesBySublattice;
+}
+
+template<unsigned DIM>
+std::vector<unsigned> AbstractOnLatticeCellPopulation<DIM>::GetSublatticeUpdateOrder(const std::vector<std::vector<unsigned> >& rSublattices)
+{
+    // The orderings use their own stream (purpose 1), distinct from the per-node streams
+    CounterBasedRandomStream stream = CounterBasedRandomNumberGenerator::Instance()->GetStream(0, mNumSublatticeSweeps, 1);
+    unsigned num_sublattices = rSublattices.size();
+
+    std::vector<unsigned> node_order;
+    if (num_sublattices == 0)
+    {
+        return node_order;
+    }
+
+    // Knuth shuffle of the sublattices
+    std::vector<unsigned> sublattice_order(num_sublattices);
+    for (unsigned i=0; i<num_sublattices; i++)
+    {
+        sublattice_order[i] = i;
+    }
+    for (unsigned end=num_sublattices-1; end>0; end--)
+    {
+        std::swap(sublattice_order[end], sublattice_order[stream.randMod(end+1)]);
+    }
+
+    for (unsigned i=0; i<num_sublattices; i++)
+    {
+        const std::vector<unsigned>& r_sublattice = rSublattices[sublattice_order[i]];
+        unsigned num_sublattice_nodes = r_sublattice.size();
+
+        std::vector<unsigned> local_order(num_sublattice_nodes);
+        for (unsigned j=0; j<num_sublattice_nodes; j++)
+        {
+            local_order[j] = j;
+        }
+        if (mUpdateNodesInRandomOrder && num_sublattice_nodes > 1)
+        {
+            for (unsigned end=num_sublattice_nodes-1; end>0; end--)
+            {
+                std::swap(local_order[end], local_order[stream.randMod(end+1)]);
+            }
+        }
+
+        for (unsigned j=0; j<num_sublattice_nodes; j++)
+        {
+            node_order.push_back(r_sublattice[local_order[j]]);
+        }
+    }
+    return node_order;
+}
+
+template<unsigned DIM>
+CounterBasedRandomStream AbstractOnLatticeCellPopulation<DIM>::GetSublatticeNodeStream(unsigned nodeIndex) const
+{
+    return CounterBasedRandomNumberGenerator::Instance()->GetStream(nodeIndex, mNumSublatticeSweeps);
+}
+
 template<unsigned DIM>
 void AbstractOnLatticeCellPopulation<DIM>::SetNode(unsigned nodeIndex, ChastePoint<DIM>& rNewLocation)
 {
@@ -110,6 +183,7 @@ void AbstractOnLatticeCellPopulation<DIM>::OutputCellPopulationParameters(out_st
 {
     *rParamsFile << "\t\t<UpdateNodesInRandomOrder>" << mUpdateNodesInRandomOrder << "</UpdateNodesInRandomOrder>\n";
     *rParamsFile << "\t\t<IterateRandomlyOverUpdateRuleCollection>" << mIterateRandomlyOverUpdateRuleCollection << "</IterateRandomlyOverUpdateRuleCollection>\n";
+    *rParamsFile << "\t\t<UpdateNodesBySublattice>" << mUpdateNodesBySublattice << "</UpdateNodesBySublattice>\n";
 
     // Call method on direct parent class
     AbstractCellPopulation<DIM>::OutputCellPopulationParameters(rParamsFile);
@@ -38,6 +38,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AbstractCellPopulation.hpp"
 #include "AbstractUpdateRule.hpp"
+#include "CounterBasedRandomNumberGenerator.hpp"
+#include "ChasteSerializationVersion.hpp"
 
 /**
  * An abstract class for on-lattice cell populations.
@@ -62,6 +64,14 @@ private:
         archive & mUpdateRuleCollection;
         archive & mUpdateNodesInRandomOrder;
         archive & mIterateRandomlyOverUpdateRuleCollection;
+        if (version >= 1)
+        {
+            archive & mUpdateNodesBySublattice;
+        }
+        if (version >= 2)
+        {
+            archive & mNumSublatticeSweeps;
+        }
     }
 
 protected:
@@ -90,6 +100,20 @@ protected:
      */
     bool mIterateRandomlyOverUpdateRuleCollection;
 
+    /**
+     * Whether to sweep over the lattice one sublattice at a time (see
+     * PottsMesh::rGetSublattices()) rather than over all nodes at once.
+     * Initialized to false in the constructor.
+     */
+    bool mUpdateNodesBySublattice;
+
+    /**
+     * The number of sublattice sweeps made so far. Together with a node index, this
+     * identifies the counter-based random stream used for an update in sublattice mode.
+     * Initialized to zero in the constructor.
+     */
+    unsigned mNumSublatticeSweeps;
+
     /**
      * Constructor that just takes in a mesh.
      *
@@ -97,6 +121,30 @@ protected:
      */
     AbstractOnLatticeCellPopulation(AbstractMesh<DIM, DIM>& rMesh);
 
+    /**
+     * Helper method for UpdateCellLocations() in sublattice mode. Get the order in
+     * which to visit the nodes during the current sweep: each sublattice in turn, and
+     * each node of the current sublattice in turn. The order of the sublattices is
+     * randomly permuted. If mUpdateNodesInRandomOrder is true then the nodes within
+     * each sublattice are also randomly permuted; otherwise they are visited in index
+     * order. The permutations are drawn from a CounterBasedRandomStream keyed by
+     * mNumSublatticeSweeps, not from RandomNumberGenerator.
+     *
+     * @param rSublattices a partition of the nodes into sublattices
+     * @return the node indices in the order in which they should be updated
+     */
+    std::vector<unsigned> GetSublatticeUpdateOrder(const std::vector<std::vector<unsigned> >& rSublattices);
+
+    /**
+     * Helper method for UpdateCellLocations() in sublattice mode.
+     *
+     * @param nodeIndex the index of a node
+     * @return the stream of random numbers to use when updating the given node during
+     *     the current sweep, which depends only on the seed of
+     *     CounterBasedRandomNumberGenerator, the node index and mNumSublatticeSweeps
+     */
+    CounterBasedRandomStream GetSublatticeNodeStream(unsigned nodeIndex) const;
+
 public:
 
     /**
@@ -154,6 +202,31 @@ public:
      */
     bool GetIterateRandomlyOverUpdateRuleCollection();
 
+    /**
+     * Set mUpdateNodesBySublattice.
+     *
+     * In sublattice mode each sweep visits the sublattices in turn, and the nodes
+     * within a sublattice (whose neighbourhoods do not overlap) in turn, so every
+     * node is updated exactly once per sweep instead of being sampled with
+     * replacement. The order of the sublattices is randomly permuted in each sweep;
+     * if mUpdateNodesInRandomOrder is true, so is the order of the nodes within each
+     * sublattice.
+     *
+     * The random numbers used to update a node are drawn from a CounterBasedRandomStream
+     * keyed by the node index and the sweep number, rather than from RandomNumberGenerator.
+     * The result of a sweep therefore depends only on the seed of
+     * CounterBasedRandomNumberGenerator and, for update rules that only involve a node and
+     * its neighbours, not on the order in which the nodes of a sublattice are visited.
+     *
+     * @param updateNodesBySublattice whether to update nodes one sublattice at a time
+     */
+    void SetUpdateNodesBySublattice(bool updateNodesBySublattice);
+
+    /**
+     * @return mUpdateNodesBySublattice.
+     */
+    bool GetUpdateNodesBySublattice();
+
     /**
      * Overridden SetNode() method.
      *
@@ -218,4 +291,21 @@ public:
     virtual const std::vector<boost::shared_ptr<AbstractUpdateRule<DIM> > > GetUpdateRuleCollection() const;
 };
 
+namespace boost {
+namespace serialization {
+/**
+ * Specify a version number for archive backwards compatibility.
+ *
+ * This is how to do BOOST_CLASS_VERSION(AbstractOnLatticeCellPopulation, 1)
+ * with a templated class.
+ */
+template <unsigned DIM>
+struct version<AbstractOnLatticeCellPopulation<DIM> >
+{
+    ///Macro to set the version number of templated archive in known versions of Boost
+    CHASTE_VERSION_CONTENT(2);
+};
+} // namespace serialization
+} // namespace boost
+
 #endif /*ABSTRACTONLATTICECELLPOPULATION_HPP_*/
@@ -395,95 +395,123 @@ void CaBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
             p_gen->Shuffle(mSwitchingUpdateRuleCollection);
         }
 
-        for (unsigned i=0; i<num_nodes; i++)
+        if (this->mUpdateNodesBySublattice)
         {
-            unsigned node_index;
-
-            if (this->mUpdateNodesInRandomOrder)
+            /*
+             * Sweep over the lattice one sublattice at a time, so that each node is
+             * visited exactly once per sweep and consecutive switches are attempted
+             * at nodes whose neighbourhoods do not overlap. Each switch draws from a
+             * random stream keyed by the node index and the sweep number, so it does
+             * not depend on how many random numbers were used before it.
+             */
+            std::vector<unsigned> node_order = this->GetSublatticeUpdateOrder(static_cast<PottsMesh<DIM>& >((this->mrMesh)).rGetSublattices());
+            for (unsigned i=0; i<node_order.size(); i++)
             {
-                node_index = p_gen->randMod(num_nodes);
+                CounterBasedRandomStream stream = this->GetSublatticeNodeStream(node_order[i]);
+                AttemptNodeSwitch(node_order[i], dt, &stream);
             }
-            else
+            this->mNumSublatticeSweeps++;
+        }
+        else
+        {
+            for (unsigned i=0; i<num_nodes; i++)
             {
-                // Loop over nodes in index order
-                node_index = i%num_nodes;
+                unsigned node_index;
+
+                if (this->mUpdateNodesInRandomOrder)
+                {
+                    node_index = p_gen->randMod(num_nodes);
+                }
+                else
+                {
+                    // Loop over nodes in index order
+                    node_index = i%num_nodes;
+                }
+
+                AttemptNodeSwitch(node_index, dt);
             }
+        }
+    }
+}
 
-            // Find a random available neighbouring node to switch cells with the current site
-            std::set<unsigned> neighbouring_node_indices = static_cast<PottsMesh<DIM>& >((this->mrMesh)).GetMooreNeighbouringNodeIndices(node_index);
+template<unsigned DIM>
+void CaBasedCellPopulation<DIM>::AttemptNodeSwitch(unsigned nodeIndex, double dt, CounterBasedRandomStream* pStream)
+{
+    RandomNumberGenerator* p_gen = RandomNumberGenerator::Instance();
 
-            unsigned neighbour_location_index;
+    // Find a random available neighbouring node to switch cells with the current site
+    std::set<unsigned> neighbouring_node_indices = static_cast<PottsMesh<DIM>& >((this->mrMesh)).GetMooreNeighbouringNodeIndices(nodeIndex);
 
-            if (!neighbouring_node_indices.empty())
-            {
-                unsigned num_neighbours = neighbouring_node_indices.size();
-                unsigned chosen_neighbour = p_gen->randMod(num_neighbours);
+    unsigned neighbour_location_index;
 
-                std::set<unsigned>::iterator neighbour_iter = neighbouring_node_indices.begin();
-                for (unsigned j=0; j<chosen_neighbour; j++)
-                {
-                    neighbour_iter++;
-                }
-                neighbour_location_index = *neighbour_iter;
+    if (!neighbouring_node_indices.empty())
+    {
+        unsigned num_neighbours = neighbouring_node_indices.size();
+        unsigned chosen_neighbour = pStream ? pStream->randMod(num_neighbours) : p_gen->randMod(num_neighbours);
+
+        std::set<unsigned>::iterator neighbour_iter = neighbouring_node_indices.begin();
+        for (unsigned j=0; j<chosen_neighbour; j++)
+        {
+            neighbour_iter++;
+        }
+        neighbour_location_index = *neighbour_iter;
 
-                bool is_cell_on_node_index = mAvailableSpaces[node_index] == 0 ? true : false;
-                bool is_cell_on_neighbour_location_index = mAvailableSpaces[neighbour_location_index] == 0 ? true : false;
+        bool is_cell_on_node_index = mAvailableSpaces[nodeIndex] == 0 ? true : false;
+        bool is_cell_on_neighbour_location_index = mAvailableSpaces[neighbour_location_index] == 0 ? true : false;
 
-                if (is_cell_on_node_index || is_cell_on_neighbour_location_index)
-                {
-                    double probability_of_switch = 0.0;
+        if (is_cell_on_node_index || is_cell_on_neighbour_location_index)
+        {
+            double probability_of_switch = 0.0;
 
-                    // Now add contributions to the probability from each CA switching update rule
-                    for (typename std::vector<boost::shared_ptr<AbstractUpdateRule<DIM> > >::iterator iter_rule = mSwitchingUpdateRuleCollection.begin();
-                         iter_rule != mSwitchingUpdateRuleCollection.end();
-                         ++iter_rule)
-                    {
-                        // This static cast is fine, since we assert the update rule must be a CA switching update rule in AddUpdateRule()
-                        double p = (boost::static_pointer_cast<AbstractCaSwitchingUpdateRule<DIM> >(*iter_rule))->EvaluateSwitchingProbability(node_index, neighbour_location_index, *this, dt, 1);
-                        probability_of_switch += p;
-                    }
+            // Now add contributions to the probability from each CA switching update rule
+            for (typename std::vector<boost::shared_ptr<AbstractUpdateRule<DIM> > >::iterator iter_rule = mSwitchingUpdateRuleCollection.begin();
+                 iter_rule != mSwitchingUpdateRuleCollection.end();
+                 ++iter_rule)
+            {
+                // This static cast is fine, since we assert the update rule must be a CA switching update rule in AddUpdateRule()
+                double p = (boost::static_pointer_cast<AbstractCaSwitchingUpdateRule<DIM> >(*iter_rule))->EvaluateSwitchingProbability(nodeIndex, neighbour_location_index, *this, dt, 1);
+                probability_of_switch += p;
+            }
 
-                    assert(probability_of_switch >= 0);
-                    assert(probability_of_switch <= 1);
+            assert(probability_of_switch >= 0);
+            assert(probability_of_switch <= 1);
 
-                    // Generate a uniform random number to do the random switch
-                    double random_number = p_gen->ranf();
+            // Generate a uniform random number to do the random switch
+            double random_number = pStream ? pStream->ranf() : p_gen->ranf();
 
-                    if (random_number < probability_of_switch)
-                    {
-                        if (is_cell_on_node_index && is_cell_on_neighbour_location_index)
-                        {
-                            // Swap the cells associated with the node and the neighbour node
-                            CellPtr p_cell = this->GetCellUsingLocationIndex(node_index);
-                            CellPtr p_neighbour_cell = this->GetCellUsingLocationIndex(neighbour_location_index);
+            if (random_number < probability_of_switch)
+            {
+                if (is_cell_on_node_index && is_cell_on_neighbour_location_index)
+                {
+                    // Swap the cells associated with the node and the neighbour node
+                    CellPtr p_cell = this->GetCellUsingLocationIndex(nodeIndex);
+                    CellPtr p_neighbour_cell = this->GetCellUsingLocationIndex(neighbour_location_index);
 
-                            // Remove the cells from their current location
-                            RemoveCellUsingLocationIndex(node_index, p_cell);
-                            RemoveCellUsingLocationIndex(neighbour_location_index, p_neighbour_cell);
+                    // Remove the cells from their current location
+                    RemoveCellUsingLocationIndex(nodeIndex, p_cell);
+                    RemoveCellUsingLocationIndex(neighbour_location_index, p_neighbour_cell);
 
-                            // Add cells to their new locations
-                            AddCellUsingLocationIndex(node_index, p_neighbour_cell);
-                            AddCellUsingLocationIndex(neighbour_location_index, p_cell);
-                        }
-                        else if (is_cell_on_node_index && !is_cell_on_neighbour_location_index)
-                        {
-                            // Move the cells associated with the node to the neighbour node
-                            CellPtr p_cell = this->GetCellUsingLocationIndex(node_index);
-                            RemoveCellUsingLocationIndex(node_index, p_cell);
-                            AddCellUsingLocationIndex(neighbour_location_index, p_cell);
-                        }
-                        else if (!is_cell_on_node_index && is_cell_on_neighbour_location_index)
-                        {
-                            // Move the cell associated with the neighbour node onto the node
-                            CellPtr p_neighbour_cell = this->GetCellUsingLocationIndex(neighbour_location_index);
-                            RemoveCellUsingLocationIndex(neighbour_location_index, p_neighbour_cell);
-                            AddCellUsingLocationIndex(node_index, p_neighbour_cell);
-                        }
-                        else
-                        {
-                            NEVER_REACHED;
-                        }
-                    }
+                    // Add cells to their new locations
+                    AddCellUsingLocationIndex(nodeIndex, p_neighbour_cell);
+                    AddCellUsingLocationIndex(neighbour_location_index, p_cell);
+                }
+                else if (is_cell_on_node_index && !is_cell_on_neighbour_location_index)
+                {
+                    // Move the cells associated with the node to the neighbour node
+                    CellPtr p_cell = this->GetCellUsingLocationIndex(nodeIndex);
+                    RemoveCellUsingLocationIndex(nodeIndex, p_cell);
+                    AddCellUsingLocationIndex(neighbour_location_index, p_cell);
+                }
+                else if (!is_cell_on_node_index && is_cell_on_neighbour_location_index)
+                {
+                    // Move the cell associated with the neighbour node onto the node
+                    CellPtr p_neighbour_cell = this->GetCellUsingLocationIndex(neighbour_location_index);
+                    RemoveCellUsingLocationIndex(neighbour_location_index, p_neighbour_cell);
+                    AddCellUsingLocationIndex(nodeIndex, p_neighbour_cell);
+                }
+                else
+                {
+                    NEVER_REACHED;
                 }
             }
         }
@@ -119,6 +119,19 @@ private:
      */
     void Validate();
 
+    /**
+     * Attempt a single switch at a given node: select a random Moore neighbour and,
+     * with probability given by the switching update rules, swap the cells occupying
+     * the two sites (or move a cell into an empty site). Helper method for
+     * UpdateCellLocations().
+     *
+     * @param nodeIndex the index of the target node
+     * @param dt time step
+     * @param pStream the stream from which to draw random numbers; if NULL
+     *     (the default), they are drawn from RandomNumberGenerator
+     */
+    void AttemptNodeSwitch(unsigned nodeIndex, double dt, CounterBasedRandomStream* pStream=nullptr);
+
     /**
      * Overridden WriteVtkResultsToFile() method.
      *
@@ -48,6 +48,9 @@ void CellwiseDataGradient<DIM>::SetupGradients(AbstractCellPopulation<DIM>& rCel
     MeshBasedCellPopulation<DIM>* pCellPopulation = static_cast<MeshBasedCellPopulation<DIM>*>(&(rCellPopulation));
     TetrahedralMesh<DIM,DIM>& r_mesh = pCellPopulation->rGetMesh();
 
+    // Look up the CellData handle once, rather than by name for every node
+    const unsigned item_handle = CellData::GetItemHandle(rItemName);
+
     // Initialise gradients size
     unsigned num_nodes = pCellPopulation->GetNumNodes();
     mGradients.resize(num_nodes, zero_vector<double>(DIM));
@@ -89,7 +92,7 @@ void CellwiseDataGradient<DIM>::SetupGradients(AbstractCellPopulation<DIM>& rCel
 
             // If no ghost element, get PDE solution
             CellPtr p_cell = pCellPopulation->GetCellUsingLocationIndex(node_global_index);
-            double pde_solution = p_cell->GetCellData()->GetItem(rItemName);
+            double pde_solution = p_cell->GetCellData()->GetItem(item_handle);
 
             // Interpolate gradient
             for (unsigned i=0; i<DIM; i++)
@@ -352,6 +352,8 @@ void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::Update(bool hasHadBirthsOrD
             }
             if (output_node_velocities)
             {
+                // The node may have survived an incremental remesh, so overwrite rather than accumulate
+                this->GetNode(new_node_index)->ClearAppliedForce();
                 this->GetNode(new_node_index)->AddAppliedForceContribution(old_node_applied_force_map[old_node_index]);
             }
         }
@@ -373,6 +375,7 @@ void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::Update(bool hasHadBirthsOrD
             for (std::list<CellPtr>::iterator it = this->mCells.begin(); it != this->mCells.end(); ++it)
             {
                 unsigned node_index = this->mCellLocationMap[(*it).get()];
+                this->GetNode(node_index)->ClearAppliedForce();
                 this->GetNode(node_index)->AddAppliedForceContribution(old_node_applied_force_map[node_index]);
             }
         }
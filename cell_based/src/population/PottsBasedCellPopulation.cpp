@@ -260,86 +260,120 @@ void PottsBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
         p_gen->Shuffle(this->mUpdateRuleCollection);
     }
 
-    for (unsigned i=0; i<num_nodes*mNumSweepsPerTimestep; i++)
+    if (this->mUpdateNodesBySublattice)
     {
-        unsigned node_index;
-
-        if (this->mUpdateNodesInRandomOrder)
+        /*
+         * Sweep over the lattice one sublattice at a time, so that each node is
+         * visited exactly once per sweep and consecutive copy attempts are at
+         * nodes whose neighbourhoods do not overlap. The attempts are still made
+         * one after the other: the volume, surface area and other element-wide
+         * terms of the Hamiltonian couple nodes of the same sublattice.
+         *
+         * Each copy attempt draws from a random stream keyed by the node index and
+         * the sweep number, so it does not depend on how many random numbers were
+         * used before it.
+         */
+        for (unsigned sweep=0; sweep<mNumSweepsPerTimestep; sweep++)
         {
-            node_index = p_gen->randMod(num_nodes);
+            std::vector<unsigned> node_order = this->GetSublatticeUpdateOrder(mpPottsMesh->rGetSublattices());
+            for (unsigned i=0; i<node_order.size(); i++)
+            {
+                CounterBasedRandomStream stream = this->GetSublatticeNodeStream(node_order[i]);
+                AttemptNodeCopy(node_order[i], &stream);
+            }
+            this->mNumSublatticeSweeps++;
         }
-        else
+    }
+    else
+    {
+        for (unsigned i=0; i<num_nodes*mNumSweepsPerTimestep; i++)
         {
-            // Loop over nodes in index order.
-            node_index = i%num_nodes;
+            unsigned node_index;
+
+            if (this->mUpdateNodesInRandomOrder)
+            {
+                node_index = p_gen->randMod(num_nodes);
+            }
+            else
+            {
+                // Loop over nodes in index order.
+                node_index = i%num_nodes;
+            }
+
+            AttemptNodeCopy(node_index);
         }
+    }
+}
+
+template<unsigned DIM>
+void PottsBasedCellPopulation<DIM>::AttemptNodeCopy(unsigned nodeIndex, CounterBasedRandomStream* pStream)
+{
+    RandomNumberGenerator* p_gen = RandomNumberGenerator::Instance();
+    Node<DIM>* p_node = this->mrMesh.GetNode(nodeIndex);
 
-        Node<DIM>* p_node = this->mrMesh.GetNode(node_index);
+    // Each node in the mesh must be in at most one element
+    assert(p_node->GetNumContainingElements() <= 1);
 
-        // Each node in the mesh must be in at most one element
-        assert(p_node->GetNumContainingElements() <= 1);
+    // Find a random available neighbouring node to overwrite current site
+    std::set<unsigned> neighbouring_node_indices = mpPottsMesh->GetMooreNeighbouringNodeIndices(nodeIndex);
+    unsigned neighbour_location_index;
 
-        // Find a random available neighbouring node to overwrite current site
-        std::set<unsigned> neighbouring_node_indices = mpPottsMesh->GetMooreNeighbouringNodeIndices(node_index);
-        unsigned neighbour_location_index;
+    if (!neighbouring_node_indices.empty())
+    {
+        unsigned num_neighbours = neighbouring_node_indices.size();
+        unsigned chosen_neighbour = pStream ? pStream->randMod(num_neighbours) : p_gen->randMod(num_neighbours);
 
-        if (!neighbouring_node_indices.empty())
+        std::set<unsigned>::iterator neighbour_iter = neighbouring_node_indices.begin();
+        for (unsigned j=0; j<chosen_neighbour; j++)
         {
-            unsigned num_neighbours = neighbouring_node_indices.size();
-            unsigned chosen_neighbour = p_gen->randMod(num_neighbours);
+            neighbour_iter++;
+        }
+
+        neighbour_location_index = *neighbour_iter;
 
-            std::set<unsigned>::iterator neighbour_iter = neighbouring_node_indices.begin();
-            for (unsigned j=0; j<chosen_neighbour; j++)
+        std::set<unsigned> containing_elements = p_node->rGetContainingElementIndices();
+        std::set<unsigned> neighbour_containing_elements = GetNode(neighbour_location_index)->rGetContainingElementIndices();
+        // Only calculate Hamiltonian and update elements if the nodes are from different elements, or one is from the medium
+        if ((!containing_elements.empty() && neighbour_containing_elements.empty())
+            || (containing_elements.empty() && !neighbour_containing_elements.empty())
+            || (!containing_elements.empty() && !neighbour_containing_elements.empty() && *containing_elements.begin() != *neighbour_containing_elements.begin()))
+        {
+            double delta_H = 0.0; // This is H_1-H_0.
+
+            // Now add contributions to the Hamiltonian from each AbstractPottsUpdateRule
+            for (typename std::vector<boost::shared_ptr<AbstractUpdateRule<DIM> > >::iterator iter = this->mUpdateRuleCollection.begin();
+                 iter != this->mUpdateRuleCollection.end();
+                 ++iter)
             {
-                neighbour_iter++;
+                // This static cast is fine, since we assert the update rule must be a Potts update rule in AddUpdateRule()
+                double dH = (boost::static_pointer_cast<AbstractPottsUpdateRule<DIM> >(*iter))->EvaluateHamiltonianContribution(neighbour_location_index, p_node->GetIndex(), *this);
+                delta_H += dH;
             }
 
-            neighbour_location_index = *neighbour_iter;
+            // Generate a uniform random number to do the random motion
+            double random_number = pStream ? pStream->ranf() : p_gen->ranf();
 
-            std::set<unsigned> containing_elements = p_node->rGetContainingElementIndices();
-            std::set<unsigned> neighbour_containing_elements = GetNode(neighbour_location_index)->rGetContainingElementIndices();
-            // Only calculate Hamiltonian and update elements if the nodes are from different elements, or one is from the medium
-            if ((!containing_elements.empty() && neighbour_containing_elements.empty())
-                || (containing_elements.empty() && !neighbour_containing_elements.empty())
-                || (!containing_elements.empty() && !neighbour_containing_elements.empty() && *containing_elements.begin() != *neighbour_containing_elements.begin()))
+            double p = exp(-delta_H/mTemperature);
+            if (delta_H <= 0 || random_number < p)
             {
-                double delta_H = 0.0; // This is H_1-H_0.
+                // Do swap
 
-                // Now add contributions to the Hamiltonian from each AbstractPottsUpdateRule
-                for (typename std::vector<boost::shared_ptr<AbstractUpdateRule<DIM> > >::iterator iter = this->mUpdateRuleCollection.begin();
-                     iter != this->mUpdateRuleCollection.end();
+                // Remove the current node from any elements containing it (there should be at most one such element)
+                for (std::set<unsigned>::iterator iter = containing_elements.begin();
+                     iter != containing_elements.end();
                      ++iter)
                 {
-                    // This static cast is fine, since we assert the update rule must be a Potts update rule in AddUpdateRule()
-                    double dH = (boost::static_pointer_cast<AbstractPottsUpdateRule<DIM> >(*iter))->EvaluateHamiltonianContribution(neighbour_location_index, p_node->GetIndex(), *this);
-                    delta_H += dH;
-                }
+                    GetElement(*iter)->DeleteNode(GetElement(*iter)->GetNodeLocalIndex(nodeIndex));
 
-                // Generate a uniform random number to do the random motion
-                double random_number = p_gen->ranf();
+                    ///\todo If this causes the element to have no nodes then flag the element and cell to be deleted
+                }
 
-                double p = exp(-delta_H/mTemperature);
-                if (delta_H <= 0 || random_number < p)
+                // Next add the current node to any elements containing the neighbouring node (there should be at most one such element)
+                for (std::set<unsigned>::iterator iter = neighbour_containing_elements.begin();
+                     iter != neighbour_containing_elements.end();
+                     ++iter)
                 {
-                    // Do swap
-
-                    // Remove the current node from any elements containing it (there should be at most one such element)
-                    for (std::set<unsigned>::iterator iter = containing_elements.begin();
-                         iter != containing_elements.end();
-                         ++iter)
-                    {
-                        GetElement(*iter)->DeleteNode(GetElement(*iter)->GetNodeLocalIndex(node_index));
-
-                        ///\todo If this causes the element to have no nodes then flag the element and cell to be deleted
-                    }
-
-                    // Next add the current node to any elements containing the neighbouring node (there should be at most one such element)
-                    for (std::set<unsigned>::iterator iter = neighbour_containing_elements.begin();
-                         iter != neighbour_containing_elements.end();
-                         ++iter)
-                    {
-                        GetElement(*iter)->AddNode(this->mrMesh.GetNode(node_index));
-                    }
+                    GetElement(*iter)->AddNode(this->mrMesh.GetNode(nodeIndex));
                 }
             }
         }
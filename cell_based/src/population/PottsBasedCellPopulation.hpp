@@ -125,6 +125,19 @@ private:
      */
     void Validate();
 
+    /**
+     * Perform a single Monte Carlo copy attempt at a given node: select a random
+     * Moore neighbour, evaluate the change in the Hamiltonian if the node were to
+     * be copied into the neighbour's element (or the medium), and accept or reject
+     * the copy according to the Metropolis criterion. Helper method for
+     * UpdateCellLocations().
+     *
+     * @param nodeIndex the index of the target node
+     * @param pStream the stream from which to draw random numbers; if NULL
+     *     (the default), they are drawn from RandomNumberGenerator
+     */
+    void AttemptNodeCopy(unsigned nodeIndex, CounterBasedRandomStream* pStream=nullptr);
+
     /**
      * Overridden WriteVtkResultsToFile() method.
      *
@@ -58,6 +58,28 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 template<unsigned ELEMENT_DIM, class SIM, unsigned SPACE_DIM=ELEMENT_DIM>
 class CellBasedSimulationArchiver
 {
+private:
+
+    /**
+     * Read a simulation from an archive of the given type.
+     *
+     * @return the unarchived simulation object
+     * @param rArchiveDirectory  folder containing the archive files
+     * @param rArchiveFilename  base name of the archive files
+     */
+    template<class Archive>
+    static SIM* LoadArchive(const FileFinder& rArchiveDirectory, const std::string& rArchiveFilename);
+
+    /**
+     * Write a simulation to an archive of the given type.
+     *
+     * @param pSim pointer to the simulation
+     * @param rArchiveDirectory  folder to contain the archive files
+     * @param rArchiveFilename  base name of the archive files
+     */
+    template<class Archive>
+    static void SaveArchive(SIM* pSim, const FileFinder& rArchiveDirectory, const std::string& rArchiveFilename);
+
 public:
 
     /**
@@ -68,6 +90,8 @@ public:
      *   (specified originally by simulation.SetOutputDirectory("wherever"); )
      * @param rTimeStamp  the time at which to load the simulation (this must
      *   be one of the times at which simulation.Save() was called)
+     *
+     * Both text and binary archives can be loaded; the format is detected from the archive file.
      */
     static SIM* Load(const std::string& rArchiveDirectory, const double& rTimeStamp);
 
@@ -82,8 +106,11 @@ public:
      * then the simulation itself.
      *
      * @param pSim pointer to the simulation
+     * @param useBinaryArchive  whether to write a Boost binary archive rather than a text archive.
+     *   Binary archives are faster to write and read, and smaller, but can only be loaded on a
+     *   machine with the same architecture and Boost version.
      */
-    static void Save(SIM* pSim);
+    static void Save(SIM* pSim, bool useBinaryArchive=false);
 };
 
 template<unsigned ELEMENT_DIM, class SIM, unsigned SPACE_DIM>
@@ -104,9 +131,23 @@ SIM* CellBasedSimulationArchiver<ELEMENT_DIM, SIM, SPACE_DIM>::Load(const std::s
     FileFinder archive_dir(rArchiveDirectory + "/archive/", RelativeTo::ChasteTestOutput);
     ArchiveLocationInfo::SetMeshPathname(archive_dir, mesh_filename);
 
+    // Pick the archive type to match the file (a missing file is reported by ArchiveOpener)
+    FileFinder archive_file(archive_filename, archive_dir);
+    if (archive_file.Exists() && ArchiveLocationInfo::IsBinaryArchiveFile(archive_file))
+    {
+        return LoadArchive<boost::archive::binary_iarchive>(archive_dir, archive_filename);
+    }
+    return LoadArchive<boost::archive::text_iarchive>(archive_dir, archive_filename);
+}
+
+template<unsigned ELEMENT_DIM, class SIM, unsigned SPACE_DIM>
+template<class Archive>
+SIM* CellBasedSimulationArchiver<ELEMENT_DIM, SIM, SPACE_DIM>::LoadArchive(const FileFinder& rArchiveDirectory,
+                                                                           const std::string& rArchiveFilename)
+{
     // Create an input archive
-    ArchiveOpener<boost::archive::text_iarchive, std::ifstream> arch_opener(archive_dir, archive_filename);
-    boost::archive::text_iarchive* p_arch = arch_opener.GetCommonArchive();
+    ArchiveOpener<Archive, std::ifstream> arch_opener(rArchiveDirectory, rArchiveFilename);
+    Archive* p_arch = arch_opener.GetCommonArchive();
 
     // Load the simulation
     SIM* p_sim;
@@ -115,7 +156,7 @@ SIM* CellBasedSimulationArchiver<ELEMENT_DIM, SIM, SPACE_DIM>::Load(const std::s
 }
 
 template<unsigned ELEMENT_DIM, class SIM, unsigned SPACE_DIM>
-void CellBasedSimulationArchiver<ELEMENT_DIM, SIM, SPACE_DIM>::Save(SIM* pSim)
+void CellBasedSimulationArchiver<ELEMENT_DIM, SIM, SPACE_DIM>::Save(SIM* pSim, bool useBinaryArchive)
 {
     // Get the simulation time as a string
     const SimulationTime* p_sim_time = SimulationTime::Instance();
@@ -128,9 +169,25 @@ void CellBasedSimulationArchiver<ELEMENT_DIM, SIM, SPACE_DIM>::Save(SIM* pSim)
     std::string archive_filename = "cell_population_sim_at_time_" + time_stamp.str() + ".arch";
     ArchiveLocationInfo::SetMeshFilename(std::string("mesh_") + time_stamp.str());
 
+    if (useBinaryArchive)
+    {
+        SaveArchive<boost::archive::binary_oarchive>(pSim, archive_dir, archive_filename);
+    }
+    else
+    {
+        SaveArchive<boost::archive::text_oarchive>(pSim, archive_dir, archive_filename);
+    }
+}
+
+template<unsigned ELEMENT_DIM, class SIM, unsigned SPACE_DIM>
+template<class Archive>
+void CellBasedSimulationArchiver<ELEMENT_DIM, SIM, SPACE_DIM>::SaveArchive(SIM* pSim,
+                                                                           const FileFinder& rArchiveDirectory,
+                                                                           const std::string& rArchiveFilename)
+{
     // Create output archive
-    ArchiveOpener<boost::archive::text_oarchive, std::ofstream> arch_opener(archive_dir, archive_filename);
-    boost::archive::text_oarchive* p_arch = arch_opener.GetCommonArchive();
+    ArchiveOpener<Archive, std::ofstream> arch_opener(rArchiveDirectory, rArchiveFilename);
+    Archive* p_arch = arch_opener.GetCommonArchive();
 
     // Archive the simulation (const-ness would be a pain here)
     (*p_arch) & pSim;
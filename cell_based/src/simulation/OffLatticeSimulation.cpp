@@ -163,6 +163,9 @@ void OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::RevertToOldLocations(std::map<
     {
         (node_iter)->rGetModifiableLocation() = oldNodeLoctions[&(*node_iter)];
     }
+
+    // Nodes have been moved directly, so any cached element geometry is out of date
+    this->mrCellPopulation.rGetMesh().InvalidateGeometryCache();
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -176,6 +179,12 @@ void OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::ApplyBoundaries(std::map<Node<
         (*bcs_iter)->ImposeBoundaryCondition(oldNodeLoctions);
     }
 
+    // Boundary conditions move nodes directly, so any cached element geometry is out of date
+    if (!mBoundaryConditions.empty())
+    {
+        this->mrCellPopulation.rGetMesh().InvalidateGeometryCache();
+    }
+
     // Verify that each boundary condition is now satisfied
     for (typename std::vector<boost::shared_ptr<AbstractCellPopulationBoundaryCondition<ELEMENT_DIM,SPACE_DIM> > >::iterator bcs_iter = mBoundaryConditions.begin();
          bcs_iter != mBoundaryConditions.end();
@@ -0,0 +1,363 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "BatchedOdeSolverModifier.hpp"
+
+#include <cfloat>
+#include <map>
+#include <typeinfo>
+
+#include "ApoptoticCellProperty.hpp"
+#include "Exception.hpp"
+#include "RungeKutta4IvpOdeSolver.hpp"
+#include "TimeStepper.hpp"
+
+template<unsigned DIM>
+BatchedOdeSolverModifier<DIM>::BatchedOdeSolverModifier()
+    : AbstractCellBasedSimulationModifier<DIM>(),
+      mAdaptiveSolverTimeStep(0.001)
+{
+}
+
+template<unsigned DIM>
+BatchedOdeSolverModifier<DIM>::~BatchedOdeSolverModifier()
+{
+}
+
+template<unsigned DIM>
+void BatchedOdeSolverModifier<DIM>::UpdateAtEndOfTimeStep(AbstractCellPopulation<DIM,DIM>& rCellPopulation)
+{
+    SolveOdesInBatches(rCellPopulation);
+}
+
+template<unsigned DIM>
+void BatchedOdeSolverModifier<DIM>::SetupSolve(AbstractCellPopulation<DIM,DIM>& rCellPopulation, std::string outputDirectory)
+{
+    // The ODE systems are solved to the start time by the cells themselves, so there is nothing to do here
+}
+
+template<unsigned DIM>
+void BatchedOdeSolverModifier<DIM>::SolveOdesInBatches(AbstractCellPopulation<DIM,DIM>& rCellPopulation)
+{
+    double current_time = SimulationTime::Instance()->GetTime();
+
+    std::vector<CellCycleModelOdeHandler*> srn_handlers;
+    std::vector<CellCycleModelOdeHandler*> cell_cycle_handlers;
+    for (typename AbstractCellPopulation<DIM>::Iterator cell_iter = rCellPopulation.Begin();
+         cell_iter != rCellPopulation.End();
+         ++cell_iter)
+    {
+        // Apoptotic cells do not run their models (see Cell::ReadyToDivide())
+        if (cell_iter->HasApoptosisBegun() || cell_iter->template HasCellProperty<ApoptoticCellProperty>())
+        {
+            continue;
+        }
+
+        CellCycleModelOdeHandler* p_srn_handler = dynamic_cast<CellCycleModelOdeHandler*>(cell_iter->GetSrnModel());
+        if (p_srn_handler)
+        {
+            srn_handlers.push_back(p_srn_handler);
+        }
+
+        CellCycleModelOdeHandler* p_cell_cycle_handler = dynamic_cast<CellCycleModelOdeHandler*>(cell_iter->GetCellCycleModel());
+        if (p_cell_cycle_handler)
+        {
+            cell_cycle_handlers.push_back(p_cell_cycle_handler);
+        }
+    }
+
+    // The SRN models are solved first, since a cell-cycle model may depend on them
+    SolveInBatches(srn_handlers, current_time, false);
+
+    // Cell-cycle models check that their protein concentrations stay non-negative
+    SolveInBatches(cell_cycle_handlers, current_time, true);
+}
+
+template<unsigned DIM>
+void BatchedOdeSolverModifier<DIM>::SolveInBatches(const std::vector<CellCycleModelOdeHandler*>& rHandlers, double currentTime, bool checkNonNegative)
+{
+    // Group the models by ODE system type, start time and time step
+    typedef std::pair<std::string, std::pair<double, double> > BatchKey;
+    std::map<BatchKey, std::vector<CellCycleModelOdeHandler*> > batches;
+
+    for (std::vector<CellCycleModelOdeHandler*>::const_iterator iter = rHandlers.begin();
+         iter != rHandlers.end();
+         ++iter)
+    {
+        CellCycleModelOdeHandler* p_handler = *iter;
+        if (p_handler->GetOdeSystem() == nullptr || !p_handler->CanSolveOdeInBatch(currentTime))
+        {
+            continue;
+        }
+
+        double time_step = GetBatchTimeStep(p_handler);
+        if (time_step == DOUBLE_UNSET)
+        {
+            continue;
+        }
+
+        AbstractOdeSystem* p_system = p_handler->GetOdeSystem();
+        BatchKey key(typeid(*p_system).name(), std::make_pair(p_handler->GetLastTime(), time_step));
+        batches[key].push_back(p_handler);
+    }
+
+    for (std::map<BatchKey, std::vector<CellCycleModelOdeHandler*> >::iterator batch_iter = batches.begin();
+         batch_iter != batches.end();
+         ++batch_iter)
+    {
+        double start_time = batch_iter->first.second.first;
+        double time_step = batch_iter->first.second.second;
+        SolveBatch(batch_iter->second, start_time, currentTime, time_step, checkNonNegative);
+    }
+}
+
+template<unsigned DIM>
+double BatchedOdeSolverModifier<DIM>::GetBatchTimeStep(CellCycleModelOdeHandler* pHandler)
+{
+    double time_step = DOUBLE_UNSET;
+
+    boost::shared_ptr<AbstractCellCycleModelOdeSolver> p_solver = pHandler->GetOdeSolver();
+    if (p_solver && p_solver->IsSetUp())
+    {
+        if (p_solver->IsAdaptive())
+        {
+            time_step = mAdaptiveSolverTimeStep;
+        }
+        else if (boost::dynamic_pointer_cast<RungeKutta4IvpOdeSolver>(p_solver->GetIvpOdeSolver()))
+        {
+            time_step = pHandler->GetDt();
+        }
+    }
+    return time_step;
+}
+
+template<unsigned DIM>
+void BatchedOdeSolverModifier<DIM>::EvaluateBatchDerivatives(const std::vector<CellCycleModelOdeHandler*>& rHandlers,
+                                                             const std::vector<bool>& rActive,
+                                                             double time,
+                                                             const std::vector<double>& rY,
+                                                             std::vector<double>& rDY)
+{
+    const unsigned num_systems = rHandlers.size();
+    const unsigned num_variables = rY.size()/num_systems;
+
+    std::vector<double> system_y(num_variables);
+    std::vector<double> system_dy(num_variables);
+    for (unsigned system=0; system<num_systems; system++)
+    {
+        if (rActive[system])
+        {
+            for (unsigned var=0; var<num_variables; var++)
+            {
+                system_y[var] = rY[var*num_systems + system];
+            }
+            rHandlers[system]->GetOdeSystem()->EvaluateYDerivatives(time, system_y, system_dy);
+            for (unsigned var=0; var<num_variables; var++)
+            {
+                rDY[var*num_systems + system] = system_dy[var];
+            }
+        }
+        else
+        {
+            for (unsigned var=0; var<num_variables; var++)
+            {
+                rDY[var*num_systems + system] = 0.0;
+            }
+        }
+    }
+}
+
+template<unsigned DIM>
+unsigned BatchedOdeSolverModifier<DIM>::SolveBatch(const std::vector<CellCycleModelOdeHandler*>& rHandlers,
+                                                   double startTime,
+                                                   double endTime,
+                                                   double timeStep,
+                                                   bool checkNonNegative)
+{
+    if (rHandlers.empty() || !(endTime > startTime))
+    {
+        return 0;
+    }
+
+    const unsigned num_systems = rHandlers.size();
+    const unsigned num_variables = rHandlers[0]->GetOdeSystem()->GetNumberOfStateVariables();
+    const unsigned batch_size = num_systems*num_variables;
+
+    // Gather the state variables into a structure-of-arrays layout, y[variable*num_systems + system]
+    std::vector<double> y(batch_size);
+    std::vector<bool> active(num_systems, true);
+    for (unsigned system=0; system<num_systems; system++)
+    {
+        AbstractOdeSystem* p_system = rHandlers[system]->GetOdeSystem();
+        assert(p_system->GetNumberOfStateVariables() == num_variables);
+
+        rHandlers[system]->PrepareForBatchedSolve(endTime);
+
+        std::vector<double>& r_state = p_system->rGetStateVariables();
+        for (unsigned var=0; var<num_variables; var++)
+        {
+            y[var*num_systems + system] = r_state[var];
+        }
+
+        // Leave any system whose stopping event is already true to the per-cell solver, which will throw
+        if (p_system->CalculateStoppingEvent(startTime, r_state))
+        {
+            active[system] = false;
+        }
+    }
+
+    std::vector<double> k1(batch_size);
+    std::vector<double> k2(batch_size);
+    std::vector<double> k3(batch_size);
+    std::vector<double> k4(batch_size);
+    std::vector<double> yki(batch_size);
+    std::vector<double> dy(batch_size);
+    std::vector<double> system_y(num_variables);
+
+    // Apply the same Runge-Kutta 4th order method as RungeKutta4IvpOdeSolver to the whole batch
+    TimeStepper stepper(startTime, endTime, timeStep);
+    while (!stepper.IsTimeAtEnd())
+    {
+        const double time = stepper.GetTime();
+        const double h = stepper.GetNextTimeStep();
+
+        EvaluateBatchDerivatives(rHandlers, active, time, y, dy);
+        for (unsigned i=0; i<batch_size; i++)
+        {
+            k1[i] = h*dy[i];
+            yki[i] = y[i] + 0.5*k1[i];
+        }
+
+        EvaluateBatchDerivatives(rHandlers, active, time+0.5*h, yki, dy);
+        for (unsigned i=0; i<batch_size; i++)
+        {
+            k2[i] = h*dy[i];
+            yki[i] = y[i] + 0.5*k2[i];
+        }
+
+        EvaluateBatchDerivatives(rHandlers, active, time+0.5*h, yki, dy);
+        for (unsigned i=0; i<batch_size; i++)
+        {
+            k3[i] = h*dy[i];
+            yki[i] = y[i] + k3[i];
+        }
+
+        EvaluateBatchDerivatives(rHandlers, active, time+h, yki, dy);
+        for (unsigned i=0; i<batch_size; i++)
+        {
+            k4[i] = h*dy[i];
+            y[i] = y[i] + (k1[i]+2*k2[i]+2*k3[i]+k4[i])/6.0;
+        }
+
+        stepper.AdvanceOneTimeStep();
+
+        // Roll back any system whose stopping event has triggered; the per-cell solver will find the stopping time
+        for (unsigned system=0; system<num_systems; system++)
+        {
+            if (active[system])
+            {
+                for (unsigned var=0; var<num_variables; var++)
+                {
+                    system_y[var] = y[var*num_systems + system];
+                }
+                if (rHandlers[system]->GetOdeSystem()->CalculateStoppingEvent(stepper.GetTime(), system_y))
+                {
+                    active[system] = false;
+                }
+                else if (checkNonNegative)
+                {
+                    // Check no concentrations have gone negative
+                    for (unsigned var=0; var<num_variables; var++)
+                    {
+                        if (system_y[var] < -DBL_EPSILON)
+                        {
+                            EXCEPTION("A protein concentration " << var << " has gone negative (" <<
+                                      system_y[var] << ")\n"
+                                      << "Chaste predicts that the CellCycleModel numerical method is probably unstable.");
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Scatter the results back to the systems that were solved
+    unsigned num_solved = 0;
+    for (unsigned system=0; system<num_systems; system++)
+    {
+        if (active[system])
+        {
+            for (unsigned var=0; var<num_variables; var++)
+            {
+                system_y[var] = y[var*num_systems + system];
+            }
+            rHandlers[system]->SetStateVariables(system_y);
+            rHandlers[system]->SetLastTime(endTime);
+            num_solved++;
+        }
+    }
+    return num_solved;
+}
+
+template<unsigned DIM>
+double BatchedOdeSolverModifier<DIM>::GetAdaptiveSolverTimeStep()
+{
+    return mAdaptiveSolverTimeStep;
+}
+
+template<unsigned DIM>
+void BatchedOdeSolverModifier<DIM>::SetAdaptiveSolverTimeStep(double adaptiveSolverTimeStep)
+{
+    assert(adaptiveSolverTimeStep > 0.0);
+    mAdaptiveSolverTimeStep = adaptiveSolverTimeStep;
+}
+
+template<unsigned DIM>
+void BatchedOdeSolverModifier<DIM>::OutputSimulationModifierParameters(out_stream& rParamsFile)
+{
+    *rParamsFile << "\t\t\t<AdaptiveSolverTimeStep>" << mAdaptiveSolverTimeStep << "</AdaptiveSolverTimeStep>\n";
+
+    // Next, call method on direct parent class
+    AbstractCellBasedSimulationModifier<DIM>::OutputSimulationModifierParameters(rParamsFile);
+}
+
+// Explicit instantiation
+template class BatchedOdeSolverModifier<1>;
+template class BatchedOdeSolverModifier<2>;
+template class BatchedOdeSolverModifier<3>;
+
+// Serialization for Boost >= 1.36
+#include "SerializationExportWrapperForCpp.hpp"
+EXPORT_TEMPLATE_CLASS_SAME_DIMS(BatchedOdeSolverModifier)
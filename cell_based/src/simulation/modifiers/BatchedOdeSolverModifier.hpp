@@ -0,0 +1,215 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BATCHEDODESOLVERMODIFIER_HPP_
+#define BATCHEDODESOLVERMODIFIER_HPP_
+
+#include "ChasteSerialization.hpp"
+#include <boost/serialization/base_object.hpp>
+
+#include "AbstractCellBasedSimulationModifier.hpp"
+#include "CellCycleModelOdeHandler.hpp"
+
+/**
+ * A modifier class which, at the end of each time step, advances the ODE systems of all
+ * ODE-based SRN and cell-cycle models in the population together, rather than one cell
+ * at a time when each cell's ReadyToDivide() method is called.
+ *
+ * Models are gathered into batches that share an ODE system type, start time and time step.
+ * The state variables of each batch are packed into a single structure-of-arrays state
+ * array and advanced with the classical fourth-order Runge-Kutta scheme in one shared
+ * stepping loop, so that the stage updates run over contiguous memory. The right-hand side
+ * is not vectorised: it is still evaluated once per cell and stage, through each model's
+ * own ODE system. The results are then scattered back and the models' last solve times updated, so that the
+ * subsequent per-cell calls are no-ops.
+ *
+ * Models using RungeKutta4IvpOdeSolver are batched with their own time step, and give
+ * results identical to the per-cell solver. Models using an adaptive solver (CVODE) are
+ * batched with the fixed time step returned by GetAdaptiveSolverTimeStep(). Models using
+ * any other solver, and models for which CanSolveOdeInBatch() returns false, are left to
+ * the per-cell solver. A model whose stopping event triggers during a batched solve is
+ * rolled back and also left to the per-cell solver, which locates the stopping time.
+ *
+ * Neighbour coupling through CellData is supported, since AdjustOdeParameters() is called
+ * on each model before the batch is solved. When used with DeltaNotchTrackingModifier,
+ * this modifier should be added to the simulation first.
+ */
+template<unsigned DIM>
+class BatchedOdeSolverModifier : public AbstractCellBasedSimulationModifier<DIM,DIM>
+{
+    /** Needed for serialization. */
+    friend class boost::serialization::access;
+    /**
+     * Boost Serialization method for archiving/checkpointing.
+     * Archives the object and its member variables.
+     *
+     * @param archive  The boost archive.
+     * @param version  The current version of this class.
+     */
+    template<class Archive>
+    void serialize(Archive & archive, const unsigned int version)
+    {
+        archive & boost::serialization::base_object<AbstractCellBasedSimulationModifier<DIM,DIM> >(*this);
+        archive & mAdaptiveSolverTimeStep;
+    }
+
+    /**
+     * The fixed time step used to solve, in a batch, the ODE systems of models
+     * that use an adaptive solver. Defaults to 0.001 hours.
+     */
+    double mAdaptiveSolverTimeStep;
+
+    /**
+     * Helper method to return the time step with which a model's ODE system is batch solved.
+     *
+     * @param pHandler the model's ODE handler
+     * @return the time step, or DOUBLE_UNSET if the model's solver cannot be batched
+     */
+    double GetBatchTimeStep(CellCycleModelOdeHandler* pHandler);
+
+    /**
+     * Helper method to group models into batches and solve each batch to the current time.
+     *
+     * @param rHandlers the ODE handlers of the models to consider
+     * @param currentTime the time to which to solve
+     * @param checkNonNegative whether to check that no state variable goes negative (see SolveBatch())
+     */
+    void SolveInBatches(const std::vector<CellCycleModelOdeHandler*>& rHandlers, double currentTime, bool checkNonNegative);
+
+    /**
+     * Helper method to evaluate the right-hand side of every active ODE system in a batch.
+     *
+     * @param rHandlers the ODE handlers of the models in the batch
+     * @param rActive whether each model in the batch is still being solved
+     * @param time the time at which to evaluate the right-hand side
+     * @param rY the batch state, stored as rY[variable*num_systems + system]
+     * @param rDY filled in with the batch derivatives, in the same layout (zero for inactive systems)
+     */
+    void EvaluateBatchDerivatives(const std::vector<CellCycleModelOdeHandler*>& rHandlers,
+                                  const std::vector<bool>& rActive,
+                                  double time,
+                                  const std::vector<double>& rY,
+                                  std::vector<double>& rDY);
+
+public:
+
+    /**
+     * Default constructor.
+     */
+    BatchedOdeSolverModifier();
+
+    /**
+     * Destructor.
+     */
+    virtual ~BatchedOdeSolverModifier();
+
+    /**
+     * Overridden UpdateAtEndOfTimeStep() method.
+     *
+     * Specifies what to do in the simulation at the end of each time step.
+     *
+     * @param rCellPopulation reference to the cell population
+     */
+    virtual void UpdateAtEndOfTimeStep(AbstractCellPopulation<DIM,DIM>& rCellPopulation);
+
+    /**
+     * Overridden SetupSolve() method.
+     *
+     * Specifies what to do in the simulation before the start of the time loop.
+     *
+     * @param rCellPopulation reference to the cell population
+     * @param outputDirectory the output directory, relative to where Chaste output is stored
+     */
+    virtual void SetupSolve(AbstractCellPopulation<DIM,DIM>& rCellPopulation, std::string outputDirectory);
+
+    /**
+     * Solve the ODE systems of all ODE-based SRN and cell-cycle models in the population
+     * to the current time, in batches. SRN models are solved before cell-cycle models,
+     * as in Cell::ReadyToDivide().
+     *
+     * @param rCellPopulation reference to the cell population
+     */
+    void SolveOdesInBatches(AbstractCellPopulation<DIM,DIM>& rCellPopulation);
+
+    /**
+     * Solve, with the classical fourth-order Runge-Kutta scheme, a batch of ODE systems
+     * of the same type from startTime to endTime.
+     *
+     * Each system whose stopping event is true initially, or becomes true during the solve,
+     * is left unchanged. The other systems have their state variables and last solve times updated.
+     *
+     * If checkNonNegative is true then, as in AbstractOdeBasedCellCycleModel::ReadyToDivide(), an
+     * exception is thrown if a state variable of a system being solved goes negative after any step.
+     *
+     * @param rHandlers the ODE handlers of the models in the batch
+     * @param startTime the time from which to solve
+     * @param endTime the time to which to solve
+     * @param timeStep the time step to use
+     * @param checkNonNegative whether to check that the state variables (protein concentrations)
+     *     stay non-negative (defaults to false)
+     *
+     * @return the number of systems that were solved
+     */
+    unsigned SolveBatch(const std::vector<CellCycleModelOdeHandler*>& rHandlers,
+                        double startTime,
+                        double endTime,
+                        double timeStep,
+                        bool checkNonNegative=false);
+
+    /**
+     * @return #mAdaptiveSolverTimeStep
+     */
+    double GetAdaptiveSolverTimeStep();
+
+    /**
+     * Set #mAdaptiveSolverTimeStep.
+     *
+     * @param adaptiveSolverTimeStep the new value of #mAdaptiveSolverTimeStep
+     */
+    void SetAdaptiveSolverTimeStep(double adaptiveSolverTimeStep);
+
+    /**
+     * Overridden OutputSimulationModifierParameters() method.
+     * Output any simulation modifier parameters to file.
+     *
+     * @param rParamsFile the file stream to which the parameters are output
+     */
+    void OutputSimulationModifierParameters(out_stream& rParamsFile);
+};
+
+#include "SerializationExportWrapper.hpp"
+EXPORT_TEMPLATE_CLASS_SAME_DIMS(BatchedOdeSolverModifier)
+
+#endif /*BATCHEDODESOLVERMODIFIER_HPP_*/
@@ -69,6 +69,11 @@ void DeltaNotchTrackingModifier<DIM>::UpdateCellData(AbstractCellPopulation<DIM,
     // Make sure the cell population is updated
     rCellPopulation.Update();
 
+    // Look up the CellData handles once, rather than by name for every cell
+    const unsigned notch_handle = CellData::GetItemHandle("notch");
+    const unsigned delta_handle = CellData::GetItemHandle("delta");
+    const unsigned mean_delta_handle = CellData::GetItemHandle("mean delta");
+
     // First recover each cell's Notch and Delta concentrations from the ODEs and store in CellData
     for (typename AbstractCellPopulation<DIM>::Iterator cell_iter = rCellPopulation.Begin();
          cell_iter != rCellPopulation.End();
@@ -79,8 +84,9 @@ void DeltaNotchTrackingModifier<DIM>::UpdateCellData(AbstractCellPopulation<DIM,
         double this_notch = p_model->GetNotch();
 
         // Note that the state variables must be in the same order as listed in DeltaNotchOdeSystem
-        cell_iter->GetCellData()->SetItem("notch", this_notch);
-        cell_iter->GetCellData()->SetItem("delta", this_delta);
+        boost::shared_ptr<CellData> p_cell_data = cell_iter->GetCellData();
+        p_cell_data->SetItem(notch_handle, this_notch);
+        p_cell_data->SetItem(delta_handle, this_delta);
     }
 
     // Next iterate over the population to compute and store each cell's neighbouring Delta concentration in CellData
@@ -100,15 +106,15 @@ void DeltaNotchTrackingModifier<DIM>::UpdateCellData(AbstractCellPopulation<DIM,
                  ++iter)
             {
                 CellPtr p_cell = rCellPopulation.GetCellUsingLocationIndex(*iter);
-                double this_delta = p_cell->GetCellData()->GetItem("delta");
+                double this_delta = p_cell->GetCellData()->GetItem(delta_handle);
                 mean_delta += this_delta/neighbour_indices.size();
             }
-            cell_iter->GetCellData()->SetItem("mean delta", mean_delta);
+            cell_iter->GetCellData()->SetItem(mean_delta_handle, mean_delta);
         }
         else
         {
             // If this cell has no neighbours, such as an isolated cell in a CaBasedCellPopulation, store 0.0 for the cell data
-            cell_iter->GetCellData()->SetItem("mean delta", 0.0);
+            cell_iter->GetCellData()->SetItem(mean_delta_handle, 0.0);
         }
     }
 }
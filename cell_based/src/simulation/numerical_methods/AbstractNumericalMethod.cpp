@@ -45,6 +45,7 @@ template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 AbstractNumericalMethod<ELEMENT_DIM,SPACE_DIM>::AbstractNumericalMethod()
     : mpCellPopulation(nullptr),
       mpForceCollection(nullptr),
+      mpBoundaryConditions(nullptr),
       mUseAdaptiveTimestep(false),
       mUseUpdateNodeLocation(false),
       mGhostNodeForcesEnabled(true)
@@ -121,6 +122,11 @@ std::map<Node<SPACE_DIM>*, c_vector<double, SPACE_DIM> > AbstractNumericalMethod
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void AbstractNumericalMethod<ELEMENT_DIM,SPACE_DIM>::ImposeBoundaryConditions(std::map<Node<SPACE_DIM>*, c_vector<double, SPACE_DIM> >& rOldNodeLocations)
 {
+    if (mpBoundaryConditions == nullptr)
+    {
+        return;
+    }
+
     // Apply any boundary conditions
     for (typename std::vector<boost::shared_ptr<AbstractCellPopulationBoundaryCondition<ELEMENT_DIM,SPACE_DIM> > >::iterator bcs_iter = mpBoundaryConditions->begin();
          bcs_iter != mpBoundaryConditions->end();
@@ -190,6 +196,18 @@ std::vector<c_vector<double, SPACE_DIM> > AbstractNumericalMethod<ELEMENT_DIM,SP
     return current_locations;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractNumericalMethod<ELEMENT_DIM,SPACE_DIM>::SetCurrentLocations(const std::vector<c_vector<double, SPACE_DIM> >& rLocations)
+{
+    unsigned index = 0;
+    for (typename AbstractMesh<ELEMENT_DIM, SPACE_DIM>::NodeIterator node_iter = mpCellPopulation->rGetMesh().GetNodeIteratorBegin();
+         node_iter != mpCellPopulation->rGetMesh().GetNodeIteratorEnd();
+         ++node_iter, ++index)
+    {
+        SafeNodePositionUpdate(node_iter->GetIndex(), rLocations[index]);
+    }
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void AbstractNumericalMethod<ELEMENT_DIM,SPACE_DIM>::SafeNodePositionUpdate( unsigned nodeIndex, c_vector<double, SPACE_DIM> newPosition)
 {
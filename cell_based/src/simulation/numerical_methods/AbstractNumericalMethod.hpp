@@ -118,7 +118,8 @@ protected:
 
     /**
      * Helper method to apply boundary conditions. Used in higher order methods like RK4.
-     * @param rOldLocations the node locations prior to being updated.
+     * Does nothing if no boundary conditions have been set.
+     * @param rOldNodeLocations the node locations prior to being updated.
      */
     void ImposeBoundaryConditions(std::map<Node<SPACE_DIM>*, c_vector<double, SPACE_DIM> >& rOldNodeLocations);
 
@@ -134,6 +135,14 @@ protected:
      */
     std::vector<c_vector<double, SPACE_DIM> > SaveCurrentLocations();
 
+    /**
+     * Moves each node in the population to a given location, as used for the intermediate stages of
+     * higher order methods. No check for step size exceptions is made.
+     *
+     * @param rLocations the new node locations, in the order returned by SaveCurrentLocations()
+     */
+    void SetCurrentLocations(const std::vector<c_vector<double, SPACE_DIM> >& rLocations);
+
     /**
      * Updates a single node's position, taking into account periodic boundary conditions
      *
@@ -0,0 +1,298 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "BackwardEulerNumericalMethod.hpp"
+#include "Exception.hpp"
+
+#include <cfloat>
+#include <cmath>
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+BackwardEulerNumericalMethod<ELEMENT_DIM,SPACE_DIM>::BackwardEulerNumericalMethod()
+    : AbstractNumericalMethod<ELEMENT_DIM,SPACE_DIM>(),
+      mMaxNewtonIterations(1),
+      mMaxLinearIterations(20),
+      mLinearSolverRelativeTolerance(1e-6)
+{
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+BackwardEulerNumericalMethod<ELEMENT_DIM,SPACE_DIM>::~BackwardEulerNumericalMethod()
+{
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+std::vector<c_vector<double, SPACE_DIM> > BackwardEulerNumericalMethod<ELEMENT_DIM,SPACE_DIM>::ComputeForcesAtLocations(
+    const std::vector<c_vector<double, SPACE_DIM> >& rLocations,
+    std::map<Node<SPACE_DIM>*, c_vector<double, SPACE_DIM> >& rOldNodeLocations)
+{
+    this->SetCurrentLocations(rLocations);
+    this->ImposeBoundaryConditions(rOldNodeLocations);
+    return this->ComputeForcesIncludingDamping();
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void BackwardEulerNumericalMethod<ELEMENT_DIM,SPACE_DIM>::UpdateAllNodePositions(double dt)
+{
+    if (!this->mUseUpdateNodeLocation)
+    {
+        std::map<Node<SPACE_DIM>*, c_vector<double, SPACE_DIM> > old_node_locations = this->SaveCurrentNodeLocations();
+        std::vector<c_vector<double, SPACE_DIM> > initial_locations = this->SaveCurrentLocations();
+        unsigned num_nodes = initial_locations.size();
+
+        double initial_norm = 0.0;
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            initial_norm += inner_prod(initial_locations[i], initial_locations[i]);
+        }
+        initial_norm = sqrt(initial_norm);
+
+        // The damping constant of each node, in the order used by ComputeForcesIncludingDamping()
+        std::vector<double> damping(num_nodes);
+        unsigned damping_index = 0;
+        for (typename AbstractMesh<ELEMENT_DIM, SPACE_DIM>::NodeIterator node_iter = this->mpCellPopulation->rGetMesh().GetNodeIteratorBegin();
+             node_iter != this->mpCellPopulation->rGetMesh().GetNodeIteratorEnd();
+             ++node_iter, ++damping_index)
+        {
+            damping[damping_index] = this->mpCellPopulation->GetDampingConstant(node_iter->GetIndex());
+        }
+
+        // Newton's method, starting from the current locations
+        std::vector<c_vector<double, SPACE_DIM> > locations = initial_locations;
+        std::vector<c_vector<double, SPACE_DIM> > forces = this->ComputeForcesIncludingDamping();
+
+        for (unsigned newton_iter=0; newton_iter<mMaxNewtonIterations; newton_iter++)
+        {
+            if (newton_iter > 0)
+            {
+                forces = ComputeForcesAtLocations(locations, old_node_locations);
+            }
+
+            // Right-hand side b = -(r - r^t - dt F(r))
+            std::vector<c_vector<double, SPACE_DIM> > rhs(num_nodes);
+            double rhs_norm = 0.0;
+            double location_norm = 0.0;
+            for (unsigned i=0; i<num_nodes; i++)
+            {
+                rhs[i] = initial_locations[i] - locations[i] + dt*forces[i];
+                rhs_norm += inner_prod(rhs[i], rhs[i]);
+                location_norm += inner_prod(locations[i], locations[i]);
+            }
+            rhs_norm = sqrt(rhs_norm);
+            location_norm = sqrt(location_norm);
+
+            if (rhs_norm <= DBL_EPSILON*(1.0 + initial_norm))
+            {
+                break;
+            }
+
+            /*
+             * Solve (I - dt J) delta = b, where J is the Jacobian of the damped forces F/eta.
+             * When the damping constants differ between nodes this matrix is not symmetric,
+             * so we multiply through by the diagonal matrix D of damping constants and solve
+             * (D - dt K) delta = D b by the conjugate gradient method, starting from delta = 0,
+             * where K is the Jacobian of the undamped forces. For forces derived from a
+             * potential, K is symmetric and hence so is D - dt K.
+             */
+            std::vector<c_vector<double, SPACE_DIM> > delta(num_nodes, zero_vector<double>(SPACE_DIM));
+            std::vector<c_vector<double, SPACE_DIM> > residual(num_nodes);
+            std::vector<c_vector<double, SPACE_DIM> > perturbed_locations(num_nodes);
+            std::vector<c_vector<double, SPACE_DIM> > product(num_nodes);
+            double residual_squared = 0.0;
+            for (unsigned i=0; i<num_nodes; i++)
+            {
+                residual[i] = damping[i]*rhs[i];
+                residual_squared += inner_prod(residual[i], residual[i]);
+            }
+            std::vector<c_vector<double, SPACE_DIM> > direction = residual;
+            double scaled_rhs_norm = sqrt(residual_squared);
+
+            for (unsigned linear_iter=0; linear_iter<mMaxLinearIterations; linear_iter++)
+            {
+                // Approximate K p by a finite difference about the current Newton iterate
+                double direction_norm = 0.0;
+                for (unsigned i=0; i<num_nodes; i++)
+                {
+                    direction_norm += inner_prod(direction[i], direction[i]);
+                }
+                direction_norm = sqrt(direction_norm);
+                double epsilon = sqrt(DBL_EPSILON)*(1.0 + location_norm)/direction_norm;
+
+                for (unsigned i=0; i<num_nodes; i++)
+                {
+                    perturbed_locations[i] = locations[i] + epsilon*direction[i];
+                }
+                std::vector<c_vector<double, SPACE_DIM> > perturbed_forces = ComputeForcesAtLocations(perturbed_locations, old_node_locations);
+
+                double curvature = 0.0;
+                for (unsigned i=0; i<num_nodes; i++)
+                {
+                    product[i] = damping[i]*(direction[i] - dt*(perturbed_forces[i] - forces[i])/epsilon);
+                    curvature += inner_prod(direction[i], product[i]);
+                }
+
+                if (curvature <= 0.0)
+                {
+                    /*
+                     * The system is not positive definite along this direction. Keep the current
+                     * iterate, unless no progress has yet been made, in which case use delta = b:
+                     * in the first Newton iteration this is the forward Euler step.
+                     */
+                    if (linear_iter == 0)
+                    {
+                        delta = rhs;
+                    }
+                    break;
+                }
+
+                double alpha = residual_squared/curvature;
+                double new_residual_squared = 0.0;
+                for (unsigned i=0; i<num_nodes; i++)
+                {
+                    delta[i] += alpha*direction[i];
+                    residual[i] -= alpha*product[i];
+                    new_residual_squared += inner_prod(residual[i], residual[i]);
+                }
+
+                if (sqrt(new_residual_squared) <= mLinearSolverRelativeTolerance*scaled_rhs_norm)
+                {
+                    break;
+                }
+
+                double beta = new_residual_squared/residual_squared;
+                for (unsigned i=0; i<num_nodes; i++)
+                {
+                    direction[i] = residual[i] + beta*direction[i];
+                }
+                residual_squared = new_residual_squared;
+            }
+
+            for (unsigned i=0; i<num_nodes; i++)
+            {
+                locations[i] += delta[i];
+            }
+        }
+
+        // Return the nodes to their initial locations before making the step
+        this->SetCurrentLocations(initial_locations);
+
+        unsigned index = 0;
+        for (typename AbstractMesh<ELEMENT_DIM, SPACE_DIM>::NodeIterator node_iter = this->mpCellPopulation->rGetMesh().GetNodeIteratorBegin();
+             node_iter != this->mpCellPopulation->rGetMesh().GetNodeIteratorEnd();
+             ++node_iter, ++index)
+        {
+            c_vector<double, SPACE_DIM> displacement = locations[index] - initial_locations[index];
+
+            // In the vertex-based case, the displacement may be scaled if the cell rearrangement threshold is exceeded
+            this->DetectStepSizeExceptions(node_iter->GetIndex(), displacement, dt);
+
+            c_vector<double, SPACE_DIM> new_location = initial_locations[index] + displacement;
+            this->SafeNodePositionUpdate(node_iter->GetIndex(), new_location);
+        }
+    }
+    else
+    {
+        /*
+         * If this type of cell population does not support the new numerical methods, delegate
+         * updating node positions to the population itself.
+         *
+         * This only applies to NodeBasedCellPopulationWithBuskeUpdates.
+         */
+        this->mpCellPopulation->UpdateNodeLocations(dt);
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned BackwardEulerNumericalMethod<ELEMENT_DIM,SPACE_DIM>::GetMaxNewtonIterations()
+{
+    return mMaxNewtonIterations;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void BackwardEulerNumericalMethod<ELEMENT_DIM,SPACE_DIM>::SetMaxNewtonIterations(unsigned maxNewtonIterations)
+{
+    mMaxNewtonIterations = maxNewtonIterations;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned BackwardEulerNumericalMethod<ELEMENT_DIM,SPACE_DIM>::GetMaxLinearIterations()
+{
+    return mMaxLinearIterations;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void BackwardEulerNumericalMethod<ELEMENT_DIM,SPACE_DIM>::SetMaxLinearIterations(unsigned maxLinearIterations)
+{
+    mMaxLinearIterations = maxLinearIterations;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+double BackwardEulerNumericalMethod<ELEMENT_DIM,SPACE_DIM>::GetLinearSolverRelativeTolerance()
+{
+    return mLinearSolverRelativeTolerance;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void BackwardEulerNumericalMethod<ELEMENT_DIM,SPACE_DIM>::SetLinearSolverRelativeTolerance(double linearSolverRelativeTolerance)
+{
+    if (linearSolverRelativeTolerance <= 0.0)
+    {
+        EXCEPTION("The linear solver relative tolerance must be positive");
+    }
+    mLinearSolverRelativeTolerance = linearSolverRelativeTolerance;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void BackwardEulerNumericalMethod<ELEMENT_DIM, SPACE_DIM>::OutputNumericalMethodParameters(out_stream& rParamsFile)
+{
+    *rParamsFile << "\t\t\t<MaxNewtonIterations>" << mMaxNewtonIterations << "</MaxNewtonIterations> \n";
+    *rParamsFile << "\t\t\t<MaxLinearIterations>" << mMaxLinearIterations << "</MaxLinearIterations> \n";
+    *rParamsFile << "\t\t\t<LinearSolverRelativeTolerance>" << mLinearSolverRelativeTolerance << "</LinearSolverRelativeTolerance> \n";
+
+    // Call method on direct parent class
+    AbstractNumericalMethod<ELEMENT_DIM,SPACE_DIM>::OutputNumericalMethodParameters(rParamsFile);
+}
+
+// Explicit instantiation
+template class BackwardEulerNumericalMethod<1,1>;
+template class BackwardEulerNumericalMethod<1,2>;
+template class BackwardEulerNumericalMethod<2,2>;
+template class BackwardEulerNumericalMethod<1,3>;
+template class BackwardEulerNumericalMethod<2,3>;
+template class BackwardEulerNumericalMethod<3,3>;
+
+// Serialization for Boost >= 1.36
+#include "SerializationExportWrapperForCpp.hpp"
+EXPORT_TEMPLATE_CLASS_ALL_DIMS(BackwardEulerNumericalMethod)
@@ -0,0 +1,174 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BACKWARDEULERNUMERICALMETHOD_HPP_
+#define BACKWARDEULERNUMERICALMETHOD_HPP_
+
+#include "ChasteSerialization.hpp"
+#include <boost/serialization/base_object.hpp>
+
+#include "AbstractNumericalMethod.hpp"
+
+/**
+ * Implements the backward Euler method, r^(t+1) = r^t + dt F(r^(t+1)), which remains stable
+ * for stiff force laws at step sizes where explicit methods fail.
+ *
+ * The implicit equations are solved by Newton's method. Each Newton update solves the linear
+ * system (I - dt J) delta = -(r - r^t - dt F(r)), where J is the Jacobian of the force (including
+ * damping) with respect to all node locations. The Jacobian is never assembled: the system is
+ * solved by the conjugate gradient method, with each product Jv approximated by the finite
+ * difference (F(r + eps v) - F(r))/eps.
+ *
+ * By default a single Newton iteration is taken, giving the linearly implicit (semi-implicit)
+ * Euler method, which is exact for forces that depend linearly on node locations.
+ *
+ * Since J includes the damping constants of the nodes, I - dt J is not symmetric when these
+ * differ. The system is therefore multiplied through by the diagonal matrix of damping constants
+ * before the conjugate gradient method is applied; the resulting matrix is symmetric for forces
+ * derived from a potential. If it is not positive definite along a search direction then the
+ * current iterate is used as the Newton update, or, if this is still zero, the right-hand side
+ * (in the first Newton iteration, the forward Euler step).
+ */
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM=ELEMENT_DIM>
+class BackwardEulerNumericalMethod : public AbstractNumericalMethod<ELEMENT_DIM,SPACE_DIM> {
+
+private:
+
+    /** Needed for serialization. */
+    friend class boost::serialization::access;
+
+    /**
+     * Save or restore the simulation.
+     *
+     * @param archive the archive
+     * @param version the current version of this class
+     */
+    template<class Archive>
+    void serialize(Archive & archive, const unsigned int version)
+    {
+        archive & boost::serialization::base_object<AbstractNumericalMethod<ELEMENT_DIM,SPACE_DIM> >(*this);
+        archive & mMaxNewtonIterations;
+        archive & mMaxLinearIterations;
+        archive & mLinearSolverRelativeTolerance;
+    }
+
+    /** The maximum number of Newton iterations per step. Initialised to 1 in the constructor. */
+    unsigned mMaxNewtonIterations;
+
+    /** The maximum number of conjugate gradient iterations per Newton iteration. Initialised to 20 in the constructor. */
+    unsigned mMaxLinearIterations;
+
+    /** The relative residual at which the conjugate gradient method stops. Initialised to 1e-6 in the constructor. */
+    double mLinearSolverRelativeTolerance;
+
+    /**
+     * Move the nodes to the given locations, impose any boundary conditions and compute the
+     * resulting force on each node, including damping.
+     *
+     * @param rLocations the locations of the nodes, in the order given by the node iterator
+     * @param rOldNodeLocations the locations of the nodes at the start of the step
+     * @return the force on each node, divided by its damping constant
+     */
+    std::vector<c_vector<double, SPACE_DIM> > ComputeForcesAtLocations(const std::vector<c_vector<double, SPACE_DIM> >& rLocations,
+                                                                       std::map<Node<SPACE_DIM>*, c_vector<double, SPACE_DIM> >& rOldNodeLocations);
+
+public:
+
+    /**
+     * Constructor.
+     */
+    BackwardEulerNumericalMethod();
+
+    /**
+     * Destructor.
+     */
+    virtual ~BackwardEulerNumericalMethod();
+
+    /**
+     * Overridden UpdateAllNodePositions() method.
+     *
+     * @param dt Time step size
+     */
+    void UpdateAllNodePositions(double dt);
+
+    /**
+     * @return mMaxNewtonIterations
+     */
+    unsigned GetMaxNewtonIterations();
+
+    /**
+     * Set mMaxNewtonIterations.
+     *
+     * @param maxNewtonIterations the new value of mMaxNewtonIterations
+     */
+    void SetMaxNewtonIterations(unsigned maxNewtonIterations);
+
+    /**
+     * @return mMaxLinearIterations
+     */
+    unsigned GetMaxLinearIterations();
+
+    /**
+     * Set mMaxLinearIterations.
+     *
+     * @param maxLinearIterations the new value of mMaxLinearIterations
+     */
+    void SetMaxLinearIterations(unsigned maxLinearIterations);
+
+    /**
+     * @return mLinearSolverRelativeTolerance
+     */
+    double GetLinearSolverRelativeTolerance();
+
+    /**
+     * Set mLinearSolverRelativeTolerance.
+     *
+     * @param linearSolverRelativeTolerance the new value of mLinearSolverRelativeTolerance
+     */
+    void SetLinearSolverRelativeTolerance(double linearSolverRelativeTolerance);
+
+    /**
+     * Overridden OutputNumericalMethodParameters() method.
+     *
+     * @param rParamsFile Reference to the parameter output filestream
+     */
+    virtual void OutputNumericalMethodParameters(out_stream& rParamsFile);
+};
+
+// Serialization for Boost >= 1.36
+#include "SerializationExportWrapper.hpp"
+EXPORT_TEMPLATE_CLASS_ALL_DIMS(BackwardEulerNumericalMethod)
+
+#endif /*BACKWARDEULERNUMERICALMETHOD_HPP_*/
@@ -0,0 +1,182 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "RK23NumericalMethod.hpp"
+#include "StepSizeException.hpp"
+#include "Exception.hpp"
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+RK23NumericalMethod<ELEMENT_DIM,SPACE_DIM>::RK23NumericalMethod()
+    : AbstractNumericalMethod<ELEMENT_DIM,SPACE_DIM>(),
+      mAbsoluteTolerance(1e-3)
+{
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+RK23NumericalMethod<ELEMENT_DIM,SPACE_DIM>::~RK23NumericalMethod()
+{
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void RK23NumericalMethod<ELEMENT_DIM,SPACE_DIM>::UpdateAllNodePositions(double dt)
+{
+    if (!this->mUseUpdateNodeLocation)
+    {
+        std::map<Node<SPACE_DIM>*, c_vector<double, SPACE_DIM> > old_node_locations = this->SaveCurrentNodeLocations();
+        std::vector<c_vector<double, SPACE_DIM> > initial_locations = this->SaveCurrentLocations();
+        unsigned num_nodes = initial_locations.size();
+
+        // First stage
+        std::vector<c_vector<double, SPACE_DIM> > k1 = this->ComputeForcesIncludingDamping();
+
+        // Second stage
+        std::vector<c_vector<double, SPACE_DIM> > stage_locations(num_nodes);
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            stage_locations[i] = initial_locations[i] + 0.5*dt*k1[i];
+        }
+        this->SetCurrentLocations(stage_locations);
+        this->ImposeBoundaryConditions(old_node_locations);
+        std::vector<c_vector<double, SPACE_DIM> > k2 = this->ComputeForcesIncludingDamping();
+
+        // Third stage
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            stage_locations[i] = initial_locations[i] + 0.75*dt*k2[i];
+        }
+        this->SetCurrentLocations(stage_locations);
+        this->ImposeBoundaryConditions(old_node_locations);
+        std::vector<c_vector<double, SPACE_DIM> > k3 = this->ComputeForcesIncludingDamping();
+
+        // Third-order solution
+        std::vector<c_vector<double, SPACE_DIM> > displacements(num_nodes);
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            displacements[i] = dt*((2.0/9.0)*k1[i] + (1.0/3.0)*k2[i] + (4.0/9.0)*k3[i]);
+        }
+
+        if (this->mUseAdaptiveTimestep)
+        {
+            // Estimate the local error using the embedded second-order solution
+            for (unsigned i=0; i<num_nodes; i++)
+            {
+                stage_locations[i] = initial_locations[i] + displacements[i];
+            }
+            this->SetCurrentLocations(stage_locations);
+            this->ImposeBoundaryConditions(old_node_locations);
+            std::vector<c_vector<double, SPACE_DIM> > k4 = this->ComputeForcesIncludingDamping();
+
+            double error = 0.0;
+            for (unsigned i=0; i<num_nodes; i++)
+            {
+                c_vector<double, SPACE_DIM> difference = dt*((-5.0/72.0)*k1[i] + (1.0/12.0)*k2[i] + (1.0/9.0)*k3[i] - 0.125*k4[i]);
+                error = std::max(error, norm_2(difference));
+            }
+
+            if (error > mAbsoluteTolerance)
+            {
+                std::ostringstream message;
+                message << "The estimated local error " << error << " exceeds the absolute tolerance " << mAbsoluteTolerance;
+                message << ": use a smaller timestep to avoid this exception.";
+
+                // The local error scales with dt^3, so suggest a step that should just satisfy the tolerance
+                double new_step = dt*std::max(0.2, 0.9*pow(mAbsoluteTolerance/error, 1.0/3.0));
+                throw StepSizeException(new_step, message.str(), false);
+            }
+        }
+
+        // Return the nodes to their initial locations before making the step
+        this->SetCurrentLocations(initial_locations);
+
+        unsigned index = 0;
+        for (typename AbstractMesh<ELEMENT_DIM, SPACE_DIM>::NodeIterator node_iter = this->mpCellPopulation->rGetMesh().GetNodeIteratorBegin();
+             node_iter != this->mpCellPopulation->rGetMesh().GetNodeIteratorEnd();
+             ++node_iter, ++index)
+        {
+            // In the vertex-based case, the displacement may be scaled if the cell rearrangement threshold is exceeded
+            this->DetectStepSizeExceptions(node_iter->GetIndex(), displacements[index], dt);
+
+            c_vector<double, SPACE_DIM> new_location = initial_locations[index] + displacements[index];
+            this->SafeNodePositionUpdate(node_iter->GetIndex(), new_location);
+        }
+    }
+    else
+    {
+        /*
+         * If this type of cell population does not support the new numerical methods, delegate
+         * updating node positions to the population itself.
+         *
+         * This only applies to NodeBasedCellPopulationWithBuskeUpdates.
+         */
+        this->mpCellPopulation->UpdateNodeLocations(dt);
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+double RK23NumericalMethod<ELEMENT_DIM,SPACE_DIM>::GetAbsoluteTolerance()
+{
+    return mAbsoluteTolerance;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void RK23NumericalMethod<ELEMENT_DIM,SPACE_DIM>::SetAbsoluteTolerance(double absoluteTolerance)
+{
+    if (absoluteTolerance <= 0.0)
+    {
+        EXCEPTION("The absolute tolerance must be positive");
+    }
+    mAbsoluteTolerance = absoluteTolerance;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void RK23NumericalMethod<ELEMENT_DIM, SPACE_DIM>::OutputNumericalMethodParameters(out_stream& rParamsFile)
+{
+    *rParamsFile << "\t\t\t<AbsoluteTolerance>" << mAbsoluteTolerance << "</AbsoluteTolerance> \n";
+
+    // Call method on direct parent class
+    AbstractNumericalMethod<ELEMENT_DIM,SPACE_DIM>::OutputNumericalMethodParameters(rParamsFile);
+}
+
+// Explicit instantiation
+template class RK23NumericalMethod<1,1>;
+template class RK23NumericalMethod<1,2>;
+template class RK23NumericalMethod<2,2>;
+template class RK23NumericalMethod<1,3>;
+template class RK23NumericalMethod<2,3>;
+template class RK23NumericalMethod<3,3>;
+
+// Serialization for Boost >= 1.36
+#include "SerializationExportWrapperForCpp.hpp"
+EXPORT_TEMPLATE_CLASS_ALL_DIMS(RK23NumericalMethod)
@@ -0,0 +1,134 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef RK23NUMERICALMETHOD_HPP_
+#define RK23NUMERICALMETHOD_HPP_
+
+#include "ChasteSerialization.hpp"
+#include <boost/serialization/base_object.hpp>
+
+#include "AbstractNumericalMethod.hpp"
+
+/**
+ * Implements the third-order Runge-Kutta method of Bogacki and Shampine, with an embedded
+ * second-order method for error control.
+ *
+ * Solves the equations of motion dr/dt = F using the scheme
+ *
+ * k1 = F(r^t),
+ * k2 = F(r^t + dt k1/2),
+ * k3 = F(r^t + 3 dt k2/4),
+ * r^(t+1) = r^t + dt (2 k1 + 3 k2 + 4 k3)/9.
+ *
+ * If an adaptive time step is used (see SetUseAdaptiveTimestep()), then the force is also
+ * evaluated at r^(t+1) and used to form the embedded second-order solution
+ *
+ * s^(t+1) = r^t + dt (7 k1/24 + k2/4 + k3/3 + F(r^(t+1))/8).
+ *
+ * The largest distance between r^(t+1) and s^(t+1) over all nodes estimates the local error of
+ * the step. If it exceeds mAbsoluteTolerance, then the step is rejected by throwing a non-terminal
+ * StepSizeException that suggests a smaller step, which OffLatticeSimulation uses to retry.
+ */
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM=ELEMENT_DIM>
+class RK23NumericalMethod : public AbstractNumericalMethod<ELEMENT_DIM,SPACE_DIM> {
+
+private:
+
+    /** Needed for serialization. */
+    friend class boost::serialization::access;
+
+    /**
+     * Save or restore the simulation.
+     *
+     * @param archive the archive
+     * @param version the current version of this class
+     */
+    template<class Archive>
+    void serialize(Archive & archive, const unsigned int version)
+    {
+        archive & boost::serialization::base_object<AbstractNumericalMethod<ELEMENT_DIM,SPACE_DIM> >(*this);
+        archive & mAbsoluteTolerance;
+    }
+
+    /**
+     * The largest local error in the position of any node that is accepted in a single step,
+     * when an adaptive time step is used. Initialised to 1e-3 in the constructor.
+     */
+    double mAbsoluteTolerance;
+
+public:
+
+    /**
+     * Constructor.
+     */
+    RK23NumericalMethod();
+
+    /**
+     * Destructor.
+     */
+    virtual ~RK23NumericalMethod();
+
+    /**
+     * Overridden UpdateAllNodePositions() method.
+     *
+     * @param dt Time step size
+     */
+    void UpdateAllNodePositions(double dt);
+
+    /**
+     * @return mAbsoluteTolerance
+     */
+    double GetAbsoluteTolerance();
+
+    /**
+     * Set mAbsoluteTolerance.
+     *
+     * @param absoluteTolerance the new value of mAbsoluteTolerance
+     */
+    void SetAbsoluteTolerance(double absoluteTolerance);
+
+    /**
+     * Overridden OutputNumericalMethodParameters() method.
+     *
+     * @param rParamsFile Reference to the parameter output filestream
+     */
+    virtual void OutputNumericalMethodParameters(out_stream& rParamsFile);
+};
+
+// Serialization for Boost >= 1.36
+#include "SerializationExportWrapper.hpp"
+EXPORT_TEMPLATE_CLASS_ALL_DIMS(RK23NumericalMethod)
+
+#endif /*RK23NUMERICALMETHOD_HPP_*/
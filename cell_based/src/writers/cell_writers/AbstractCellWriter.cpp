@@ -86,6 +86,47 @@ c_vector<double, SPACE_DIM> AbstractCellWriter<ELEMENT_DIM, SPACE_DIM>::GetVecto
     return scalar_vector<double>(SPACE_DIM, DOUBLE_UNSET);
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+std::vector<std::string> AbstractCellWriter<ELEMENT_DIM, SPACE_DIM>::GetColumnNames()
+{
+    const char* component_suffixes[3] = {"_x", "_y", "_z"};
+
+    std::vector<std::string> column_names;
+    if (mOutputScalarData)
+    {
+        column_names.push_back(mVtkCellDataName);
+    }
+    if (mOutputVectorData)
+    {
+        for (unsigned i=0; i<SPACE_DIM; i++)
+        {
+            column_names.push_back(mVtkVectorCellDataName + component_suffixes[i]);
+        }
+    }
+    return column_names;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractCellWriter<ELEMENT_DIM, SPACE_DIM>::GetColumnDataForCell(CellPtr pCell,
+                                                                      AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                                                                      std::vector<double>& rValues)
+{
+    unsigned column = 0;
+    if (mOutputScalarData)
+    {
+        rValues[column++] = GetCellDataForVtkOutput(pCell, pCellPopulation);
+    }
+    if (mOutputVectorData)
+    {
+        c_vector<double, SPACE_DIM> data = GetVectorCellDataForVtkOutput(pCell, pCellPopulation);
+        for (unsigned i=0; i<SPACE_DIM; i++)
+        {
+            rValues[column++] = data[i];
+        }
+    }
+    assert(column == rValues.size());
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 std::string AbstractCellWriter<ELEMENT_DIM, SPACE_DIM>::GetVtkCellDataName()
 {
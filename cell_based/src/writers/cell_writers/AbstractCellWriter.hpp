@@ -120,6 +120,33 @@ public:
      */
     virtual c_vector<double, SPACE_DIM> GetVectorCellDataForVtkOutput(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation);
 
+    /**
+     * Get the names of the columns of data written for each cell when the output of the
+     * cell writers is stored in columns (see BinaryCellColumnWriter).
+     *
+     * By default this is the VTK scalar data name, if mOutputScalarData is true, followed by
+     * the VTK vector data name with suffixes "_x", "_y", "_z", if mOutputVectorData is true.
+     * Subclasses whose data are not given by GetCellDataForVtkOutput() and
+     * GetVectorCellDataForVtkOutput() should override this method and GetColumnDataForCell(),
+     * or throw an exception here if their data cannot be stored in a fixed number of columns.
+     *
+     * @return the column names
+     */
+    virtual std::vector<std::string> GetColumnNames();
+
+    /**
+     * Get the values of the columns named by GetColumnNames() for a cell.
+     *
+     * By default these are given by GetCellDataForVtkOutput() and GetVectorCellDataForVtkOutput().
+     *
+     * @param pCell a cell
+     * @param pCellPopulation a pointer to the cell population owning the cell
+     * @param rValues filled in with the values; has the size of GetColumnNames() on entry
+     */
+    virtual void GetColumnDataForCell(CellPtr pCell,
+                                      AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                                      std::vector<double>& rValues);
+
     /**
      * Visit a cell and write its data.
      *
@@ -0,0 +1,171 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "BinaryCellColumnReader.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include "Exception.hpp"
+
+BinaryCellColumnReader::BinaryCellColumnReader(const FileFinder& rFileFinder)
+    : mFilePath(rFileFinder.GetAbsolutePath())
+{
+    std::ifstream file(mFilePath.c_str(), std::ios::in | std::ios::binary);
+    if (!file.is_open())
+    {
+        EXCEPTION("Could not open file " + mFilePath);
+    }
+
+    // Parse the header
+    std::string header_line;
+    std::getline(file, header_line);
+    std::stringstream header_stream(header_line);
+    std::string magic, endianness;
+    unsigned format_version = 0;
+    unsigned num_columns = 0;
+    header_stream >> magic >> format_version >> endianness >> num_columns;
+    if (header_stream.fail() || magic != "CHASTE_CELL_COLUMNS" || format_version != 1u)
+    {
+        EXCEPTION("File " + mFilePath + " is not a binary cell column file");
+    }
+
+    const unsigned endian_test = 1;
+    bool is_little_endian = (*reinterpret_cast<const char*>(&endian_test) == 1);
+    if (endianness != (is_little_endian ? "LittleEndian" : "BigEndian"))
+    {
+        EXCEPTION("File " + mFilePath + " was written with a different endianness");
+    }
+
+    mColumnNames.resize(num_columns);
+    for (unsigned i=0; i<num_columns; i++)
+    {
+        std::getline(file, mColumnNames[i]);
+    }
+    if (file.fail())
+    {
+        EXCEPTION("File " + mFilePath + " has an incomplete header");
+    }
+
+    // Index the chunks
+    std::streamoff offset = file.tellg();
+    file.seekg(0, std::ios::end);
+    const std::streamoff file_size = file.tellg();
+    const std::streamoff chunk_header_size = sizeof(double) + sizeof(boost::uint32_t);
+
+    while (offset + chunk_header_size <= file_size)
+    {
+        double time;
+        boost::uint32_t num_cells;
+        file.seekg(offset);
+        file.read(reinterpret_cast<char*>(&time), sizeof(double));
+        file.read(reinterpret_cast<char*>(&num_cells), sizeof(boost::uint32_t));
+
+        std::streamoff chunk_size = chunk_header_size
+                                    + std::streamoff(num_cells)*(sizeof(boost::uint32_t) + num_columns*sizeof(double));
+        if (offset + chunk_size > file_size)
+        {
+            EXCEPTION("File " + mFilePath + " ends with an incomplete time step");
+        }
+
+        if (mTimes.empty() || mTimes.back() != time)
+        {
+            mTimes.push_back(time);
+            mChunks.push_back(std::vector<std::pair<std::streamoff, unsigned> >());
+        }
+        mChunks.back().push_back(std::make_pair(offset + chunk_header_size, unsigned(num_cells)));
+
+        offset += chunk_size;
+    }
+    if (offset != file_size)
+    {
+        EXCEPTION("File " + mFilePath + " ends with an incomplete time step");
+    }
+}
+
+const std::vector<std::string>& BinaryCellColumnReader::rGetColumnNames() const
+{
+    return mColumnNames;
+}
+
+unsigned BinaryCellColumnReader::GetNumTimeSteps() const
+{
+    return mTimes.size();
+}
+
+const std::vector<double>& BinaryCellColumnReader::rGetTimes() const
+{
+    return mTimes;
+}
+
+void BinaryCellColumnReader::ReadTimeStep(unsigned timeStep,
+                                          std::vector<unsigned>& rCellIds,
+                                          std::vector<std::vector<double> >& rColumns) const
+{
+    if (timeStep >= mTimes.size())
+    {
+        EXCEPTION("Time step index out of range");
+    }
+
+    const unsigned num_columns = mColumnNames.size();
+    rCellIds.clear();
+    rColumns.assign(num_columns, std::vector<double>());
+
+    std::ifstream file(mFilePath.c_str(), std::ios::in | std::ios::binary);
+    std::vector<boost::uint32_t> ids;
+    std::vector<double> values;
+
+    const std::vector<std::pair<std::streamoff, unsigned> >& r_chunks = mChunks[timeStep];
+    for (unsigned chunk=0; chunk<r_chunks.size(); chunk++)
+    {
+        const unsigned num_cells = r_chunks[chunk].second;
+        if (num_cells == 0)
+        {
+            continue;
+        }
+        ids.resize(num_cells);
+        values.resize(num_cells*num_columns);
+
+        file.seekg(r_chunks[chunk].first);
+        file.read(reinterpret_cast<char*>(&ids[0]), num_cells*sizeof(boost::uint32_t));
+        file.read(reinterpret_cast<char*>(&values[0]), num_cells*num_columns*sizeof(double));
+
+        rCellIds.insert(rCellIds.end(), ids.begin(), ids.end());
+        for (unsigned i=0; i<num_columns; i++)
+        {
+            rColumns[i].insert(rColumns[i].end(), values.begin() + i*num_cells, values.begin() + (i+1)*num_cells);
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BINARYCELLCOLUMNREADER_HPP_
+#define BINARYCELLCOLUMNREADER_HPP_
+
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+
+#include "FileFinder.hpp"
+
+/**
+ * A reader for files written by BinaryCellColumnWriter.
+ *
+ * On construction the header is parsed and the chunks are indexed by output time, so
+ * that the data for any output time may then be read without reading the rest of the file.
+ * Consecutive chunks with the same time (written by different processes) are treated
+ * as a single time step.
+ */
+class BinaryCellColumnReader
+{
+private:
+
+    /** The full path of the file being read. */
+    std::string mFilePath;
+
+    /** The names of the columns. */
+    std::vector<std::string> mColumnNames;
+
+    /** The output times. */
+    std::vector<double> mTimes;
+
+    /** For each output time, the file offset and number of cells of each chunk written at that time. */
+    std::vector<std::vector<std::pair<std::streamoff, unsigned> > > mChunks;
+
+public:
+
+    /**
+     * Constructor. Reads the header of the file and indexes its chunks.
+     *
+     * @param rFileFinder the file to read
+     */
+    BinaryCellColumnReader(const FileFinder& rFileFinder);
+
+    /**
+     * @return the names of the columns.
+     */
+    const std::vector<std::string>& rGetColumnNames() const;
+
+    /**
+     * @return the number of output times in the file.
+     */
+    unsigned GetNumTimeSteps() const;
+
+    /**
+     * @return the output times in the file.
+     */
+    const std::vector<double>& rGetTimes() const;
+
+    /**
+     * Read the data written at a given output time.
+     *
+     * @param timeStep the index of the output time
+     * @param rCellIds filled in with the ID of each cell
+     * @param rColumns filled in with the values of each column, in the same cell order as rCellIds
+     */
+    void ReadTimeStep(unsigned timeStep,
+                      std::vector<unsigned>& rCellIds,
+                      std::vector<std::vector<double> >& rColumns) const;
+};
+
+#endif /*BINARYCELLCOLUMNREADER_HPP_*/
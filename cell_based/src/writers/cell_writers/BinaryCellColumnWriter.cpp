@@ -0,0 +1,178 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "BinaryCellColumnWriter.hpp"
+#include "AbstractCellPopulation.hpp"
+#include "PetscTools.hpp"
+#include "SimulationTime.hpp"
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+BinaryCellColumnWriter<ELEMENT_DIM, SPACE_DIM>::BinaryCellColumnWriter(const std::string& rFileName)
+    : mFileName(rFileName)
+{
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void BinaryCellColumnWriter<ELEMENT_DIM, SPACE_DIM>::OpenOutputFile(OutputFileHandler& rOutputFileHandler,
+                                                                    const std::vector<boost::shared_ptr<AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> > >& rCellWriters)
+{
+    const char* axis_names[3] = {"x", "y", "z"};
+
+    mColumnNames.clear();
+    mNumWriterColumns.clear();
+    for (unsigned i=0; i<SPACE_DIM; i++)
+    {
+        mColumnNames.push_back(axis_names[i]);
+    }
+    for (unsigned writer_index=0; writer_index<rCellWriters.size(); writer_index++)
+    {
+        std::vector<std::string> writer_column_names = rCellWriters[writer_index]->GetColumnNames();
+        mColumnNames.insert(mColumnNames.end(), writer_column_names.begin(), writer_column_names.end());
+        mNumWriterColumns.push_back(writer_column_names.size());
+    }
+
+    // Only the master process creates the file, so that the header is not truncated by other processes
+    if (PetscTools::AmMaster())
+    {
+        mpOutStream = rOutputFileHandler.OpenOutputFile(mFileName, std::ios::out | std::ios::trunc | std::ios::binary);
+
+        const unsigned endian_test = 1;
+        bool is_little_endian = (*reinterpret_cast<const char*>(&endian_test) == 1);
+
+        *mpOutStream << "CHASTE_CELL_COLUMNS 1 " << (is_little_endian ? "LittleEndian" : "BigEndian") << " " << mColumnNames.size() << "\n";
+        for (unsigned i=0; i<mColumnNames.size(); i++)
+        {
+            *mpOutStream << mColumnNames[i] << "\n";
+        }
+        CloseFile();
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void BinaryCellColumnWriter<ELEMENT_DIM, SPACE_DIM>::OpenOutputFileForAppend(OutputFileHandler& rOutputFileHandler)
+{
+    mpOutStream = rOutputFileHandler.OpenOutputFile(mFileName, std::ios::out | std::ios::app | std::ios::binary);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void BinaryCellColumnWriter<ELEMENT_DIM, SPACE_DIM>::CloseFile()
+{
+    if (mpOutStream)
+    {
+        mpOutStream->close();
+        mpOutStream.reset();
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void BinaryCellColumnWriter<ELEMENT_DIM, SPACE_DIM>::WriteTimeStep(AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                                                                   const std::vector<boost::shared_ptr<AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> > >& rCellWriters)
+{
+    assert(mpOutStream);
+
+    // Gather the cells on this process, so that each column may be filled in turn
+    std::vector<CellPtr> cells;
+    for (typename AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::Iterator cell_iter = pCellPopulation->Begin();
+         cell_iter != pCellPopulation->End();
+         ++cell_iter)
+    {
+        cells.push_back(*cell_iter);
+    }
+    const unsigned num_cells = cells.size();
+    const unsigned num_columns = mColumnNames.size();
+
+    mCellIds.resize(num_cells);
+    mValues.resize(num_columns*num_cells);
+
+    for (unsigned cell_index=0; cell_index<num_cells; cell_index++)
+    {
+        mCellIds[cell_index] = cells[cell_index]->GetCellId();
+        c_vector<double, SPACE_DIM> cell_location = pCellPopulation->GetLocationOfCellCentre(cells[cell_index]);
+        for (unsigned i=0; i<SPACE_DIM; i++)
+        {
+            mValues[i*num_cells + cell_index] = cell_location[i];
+        }
+    }
+
+    assert(mNumWriterColumns.size() == rCellWriters.size());
+    unsigned column = SPACE_DIM;
+    std::vector<double> cell_values;
+    for (unsigned writer_index=0; writer_index<rCellWriters.size(); writer_index++)
+    {
+        AbstractCellWriter<ELEMENT_DIM, SPACE_DIM>* p_writer = rCellWriters[writer_index].get();
+        const unsigned num_writer_columns = mNumWriterColumns[writer_index];
+        cell_values.resize(num_writer_columns);
+        for (unsigned cell_index=0; cell_index<num_cells; cell_index++)
+        {
+            p_writer->GetColumnDataForCell(cells[cell_index], pCellPopulation, cell_values);
+            for (unsigned i=0; i<num_writer_columns; i++)
+            {
+                mValues[(column + i)*num_cells + cell_index] = cell_values[i];
+            }
+        }
+        column += num_writer_columns;
+    }
+    assert(column == num_columns);
+
+    double time = SimulationTime::Instance()->GetTime();
+    boost::uint32_t num_cells_in_chunk = num_cells;
+    mpOutStream->write(reinterpret_cast<const char*>(&time), sizeof(double));
+    mpOutStream->write(reinterpret_cast<const char*>(&num_cells_in_chunk), sizeof(boost::uint32_t));
+    if (num_cells > 0)
+    {
+        mpOutStream->write(reinterpret_cast<const char*>(&mCellIds[0]), num_cells*sizeof(boost::uint32_t));
+        mpOutStream->write(reinterpret_cast<const char*>(&mValues[0]), num_columns*num_cells*sizeof(double));
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+const std::vector<std::string>& BinaryCellColumnWriter<ELEMENT_DIM, SPACE_DIM>::rGetColumnNames() const
+{
+    return mColumnNames;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+std::string BinaryCellColumnWriter<ELEMENT_DIM, SPACE_DIM>::GetFileName() const
+{
+    return mFileName;
+}
+
+// Explicit instantiation
+template class BinaryCellColumnWriter<1,1>;
+template class BinaryCellColumnWriter<1,2>;
+template class BinaryCellColumnWriter<2,2>;
+template class BinaryCellColumnWriter<1,3>;
+template class BinaryCellColumnWriter<2,3>;
+template class BinaryCellColumnWriter<3,3>;
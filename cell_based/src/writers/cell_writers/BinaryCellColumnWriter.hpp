@@ -0,0 +1,148 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BINARYCELLCOLUMNWRITER_HPP_
+#define BINARYCELLCOLUMNWRITER_HPP_
+
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "AbstractCellWriter.hpp"
+#include "OutputFileHandler.hpp"
+
+// Forward declaration prevents circular include chain
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM> class AbstractCellPopulation;
+
+/**
+ * A writer that stores the output of a cell population's cell writers as columns in a
+ * single binary file, as an alternative to each writer formatting every cell's data as
+ * text into its own file.
+ *
+ * The file starts with an ASCII header: a line
+ *     CHASTE_CELL_COLUMNS <format version> <LittleEndian|BigEndian> <number of columns>
+ * followed by one line per column giving its name. The header is followed by an
+ * append-only sequence of binary chunks, one per process per output time, each holding
+ *     double        time
+ *     uint32        number of cells, n
+ *     uint32[n]     cell IDs
+ *     double[c][n]  the values of each of the c columns for each cell, column by column.
+ *
+ * The first SPACE_DIM columns ("x", "y", "z") hold the location of each cell centre. These are
+ * followed, for each cell writer in turn, by the columns named by the writer's GetColumnNames()
+ * method and filled by its GetColumnDataForCell() method. A writer whose data cannot be stored
+ * in a fixed number of columns throws an exception when the file is opened.
+ *
+ * Each chunk is assembled in memory and written with a single call. The file may be read
+ * with BinaryCellColumnReader, or with python/utils/ConvertBinaryCellColumns.py, which
+ * also converts it to CSV files that can be loaded into ParaView.
+ */
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+class BinaryCellColumnWriter
+{
+private:
+
+    /** The name of the output file. */
+    std::string mFileName;
+
+    /** The names of the columns. */
+    std::vector<std::string> mColumnNames;
+
+    /** The number of columns written by each cell writer passed to OpenOutputFile(). */
+    std::vector<unsigned> mNumWriterColumns;
+
+    /** An output stream for writing data. */
+    out_stream mpOutStream;
+
+    /** Buffer for the cell IDs of the current chunk. */
+    std::vector<boost::uint32_t> mCellIds;
+
+    /** Buffer for the column values of the current chunk, stored column by column. */
+    std::vector<double> mValues;
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param rFileName the name of the file to write to (defaults to "results.cellcols")
+     */
+    BinaryCellColumnWriter(const std::string& rFileName="results.cellcols");
+
+    /**
+     * Determine the column names from a set of cell writers, open the output file
+     * for writing and (on the master process) write the header.
+     *
+     * @param rOutputFileHandler handler for the directory in which to open the file
+     * @param rCellWriters the cell writers whose data are to be written
+     */
+    void OpenOutputFile(OutputFileHandler& rOutputFileHandler,
+                        const std::vector<boost::shared_ptr<AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> > >& rCellWriters);
+
+    /**
+     * Open the output file for appending.
+     *
+     * @param rOutputFileHandler handler for the directory in which to open the file
+     */
+    void OpenOutputFileForAppend(OutputFileHandler& rOutputFileHandler);
+
+    /**
+     * Close the output file.
+     */
+    void CloseFile();
+
+    /**
+     * Write one chunk holding the current time and the data of every cell in the population
+     * (on this process).
+     *
+     * @param pCellPopulation pointer to the cell population
+     * @param rCellWriters the cell writers passed to OpenOutputFile()
+     */
+    void WriteTimeStep(AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                       const std::vector<boost::shared_ptr<AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> > >& rCellWriters);
+
+    /**
+     * @return the names of the columns.
+     */
+    const std::vector<std::string>& rGetColumnNames() const;
+
+    /**
+     * @return the output file name.
+     */
+    std::string GetFileName() const;
+};
+
+#endif /*BINARYCELLCOLUMNWRITER_HPP_*/
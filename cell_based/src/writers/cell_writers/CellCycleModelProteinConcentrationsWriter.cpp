@@ -56,6 +56,12 @@ double CellCycleModelProteinConcentrationsWriter<ELEMENT_DIM, SPACE_DIM>::GetCel
     return 0.0;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+std::vector<std::string> CellCycleModelProteinConcentrationsWriter<ELEMENT_DIM, SPACE_DIM>::GetColumnNames()
+{
+    EXCEPTION("CellCycleModelProteinConcentrationsWriter cannot be used with binary cell writer output, since the number of protein concentrations may differ between cells");
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void CellCycleModelProteinConcentrationsWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation)
 {
@@ -85,6 +85,16 @@ public:
      */
     double GetCellDataForVtkOutput(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation);
 
+    /**
+     * Overridden GetColumnNames() method.
+     *
+     * The number of protein concentrations may differ between cells, so these data cannot be
+     * stored in columns and this method throws an exception.
+     *
+     * @return the column names
+     */
+    std::vector<std::string> GetColumnNames();
+
     /**
      * Overridden VisitCell() method.
      *
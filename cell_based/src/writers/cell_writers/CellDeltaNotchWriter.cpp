@@ -50,6 +50,26 @@ double CellDeltaNotchWriter<ELEMENT_DIM, SPACE_DIM>::GetCellDataForVtkOutput(Cel
     return delta;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+std::vector<std::string> CellDeltaNotchWriter<ELEMENT_DIM, SPACE_DIM>::GetColumnNames()
+{
+    std::vector<std::string> column_names;
+    column_names.push_back("delta");
+    column_names.push_back("notch");
+    column_names.push_back("mean delta");
+    return column_names;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellDeltaNotchWriter<ELEMENT_DIM, SPACE_DIM>::GetColumnDataForCell(CellPtr pCell,
+                                                                        AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                                                                        std::vector<double>& rValues)
+{
+    rValues[0] = pCell->GetCellData()->GetItem("delta");
+    rValues[1] = pCell->GetCellData()->GetItem("notch");
+    rValues[2] = pCell->GetCellData()->GetItem("mean delta");
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void CellDeltaNotchWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation)
 {
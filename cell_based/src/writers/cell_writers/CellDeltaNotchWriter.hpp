@@ -90,6 +90,28 @@ public:
      */
     double GetCellDataForVtkOutput(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation);
 
+    /**
+     * Overridden GetColumnNames() method.
+     *
+     * The columns are "delta", "notch" and "mean delta", as in the text output.
+     *
+     * @return the column names
+     */
+    std::vector<std::string> GetColumnNames();
+
+    /**
+     * Overridden GetColumnDataForCell() method.
+     *
+     * Get the cell's levels of delta and notch and the mean level of delta among its neighbours.
+     *
+     * @param pCell a cell
+     * @param pCellPopulation a pointer to the cell population owning the cell
+     * @param rValues filled in with the values
+     */
+    void GetColumnDataForCell(CellPtr pCell,
+                              AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                              std::vector<double>& rValues);
+
     /**
      * Overridden VisitCell() method.
      *
@@ -50,6 +50,14 @@ double CellLocationIndexWriter<ELEMENT_DIM, SPACE_DIM>::GetCellDataForVtkOutput(
     return 0.0;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellLocationIndexWriter<ELEMENT_DIM, SPACE_DIM>::GetColumnDataForCell(CellPtr pCell,
+                                                                           AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                                                                           std::vector<double>& rValues)
+{
+    rValues[0] = pCellPopulation->GetLocationIndexUsingCell(pCell);
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void CellLocationIndexWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation)
 {
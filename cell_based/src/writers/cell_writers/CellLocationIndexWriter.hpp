@@ -85,6 +85,19 @@ public:
      */
     double GetCellDataForVtkOutput(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation);
 
+    /**
+     * Overridden GetColumnDataForCell() method.
+     *
+     * Get the location index of the cell, which is not given by GetCellDataForVtkOutput().
+     *
+     * @param pCell a cell
+     * @param pCellPopulation a pointer to the cell population owning the cell
+     * @param rValues filled in with the values
+     */
+    void GetColumnDataForCell(CellPtr pCell,
+                              AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                              std::vector<double>& rValues);
+
     /**
      * Overridden VisitCell() method.
      *
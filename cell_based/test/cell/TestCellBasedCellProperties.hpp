@@ -38,6 +38,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cxxtest/TestSuite.h>
 
+#include <climits>
+
 #include "CheckpointArchiveTypes.hpp"
 
 #include "CellId.hpp"
@@ -140,6 +142,52 @@ public:
         TS_ASSERT_EQUALS(p_cell_data->GetNumItems(), 3u);
     }
 
+    void TestCellDataItemHandles()
+    {
+        // Handles are shared by all CellData objects
+        unsigned handle_b = CellData::GetItemHandle("handle item b");
+        unsigned handle_a = CellData::GetItemHandle("handle item a");
+        TS_ASSERT_DIFFERS(handle_a, handle_b);
+        TS_ASSERT_EQUALS(CellData::GetItemHandle("handle item b"), handle_b);
+        TS_ASSERT_EQUALS(CellData::rGetItemName(handle_a), "handle item a");
+        TS_ASSERT_EQUALS(CellData::rGetItemName(handle_b), "handle item b");
+
+        MAKE_PTR(CellData, p_cell_data);
+        MAKE_PTR(CellData, p_other_cell_data);
+
+        // Registering a handle does not store an item
+        TS_ASSERT_EQUALS(p_cell_data->GetNumItems(), 0u);
+        TS_ASSERT_THROWS_THIS(p_cell_data->GetItem(handle_a), "The item handle item a is not stored");
+        TS_ASSERT_THROWS_THIS(p_cell_data->GetItem(UINT_MAX), "The item with handle 4294967295 is not registered");
+
+        // The handle-based and string-based methods access the same data
+        p_cell_data->SetItem(handle_b, 2.0);
+        p_cell_data->SetItem("handle item a", 1.0);
+        TS_ASSERT_DELTA(p_cell_data->GetItem("handle item b"), 2.0, 1e-12);
+        TS_ASSERT_DELTA(p_cell_data->GetItem(handle_a), 1.0, 1e-12);
+        TS_ASSERT_EQUALS(p_cell_data->GetNumItems(), 2u);
+
+        p_cell_data->SetItem(handle_a, 3.0);
+        TS_ASSERT_DELTA(p_cell_data->GetItem("handle item a"), 3.0, 1e-12);
+        TS_ASSERT_EQUALS(p_cell_data->GetNumItems(), 2u);
+
+        // Keys are returned in alphabetical order, not in order of registration
+        std::vector<std::string> keys = p_cell_data->GetKeys();
+        TS_ASSERT_EQUALS(keys.size(), 2u);
+        TS_ASSERT_EQUALS(keys[0], "handle item a");
+        TS_ASSERT_EQUALS(keys[1], "handle item b");
+
+        // Other CellData objects are unaffected
+        TS_ASSERT_EQUALS(p_other_cell_data->GetNumItems(), 0u);
+        TS_ASSERT_THROWS_THIS(p_other_cell_data->GetItem(handle_b), "The item handle item b is not stored");
+
+        // Querying an unknown name does not register it
+        TS_ASSERT_THROWS_THIS(p_cell_data->GetItem("handle item c"), "The item handle item c is not stored");
+        unsigned handle_c = CellData::GetItemHandle("handle item c");
+        TS_ASSERT_LESS_THAN(handle_a, handle_c);
+        TS_ASSERT_LESS_THAN(handle_b, handle_c);
+    }
+
     void TestArchiveCellData()
     {
         OutputFileHandler handler("archive", false);
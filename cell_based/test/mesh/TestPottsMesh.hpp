@@ -1778,6 +1778,63 @@ public:
         TS_ASSERT_EQUALS(p_mesh->GetNumNodes(), 2u);
     }
 
+    void TestGetSublattices()
+    {
+        // Create a 6x6 lattice with no elements
+        PottsMeshGenerator<2> generator(6, 0, 0, 6, 0, 0);
+        PottsMesh<2>* p_mesh = generator.GetMesh();
+
+        // On a square lattice the greedy colouring gives the 3x3 checkerboard decomposition
+        std::vector<std::vector<unsigned> > sublattices = p_mesh->rGetSublattices();
+        TS_ASSERT_EQUALS(sublattices.size(), 9u);
+
+        std::set<unsigned> all_nodes;
+        for (unsigned i=0; i<sublattices.size(); i++)
+        {
+            TS_ASSERT_EQUALS(sublattices[i].size(), 4u);
+            for (unsigned j=0; j<sublattices[i].size(); j++)
+            {
+                all_nodes.insert(sublattices[i][j]);
+
+                // No other node of this sublattice may lie within two Moore steps of this node
+                std::set<unsigned> nearby_nodes = p_mesh->GetMooreNeighbouringNodeIndices(sublattices[i][j]);
+                std::set<unsigned> neighbours = nearby_nodes;
+                for (std::set<unsigned>::iterator iter = neighbours.begin(); iter != neighbours.end(); ++iter)
+                {
+                    std::set<unsigned> next_neighbours = p_mesh->GetMooreNeighbouringNodeIndices(*iter);
+                    nearby_nodes.insert(next_neighbours.begin(), next_neighbours.end());
+                }
+                for (unsigned k=0; k<sublattices[i].size(); k++)
+                {
+                    if (k != j)
+                    {
+                        TS_ASSERT_EQUALS(nearby_nodes.count(sublattices[i][k]), 0u);
+                    }
+                }
+            }
+        }
+        TS_ASSERT_EQUALS(all_nodes.size(), p_mesh->GetNumNodes());
+
+        TS_ASSERT_EQUALS(sublattices[0][0], 0u);
+        TS_ASSERT_EQUALS(sublattices[0][1], 3u);
+        TS_ASSERT_EQUALS(sublattices[0][2], 18u);
+        TS_ASSERT_EQUALS(sublattices[0][3], 21u);
+
+        // The sublattices are recomputed once the connectivity has changed
+        p_mesh->DeleteNode(35);
+        unsigned num_nodes_in_sublattices = 0;
+        for (unsigned i=0; i<p_mesh->rGetSublattices().size(); i++)
+        {
+            num_nodes_in_sublattices += p_mesh->rGetSublattices()[i].size();
+        }
+        TS_ASSERT_EQUALS(num_nodes_in_sublattices, 35u);
+
+        // In 3D a 3x3x3 lattice has every node in its own sublattice
+        PottsMeshGenerator<3> generator_3d(3, 0, 0, 3, 0, 0, 3, 0, 0);
+        PottsMesh<3>* p_mesh_3d = generator_3d.GetMesh();
+        TS_ASSERT_EQUALS(p_mesh_3d->rGetSublattices().size(), 27u);
+    }
+
     void TestArchive2dPottsMesh()
     {
         EXIT_IF_PARALLEL;
@@ -50,6 +50,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FixedG1GenerationalCellCycleModel.hpp"
 #include "DifferentiatedCellProliferativeType.hpp"
 #include "DiffusionCaUpdateRule.hpp"
+#include "RandomCaSwitchingUpdateRule.hpp"
 #include "AbstractCellBasedTestSuite.hpp"
 #include "ArchiveOpener.hpp"
 #include "WildTypeCellMutationState.hpp"
@@ -733,6 +734,53 @@ public:
         TS_ASSERT(neighbours_of_cell_0 == expected_neighbours_of_cell_0);
     }
 
+    void TestUpdateCellLocationsBySublattice()
+    {
+        // Create a simple 2D PottsMesh
+        PottsMeshGenerator<2> generator(6, 0, 0, 6, 0, 0);
+        PottsMesh<2>* p_mesh = generator.GetMesh();
+
+        // Create cells on every other site
+        std::vector<unsigned> location_indices;
+        for (unsigned i=0; i<36; i+=2)
+        {
+            location_indices.push_back(i);
+        }
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedG1GenerationalCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, location_indices.size());
+
+        // Create cell population
+        CaBasedCellPopulation<2u> cell_population(*p_mesh, cells, location_indices);
+
+        // Sweep over the lattice one sublattice at a time
+        TS_ASSERT_EQUALS(cell_population.GetUpdateNodesBySublattice(), false);
+        cell_population.SetUpdateNodesBySublattice(true);
+        TS_ASSERT_EQUALS(cell_population.GetUpdateNodesBySublattice(), true);
+
+        // Create a CA switching update rule and pass to the population
+        MAKE_PTR(RandomCaSwitchingUpdateRule<2u>, p_switching_update_rule);
+        p_switching_update_rule->SetSwitchingParameter(1.0);
+        cell_population.AddUpdateRule(p_switching_update_rule);
+
+        for (unsigned i=0; i<5; i++)
+        {
+            cell_population.UpdateCellLocations(1.0);
+        }
+
+        // Cells are conserved and each site holds at most one cell
+        TS_ASSERT_EQUALS(cell_population.GetNumRealCells(), 18u);
+        unsigned num_occupied_sites = 0;
+        for (unsigned node_index=0; node_index<p_mesh->GetNumNodes(); node_index++)
+        {
+            if (cell_population.rGetAvailableSpaces()[node_index] == 0)
+            {
+                num_occupied_sites++;
+            }
+        }
+        TS_ASSERT_EQUALS(num_occupied_sites, 18u);
+    }
+
     void TestUpdateCellLocationsRandomlyExceptions()
     {
         // Create a simple 2D PottsMesh with two cells
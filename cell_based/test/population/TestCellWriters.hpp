@@ -46,6 +46,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ApoptoticCellProperty.hpp"
 #include "BackwardEulerIvpOdeSolver.hpp"
 #include "BetaCateninOneHitCellMutationState.hpp"
+#include "BinaryCellColumnReader.hpp"
 #include "CaBasedCellPopulation.hpp"
 #include "Cell.hpp"
 #include "CellAncestor.hpp"
@@ -1786,6 +1787,187 @@ public:
             delete p_node;
         }
     }
+
+    void TestBinaryCellColumnOutput()
+    {
+        EXIT_IF_PARALLEL;
+
+        // Set up SimulationTime (this is usually done by a simulation object)
+        SimulationTime::Instance()->SetEndTimeAndNumberOfTimeSteps(25, 2);
+
+        // Create a simple node-based cell population
+        std::vector<Node<2>* > nodes;
+        nodes.push_back(new Node<2>(0u, false, 0.0, 0.0));
+        nodes.push_back(new Node<2>(1u, false, 1.0, 0.5));
+
+        NodesOnlyMesh<2> mesh;
+        mesh.ConstructNodesWithoutMesh(nodes, 1.5);
+
+        std::vector<CellPtr> cells;
+        auto p_diff_type = boost::make_shared<DifferentiatedCellProliferativeType>();
+        CellsGenerator<NoCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasicRandom(cells, mesh.GetNumNodes(), p_diff_type);
+
+        NodeBasedCellPopulation<2> cell_population(mesh, cells);
+        cell_population.SetOutputResultsForChasteVisualizer(false);
+        cell_population.AddCellWriter<CellAgesWriter>();
+        cell_population.AddCellWriter<CellAppliedForceWriter>();
+
+        c_vector<double, 2> force_0 = Create_c_vector(1.23, 2.34);
+        c_vector<double, 2> force_1 = Create_c_vector(3.45, 4.56);
+        mesh.GetNode(0u)->AddAppliedForceContribution(force_0);
+        mesh.GetNode(1u)->AddAppliedForceContribution(force_1);
+
+        // Write the cell writers' data to a single binary file at two times
+        TS_ASSERT_EQUALS(cell_population.GetUseBinaryCellWriterOutput(), false);
+        cell_population.SetUseBinaryCellWriterOutput(true);
+        TS_ASSERT_EQUALS(cell_population.GetUseBinaryCellWriterOutput(), true);
+
+        std::string output_directory = "TestBinaryCellColumnOutput";
+        OutputFileHandler output_file_handler(output_directory, false);
+        cell_population.OpenWritersFiles(output_file_handler);
+        cell_population.WriteResultsToFiles(output_directory);
+        SimulationTime::Instance()->IncrementTimeOneStep();
+        cell_population.WriteResultsToFiles(output_directory);
+        cell_population.CloseWritersFiles();
+
+        // No text files are written for the cell writers
+        FileFinder ages_file = output_file_handler.FindFile("cellages.dat");
+        TS_ASSERT(!ages_file.Exists());
+
+        // Read the data back in
+        FileFinder binary_file = output_file_handler.FindFile("results.cellcols");
+        BinaryCellColumnReader reader(binary_file);
+
+        std::vector<std::string> column_names = reader.rGetColumnNames();
+        TS_ASSERT_EQUALS(column_names.size(), 5u);
+        TS_ASSERT_EQUALS(column_names[0], "x");
+        TS_ASSERT_EQUALS(column_names[1], "y");
+        TS_ASSERT_EQUALS(column_names[2], "Ages");
+        TS_ASSERT_EQUALS(column_names[3], "Cell applied force_x");
+        TS_ASSERT_EQUALS(column_names[4], "Cell applied force_y");
+
+        TS_ASSERT_EQUALS(reader.GetNumTimeSteps(), 2u);
+        TS_ASSERT_DELTA(reader.rGetTimes()[0], 0.0, 1e-12);
+        TS_ASSERT_DELTA(reader.rGetTimes()[1], 12.5, 1e-12);
+
+        std::vector<unsigned> cell_ids;
+        std::vector<std::vector<double> > columns;
+        reader.ReadTimeStep(1, cell_ids, columns);
+        TS_ASSERT_EQUALS(cell_ids.size(), 2u);
+        TS_ASSERT_EQUALS(columns.size(), 5u);
+
+        unsigned index = 0;
+        for (auto cell_iter = cell_population.Begin(); cell_iter != cell_population.End(); ++cell_iter, ++index)
+        {
+            TS_ASSERT_EQUALS(cell_ids[index], (*cell_iter)->GetCellId());
+            TS_ASSERT_DELTA(columns[0][index], cell_population.GetLocationOfCellCentre(*cell_iter)[0], 1e-12);
+            TS_ASSERT_DELTA(columns[1][index], cell_population.GetLocationOfCellCentre(*cell_iter)[1], 1e-12);
+            TS_ASSERT_DELTA(columns[2][index], (*cell_iter)->GetAge(), 1e-12);
+        }
+        TS_ASSERT_DELTA(columns[3][0], 1.23, 1e-12);
+        TS_ASSERT_DELTA(columns[4][0], 2.34, 1e-12);
+        TS_ASSERT_DELTA(columns[3][1], 3.45, 1e-12);
+        TS_ASSERT_DELTA(columns[4][1], 4.56, 1e-12);
+
+        TS_ASSERT_THROWS_THIS(reader.ReadTimeStep(2, cell_ids, columns), "Time step index out of range");
+
+        // A file that is not a binary cell column file is rejected
+        FileFinder text_file("cell_based/test/data/TestCellWriters/cellappliedforce.dat", RelativeTo::ChasteSourceRoot);
+        TS_ASSERT_THROWS_CONTAINS(BinaryCellColumnReader bad_reader(text_file), "is not a binary cell column file");
+
+        // Avoid memory leak
+        for (auto& p_node : nodes)
+        {
+            delete p_node;
+        }
+    }
+
+    void TestBinaryCellColumnOutputWithMultiValueWriters()
+    {
+        EXIT_IF_PARALLEL;
+
+        // Set up SimulationTime (this is usually done by a simulation object)
+        SimulationTime::Instance()->SetEndTimeAndNumberOfTimeSteps(25, 2);
+
+        // Create a simple node-based cell population whose cells store Delta-Notch data
+        std::vector<Node<2>* > nodes;
+        nodes.push_back(new Node<2>(0u, false, 0.0, 0.0));
+        nodes.push_back(new Node<2>(1u, false, 1.0, 0.5));
+        nodes.push_back(new Node<2>(2u, false, 0.5, 1.0));
+
+        NodesOnlyMesh<2> mesh;
+        mesh.ConstructNodesWithoutMesh(nodes, 1.5);
+
+        std::vector<CellPtr> cells;
+        auto p_diff_type = boost::make_shared<DifferentiatedCellProliferativeType>();
+        CellsGenerator<NoCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasicRandom(cells, mesh.GetNumNodes(), p_diff_type);
+        for (unsigned i=0; i<cells.size(); i++)
+        {
+            cells[i]->GetCellData()->SetItem("delta", 1.0 + i);
+            cells[i]->GetCellData()->SetItem("notch", 2.0 + i);
+            cells[i]->GetCellData()->SetItem("mean delta", 3.0 + i);
+        }
+
+        NodeBasedCellPopulation<2> cell_population(mesh, cells);
+        cell_population.SetOutputResultsForChasteVisualizer(false);
+        cell_population.AddCellWriter<CellDeltaNotchWriter>();
+        cell_population.AddCellWriter<CellLocationIndexWriter>();
+
+        std::string output_directory = "TestBinaryCellColumnOutputWithMultiValueWriters";
+        OutputFileHandler output_file_handler(output_directory, false);
+
+        // Setting the flag after the files have been opened only takes effect when they are next opened
+        cell_population.OpenWritersFiles(output_file_handler);
+        cell_population.SetUseBinaryCellWriterOutput(true);
+        TS_ASSERT_THROWS_NOTHING(cell_population.WriteResultsToFiles(output_directory));
+        cell_population.CloseWritersFiles();
+        TS_ASSERT(output_file_handler.FindFile("celldeltanotch.dat").Exists());
+        TS_ASSERT(!output_file_handler.FindFile("results.cellcols").Exists());
+
+        cell_population.OpenWritersFiles(output_file_handler);
+        cell_population.WriteResultsToFiles(output_directory);
+        cell_population.CloseWritersFiles();
+
+        // Read the data back in: each writer contributes the same values as its text output
+        BinaryCellColumnReader reader(output_file_handler.FindFile("results.cellcols"));
+
+        std::vector<std::string> column_names = reader.rGetColumnNames();
+        TS_ASSERT_EQUALS(column_names.size(), 6u);
+        TS_ASSERT_EQUALS(column_names[2], "delta");
+        TS_ASSERT_EQUALS(column_names[3], "notch");
+        TS_ASSERT_EQUALS(column_names[4], "mean delta");
+        TS_ASSERT_EQUALS(column_names[5], "Location indices");
+
+        TS_ASSERT_EQUALS(reader.GetNumTimeSteps(), 1u);
+        std::vector<unsigned> cell_ids;
+        std::vector<std::vector<double> > columns;
+        reader.ReadTimeStep(0, cell_ids, columns);
+        TS_ASSERT_EQUALS(cell_ids.size(), 3u);
+        TS_ASSERT_EQUALS(columns.size(), 6u);
+
+        unsigned index = 0;
+        for (auto cell_iter = cell_population.Begin(); cell_iter != cell_population.End(); ++cell_iter, ++index)
+        {
+            TS_ASSERT_EQUALS(cell_ids[index], (*cell_iter)->GetCellId());
+            TS_ASSERT_DELTA(columns[2][index], (*cell_iter)->GetCellData()->GetItem("delta"), 1e-12);
+            TS_ASSERT_DELTA(columns[3][index], (*cell_iter)->GetCellData()->GetItem("notch"), 1e-12);
+            TS_ASSERT_DELTA(columns[4][index], (*cell_iter)->GetCellData()->GetItem("mean delta"), 1e-12);
+            TS_ASSERT_DELTA(columns[5][index], cell_population.GetLocationIndexUsingCell(*cell_iter), 1e-12);
+        }
+
+        // A writer whose data cannot be stored in a fixed number of columns is rejected
+        cell_population.AddCellWriter<CellCycleModelProteinConcentrationsWriter>();
+        TS_ASSERT_THROWS_CONTAINS(cell_population.OpenWritersFiles(output_file_handler),
+                                  "CellCycleModelProteinConcentrationsWriter cannot be used with binary cell writer output");
+
+        // Avoid memory leak
+        for (auto& p_node : nodes)
+        {
+            delete p_node;
+        }
+    }
 };
 
 #endif /*TESTCELLWRITERS_HPP_*/
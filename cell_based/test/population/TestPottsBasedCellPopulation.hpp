@@ -44,6 +44,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "CellsGenerator.hpp"
 #include "PottsBasedCellPopulation.hpp"
 #include "VolumeConstraintPottsUpdateRule.hpp"
+#include "AdhesionPottsUpdateRule.hpp"
 #include "PottsMeshGenerator.hpp"
 #include "FixedG1GenerationalCellCycleModel.hpp"
 #include "AbstractCellBasedTestSuite.hpp"
@@ -421,6 +422,119 @@ public:
         TS_ASSERT_EQUALS(cell_population.rGetMesh().GetElement(1)->GetNumNodes(), 4u);
     }
 
+    void TestUpdateCellLocationsBySublattice()
+    {
+        std::vector<unsigned> num_nodes_in_element_0;
+        for (unsigned run=0; run<2; run++)
+        {
+            RandomNumberGenerator::Instance()->Reseed(0);
+
+            // Create a simple 2D PottsMesh with two cells
+            PottsMeshGenerator<2> generator(6, 2, 2, 6, 1, 2);
+            PottsMesh<2>* p_mesh = generator.GetMesh();
+
+            // Create cells
+            std::vector<CellPtr> cells;
+            CellsGenerator<FixedG1GenerationalCellCycleModel, 2> cells_generator;
+            cells_generator.GenerateBasic(cells, p_mesh->GetNumElements());
+
+            // Create cell population
+            PottsBasedCellPopulation<2> cell_population(*p_mesh, cells);
+
+            // Sweep over the lattice one sublattice at a time
+            TS_ASSERT_EQUALS(cell_population.GetUpdateNodesBySublattice(), false);
+            cell_population.SetUpdateNodesBySublattice(true);
+            TS_ASSERT_EQUALS(cell_population.GetUpdateNodesBySublattice(), true);
+            cell_population.SetTemperature(10.0);
+            cell_population.SetNumSweepsPerTimestep(2);
+
+            MAKE_PTR(VolumeConstraintPottsUpdateRule<2>, p_volume_constraint_update_rule);
+            cell_population.AddUpdateRule(p_volume_constraint_update_rule);
+
+            cell_population.UpdateCellLocations(1.0);
+
+            // Each node is still in at most one element
+            unsigned num_nodes_in_elements = 0;
+            for (unsigned elem_index=0; elem_index<cell_population.GetNumElements(); elem_index++)
+            {
+                num_nodes_in_elements += cell_population.GetElement(elem_index)->GetNumNodes();
+            }
+            TS_ASSERT_LESS_THAN_EQUALS(num_nodes_in_elements, cell_population.GetNumNodes());
+            for (unsigned node_index=0; node_index<cell_population.GetNumNodes(); node_index++)
+            {
+                TS_ASSERT_LESS_THAN_EQUALS(cell_population.GetNode(node_index)->GetNumContainingElements(), 1u);
+            }
+
+            num_nodes_in_element_0.push_back(cell_population.GetElement(0)->GetNumNodes());
+        }
+
+        // The sweep is reproducible for a fixed seed
+        TS_ASSERT_EQUALS(num_nodes_in_element_0[0], num_nodes_in_element_0[1]);
+    }
+
+    void TestSublatticeSweepIsIndependentOfUpdateOrder()
+    {
+        /*
+         * The adhesion energy at a node only involves its neighbours, so copy attempts
+         * at nodes of the same sublattice do not interact. Since each attempt draws from
+         * its own counter-based random stream, the result of a sweep should therefore not
+         * depend on the order in which the nodes of a sublattice are visited, nor on the
+         * state of RandomNumberGenerator.
+         */
+        std::vector<unsigned> initial_node_elements;
+        std::vector<std::vector<unsigned> > node_elements(3);
+        for (unsigned run=0; run<3; run++)
+        {
+            // Use a different seed for RandomNumberGenerator in each run
+            RandomNumberGenerator::Instance()->Reseed(run);
+
+            // Create a 2D PottsMesh with four cells
+            PottsMeshGenerator<2> generator(10, 2, 3, 10, 2, 3);
+            PottsMesh<2>* p_mesh = generator.GetMesh();
+
+            std::vector<CellPtr> cells;
+            CellsGenerator<FixedG1GenerationalCellCycleModel, 2> cells_generator;
+            cells_generator.GenerateBasic(cells, p_mesh->GetNumElements());
+
+            PottsBasedCellPopulation<2> cell_population(*p_mesh, cells);
+            cell_population.SetUpdateNodesBySublattice(true);
+            cell_population.SetTemperature(1.0);
+
+            // Visit the nodes of each sublattice in index order in the first run, and in random order otherwise
+            cell_population.SetUpdateNodesInRandomOrder(run > 0);
+
+            MAKE_PTR(AdhesionPottsUpdateRule<2>, p_adhesion_update_rule);
+            cell_population.AddUpdateRule(p_adhesion_update_rule);
+
+            if (run == 0)
+            {
+                for (unsigned node_index=0; node_index<cell_population.GetNumNodes(); node_index++)
+                {
+                    std::set<unsigned> containing_elements = cell_population.GetNode(node_index)->rGetContainingElementIndices();
+                    initial_node_elements.push_back(containing_elements.empty() ? UINT_MAX : *(containing_elements.begin()));
+                }
+            }
+
+            for (unsigned step=0; step<3; step++)
+            {
+                cell_population.UpdateCellLocations(1.0);
+            }
+
+            for (unsigned node_index=0; node_index<cell_population.GetNumNodes(); node_index++)
+            {
+                std::set<unsigned> containing_elements = cell_population.GetNode(node_index)->rGetContainingElementIndices();
+                node_elements[run].push_back(containing_elements.empty() ? UINT_MAX : *(containing_elements.begin()));
+            }
+        }
+
+        // Some copies were made...
+        TS_ASSERT(node_elements[0] != initial_node_elements);
+
+        // ...and every run gives the same configuration
+        TS_ASSERT(node_elements[1] == node_elements[0]);
+        TS_ASSERT(node_elements[2] == node_elements[0]);
+    }
+
     ///\todo implement this test (#1666)
 //    void TestVoronoiMethods()
 //    {
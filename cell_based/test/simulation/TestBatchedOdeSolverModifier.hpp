@@ -0,0 +1,356 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTBATCHEDODESOLVERMODIFIER_HPP_
+#define TESTBATCHEDODESOLVERMODIFIER_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+// Must be included before other cell_based headers
+#include "CellBasedSimulationArchiver.hpp"
+
+#include "AbstractCellBasedTestSuite.hpp"
+#include "SmartPointers.hpp"
+
+#include "BatchedOdeSolverModifier.hpp"
+#include "DeltaNotchTrackingModifier.hpp"
+#include "DeltaNotchSrnModel.hpp"
+#include "Goldbeter1991SrnModel.hpp"
+#include "UniformCellCycleModel.hpp"
+#include "HoneycombMeshGenerator.hpp"
+#include "NodeBasedCellPopulation.hpp"
+#include "OffLatticeSimulation.hpp"
+#include "WildTypeCellMutationState.hpp"
+#include "DifferentiatedCellProliferativeType.hpp"
+#include "FileComparison.hpp"
+
+// This test is only run sequentially (never in parallel)
+#include "FakePetscSetup.hpp"
+
+class TestBatchedOdeSolverModifier : public AbstractCellBasedTestSuite
+{
+private:
+
+    /**
+     * Helper method to run a small Delta-Notch simulation, optionally with a
+     * BatchedOdeSolverModifier, and return the final Notch and Delta levels.
+     */
+    std::vector<double> RunDeltaNotchSimulation(bool useBatchedSolver)
+    {
+        HoneycombMeshGenerator generator(3, 3, 0);
+        MutableMesh<2,2>* p_generating_mesh = generator.GetMesh();
+        NodesOnlyMesh<2> mesh;
+        mesh.ConstructNodesWithoutMesh(*p_generating_mesh, 1.5);
+
+        std::vector<CellPtr> cells;
+        MAKE_PTR(WildTypeCellMutationState, p_state);
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_diff_type);
+        for (unsigned i=0; i<mesh.GetNumNodes(); i++)
+        {
+            UniformCellCycleModel* p_cc_model = new UniformCellCycleModel();
+            p_cc_model->SetDimension(2);
+
+            // Give each cell different initial conditions so that the coupling matters
+            std::vector<double> initial_conditions;
+            initial_conditions.push_back(0.5 + 0.05*i);
+            initial_conditions.push_back(1.0 - 0.05*i);
+
+            DeltaNotchSrnModel* p_srn_model = new DeltaNotchSrnModel();
+            p_srn_model->SetInitialConditions(initial_conditions);
+            CellPtr p_cell(new Cell(p_state, p_cc_model, p_srn_model));
+            p_cell->SetCellProliferativeType(p_diff_type);
+            p_cell->SetBirthTime(0.0);
+            cells.push_back(p_cell);
+        }
+
+        NodeBasedCellPopulation<2> cell_population(mesh, cells);
+
+        OffLatticeSimulation<2> simulator(cell_population);
+        simulator.SetOutputDirectory("TestBatchedOdeSolverModifierDeltaNotch");
+        simulator.SetEndTime(1.0);
+
+        // The batched solver must be added before the tracking modifier
+        if (useBatchedSolver)
+        {
+            MAKE_PTR(BatchedOdeSolverModifier<2>, p_batch_modifier);
+            p_batch_modifier->SetAdaptiveSolverTimeStep(0.001);
+            simulator.AddSimulationModifier(p_batch_modifier);
+        }
+        MAKE_PTR(DeltaNotchTrackingModifier<2>, p_tracking_modifier);
+        simulator.AddSimulationModifier(p_tracking_modifier);
+
+        simulator.Solve();
+
+        std::vector<double> levels;
+        for (AbstractCellPopulation<2>::Iterator cell_iter = cell_population.Begin();
+             cell_iter != cell_population.End();
+             ++cell_iter)
+        {
+            DeltaNotchSrnModel* p_model = static_cast<DeltaNotchSrnModel*>(cell_iter->GetSrnModel());
+            levels.push_back(p_model->GetNotch());
+            levels.push_back(p_model->GetDelta());
+        }
+        return levels;
+    }
+
+public:
+
+    void TestSolveBatchMatchesPerCellSolve()
+    {
+        SimulationTime* p_simulation_time = SimulationTime::Instance();
+        p_simulation_time->SetEndTimeAndNumberOfTimeSteps(2.0, 20);
+
+        MAKE_PTR(WildTypeCellMutationState, p_state);
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_diff_type);
+
+        // Create two identical sets of cells with Goldbeter1991 SRN models, which always use RK4
+        const unsigned num_cells = 5;
+        std::vector<CellPtr> cells;
+        std::vector<CellCycleModelOdeHandler*> batch_handlers;
+        std::vector<Goldbeter1991SrnModel*> per_cell_models;
+        for (unsigned i=0; i<2*num_cells; i++)
+        {
+            std::vector<double> initial_conditions;
+            initial_conditions.push_back(0.1 + 0.1*(i%num_cells));
+            initial_conditions.push_back(0.5);
+            initial_conditions.push_back(0.9 - 0.1*(i%num_cells));
+
+            Goldbeter1991SrnModel* p_srn_model = new Goldbeter1991SrnModel();
+            p_srn_model->SetInitialConditions(initial_conditions);
+
+            CellPtr p_cell(new Cell(p_state, new UniformCellCycleModel(), p_srn_model));
+            p_cell->SetCellProliferativeType(p_diff_type);
+            p_cell->InitialiseCellCycleModel();
+            p_cell->InitialiseSrnModel();
+            cells.push_back(p_cell);
+
+            if (i < num_cells)
+            {
+                batch_handlers.push_back(p_srn_model);
+            }
+            else
+            {
+                per_cell_models.push_back(p_srn_model);
+            }
+        }
+
+        BatchedOdeSolverModifier<2> modifier;
+
+        while (!p_simulation_time->IsFinished())
+        {
+            double last_time = p_simulation_time->GetTime();
+            p_simulation_time->IncrementTimeOneStep();
+            double current_time = p_simulation_time->GetTime();
+
+            for (unsigned i=0; i<num_cells; i++)
+            {
+                TS_ASSERT(batch_handlers[i]->CanSolveOdeInBatch(current_time));
+            }
+            unsigned num_solved = modifier.SolveBatch(batch_handlers, last_time, current_time, batch_handlers[0]->GetDt());
+            TS_ASSERT_EQUALS(num_solved, num_cells);
+
+            for (unsigned i=0; i<num_cells; i++)
+            {
+                TS_ASSERT_DELTA(batch_handlers[i]->GetLastTime(), current_time, 1e-12);
+                TS_ASSERT(!batch_handlers[i]->CanSolveOdeInBatch(current_time));
+                per_cell_models[i]->SimulateToCurrentTime();
+            }
+        }
+
+        // The batched and per-cell solutions should agree to round-off
+        for (unsigned i=0; i<num_cells; i++)
+        {
+            std::vector<double> batch_state = batch_handlers[i]->GetProteinConcentrations();
+            std::vector<double> per_cell_state = per_cell_models[i]->GetProteinConcentrations();
+            for (unsigned var=0; var<batch_state.size(); var++)
+            {
+                TS_ASSERT_DELTA(batch_state[var], per_cell_state[var], 1e-12);
+            }
+        }
+
+        // Once solved to the current time, a subsequent per-cell call leaves the state unchanged
+        std::vector<double> state_before = batch_handlers[0]->GetProteinConcentrations();
+        static_cast<Goldbeter1991SrnModel*>(batch_handlers[0])->SimulateToCurrentTime();
+        std::vector<double> state_after = batch_handlers[0]->GetProteinConcentrations();
+        for (unsigned var=0; var<state_before.size(); var++)
+        {
+            TS_ASSERT_DELTA(state_before[var], state_after[var], 1e-15);
+        }
+
+        // An empty batch, or one with no time to solve over, does nothing
+        TS_ASSERT_EQUALS(modifier.SolveBatch(std::vector<CellCycleModelOdeHandler*>(), 0.0, 1.0, 0.1), 0u);
+        TS_ASSERT_EQUALS(modifier.SolveBatch(batch_handlers, 2.0, 2.0, 0.1), 0u);
+    }
+
+    void TestSolveBatchChecksConcentrationsStayNonNegative()
+    {
+        SimulationTime* p_simulation_time = SimulationTime::Instance();
+        p_simulation_time->SetEndTimeAndNumberOfTimeSteps(1.0, 10);
+
+        MAKE_PTR(WildTypeCellMutationState, p_state);
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_diff_type);
+
+        // The second model starts with a negative concentration, which stays negative over one step
+        std::vector<CellPtr> cells;
+        std::vector<CellCycleModelOdeHandler*> batch_handlers;
+        for (unsigned i=0; i<2; i++)
+        {
+            std::vector<double> initial_conditions;
+            initial_conditions.push_back(i == 0 ? 0.1 : -1.0);
+            initial_conditions.push_back(0.5);
+            initial_conditions.push_back(0.5);
+
+            Goldbeter1991SrnModel* p_srn_model = new Goldbeter1991SrnModel();
+            p_srn_model->SetInitialConditions(initial_conditions);
+
+            CellPtr p_cell(new Cell(p_state, new UniformCellCycleModel(), p_srn_model));
+            p_cell->SetCellProliferativeType(p_diff_type);
+            p_cell->InitialiseCellCycleModel();
+            p_cell->InitialiseSrnModel();
+            cells.push_back(p_cell);
+            batch_handlers.push_back(p_srn_model);
+        }
+
+        BatchedOdeSolverModifier<2> modifier;
+        p_simulation_time->IncrementTimeOneStep();
+        double current_time = p_simulation_time->GetTime();
+
+        // Without the check the batch is solved, as for SRN models
+        TS_ASSERT_EQUALS(modifier.SolveBatch(batch_handlers, 0.0, current_time, batch_handlers[0]->GetDt()), 2u);
+        TS_ASSERT_LESS_THAN(batch_handlers[1]->GetProteinConcentrations()[0], 0.0);
+
+        // With it, as for cell-cycle models, the same exception is thrown as by the per-cell solve
+        p_simulation_time->IncrementTimeOneStep();
+        TS_ASSERT_THROWS_CONTAINS(modifier.SolveBatch(batch_handlers, current_time, p_simulation_time->GetTime(),
+                                                      batch_handlers[0]->GetDt(), true),
+                                  "A protein concentration 0 has gone negative");
+    }
+
+    void TestDeltaNotchSimulationWithBatchedSolver()
+    {
+        EXIT_IF_PARALLEL;
+
+        std::vector<double> per_cell_levels = RunDeltaNotchSimulation(false);
+
+        // Reset SimulationTime for the second simulation
+        SimulationTime::Destroy();
+        SimulationTime::Instance()->SetStartTime(0.0);
+
+        std::vector<double> batched_levels = RunDeltaNotchSimulation(true);
+
+        /*
+         * Without CVODE both simulations use RK4 with the same time step, and the batch is
+         * solved with the same neighbouring Delta levels as each cell would use, so they agree
+         * to round-off. With CVODE the per-cell simulation is adaptive, with a relative tolerance
+         * of 1e-4, while the batched simulation uses RK4 with a fixed time step, so they only
+         * agree to within the CVODE tolerance.
+         */
+#ifdef CHASTE_CVODE
+        double tolerance = 1e-4;
+#else
+        double tolerance = 1e-12;
+#endif //CHASTE_CVODE
+        TS_ASSERT_EQUALS(per_cell_levels.size(), batched_levels.size());
+        for (unsigned i=0; i<per_cell_levels.size(); i++)
+        {
+            TS_ASSERT_DELTA(per_cell_levels[i], batched_levels[i], tolerance);
+        }
+    }
+
+    void TestBatchedOdeSolverModifierArchiving()
+    {
+        // Create a file for archiving
+        OutputFileHandler handler("archive", false);
+        std::string archive_filename = handler.GetOutputDirectoryFullPath() + "BatchedOdeSolverModifier.arch";
+
+        // Separate scope to write the archive
+        {
+            AbstractCellBasedSimulationModifier<2,2>* const p_modifier = new BatchedOdeSolverModifier<2>();
+            (static_cast<BatchedOdeSolverModifier<2>*>(p_modifier))->SetAdaptiveSolverTimeStep(0.005);
+
+            // Create an output archive
+            std::ofstream ofs(archive_filename.c_str());
+            boost::archive::text_oarchive output_arch(ofs);
+
+            // Serialize via pointer
+            output_arch << p_modifier;
+            delete p_modifier;
+        }
+
+        // Separate scope to read the archive
+        {
+            AbstractCellBasedSimulationModifier<2,2>* p_modifier2;
+
+            // Restore the modifier
+            std::ifstream ifs(archive_filename.c_str());
+            boost::archive::text_iarchive input_arch(ifs);
+
+            input_arch >> p_modifier2;
+
+            double time_step = (static_cast<BatchedOdeSolverModifier<2>*>(p_modifier2))->GetAdaptiveSolverTimeStep();
+            TS_ASSERT_DELTA(time_step, 0.005, 1e-9);
+
+            delete p_modifier2;
+        }
+    }
+
+    void TestBatchedOdeSolverModifierOutputParameters()
+    {
+        EXIT_IF_PARALLEL;
+        std::string output_directory = "TestBatchedOdeSolverModifierOutputParameters";
+        OutputFileHandler output_file_handler(output_directory, false);
+
+        MAKE_PTR(BatchedOdeSolverModifier<2>, p_modifier);
+        TS_ASSERT_EQUALS(p_modifier->GetIdentifier(), "BatchedOdeSolverModifier-2");
+        TS_ASSERT_DELTA(p_modifier->GetAdaptiveSolverTimeStep(), 0.001, 1e-9);
+
+        p_modifier->SetAdaptiveSolverTimeStep(0.002);
+
+        out_stream modifier_parameter_file = output_file_handler.OpenOutputFile("BatchedOdeSolverModifier.parameters");
+        p_modifier->OutputSimulationModifierParameters(modifier_parameter_file);
+        modifier_parameter_file->close();
+
+        {
+            // Compare the generated file in test output with a reference copy in the source code
+            FileFinder generated = output_file_handler.FindFile("BatchedOdeSolverModifier.parameters");
+            FileFinder reference("cell_based/test/data/TestSimulationModifierOutputParameters/BatchedOdeSolverModifier.parameters",
+                    RelativeTo::ChasteSourceRoot);
+            FileComparison comparer(generated, reference);
+            TS_ASSERT(comparer.CompareFiles());
+        }
+    }
+};
+
+#endif /*TESTBATCHEDODESOLVERMODIFIER_HPP_*/
@@ -0,0 +1,240 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTCELLBASEDBENCHMARKS_HPP_
+#define TESTCELLBASEDBENCHMARKS_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+// Must be included before other cell_based headers
+#include "CellBasedSimulationArchiver.hpp"
+
+#include "AbstractCellBasedTestSuite.hpp"
+#include "BenchmarkRecorder.hpp"
+#include "CellsGenerator.hpp"
+#include "DifferentiatedCellProliferativeType.hpp"
+#include "FarhadifarForce.hpp"
+#include "NoCellCycleModel.hpp"
+#include "NodeBasedCellPopulation.hpp"
+#include "OffLatticeSimulation.hpp"
+#include "OnLatticeSimulation.hpp"
+#include "PlaneBoundaryCondition.hpp"
+#include "PottsBasedCellPopulation.hpp"
+#include "PottsMeshGenerator.hpp"
+#include "RepulsionForce.hpp"
+#include "SmartPointers.hpp"
+#include "TargetAreaLinearGrowthModifier.hpp"
+#include "TransitCellProliferativeType.hpp"
+#include "UniformCellCycleModel.hpp"
+#include "VertexBasedCellPopulation.hpp"
+#include "VolumeConstraintPottsUpdateRule.hpp"
+#include "AdhesionPottsUpdateRule.hpp"
+#include "VoronoiVertexMeshGenerator.hpp"
+
+#include "PetscSetupAndFinalize.hpp"
+
+/**
+ * Benchmarks of the main cell-based simulation types, for tracking performance and scaling.
+ *
+ * Problem sizes are taken from the command line:
+ *   -benchmark_size N      number of cells across the domain in each direction (default 10)
+ *   -benchmark_end_time T  simulated time in hours (default 10)
+ *
+ * Results are written to $CHASTE_TEST_OUTPUT/Benchmarks/cell_based.json
+ * (see BenchmarkRecorder for how to change this). Only the node-based
+ * benchmark runs in parallel.
+ */
+class TestCellBasedBenchmarks : public AbstractCellBasedTestSuite
+{
+private:
+    /** Records the timings of all the benchmarks in this suite. */
+    BenchmarkRecorder mRecorder;
+
+public:
+    TestCellBasedBenchmarks()
+        : mRecorder("cell_based")
+    {
+    }
+
+    void TestNodeBasedBenchmark()
+    {
+        const unsigned cells_across = BenchmarkRecorder::GetUnsignedOption("-benchmark_size", 10u);
+        const unsigned end_time = BenchmarkRecorder::GetUnsignedOption("-benchmark_end_time", 10u);
+
+        // A cube of proliferating cells, restricted to the positive octant
+        std::vector<Node<3>*> nodes;
+        unsigned index = 0;
+        for (unsigned i=0; i<cells_across; i++)
+        {
+            for (unsigned j=0; j<cells_across; j++)
+            {
+                for (unsigned k=0; k<cells_across; k++)
+                {
+                    nodes.push_back(new Node<3>(index++, false, 0.8*i, 0.8*j, 0.8*k));
+                }
+            }
+        }
+
+        mRecorder.StartBenchmark("NodeBased3d");
+        NodesOnlyMesh<3> mesh;
+        mesh.ConstructNodesWithoutMesh(nodes, 1.5);
+
+        std::vector<CellPtr> cells;
+        MAKE_PTR(TransitCellProliferativeType, p_transit_type);
+        CellsGenerator<UniformCellCycleModel, 3> cells_generator;
+        cells_generator.GenerateBasicRandom(cells, mesh.GetNumNodes(), p_transit_type);
+
+        NodeBasedCellPopulation<3> cell_population(mesh, cells);
+
+        OffLatticeSimulation<3> simulator(cell_population);
+        simulator.SetOutputDirectory("BenchmarkNodeBased");
+        simulator.SetSamplingTimestepMultiple(120);
+        simulator.SetEndTime(end_time);
+
+        MAKE_PTR(RepulsionForce<3>, p_force);
+        p_force->SetCutOffLength(1.5);
+        simulator.AddForce(p_force);
+
+        for (unsigned dim=0; dim<3; dim++)
+        {
+            MAKE_PTR_ARGS(PlaneBoundaryCondition<3>, p_boundary_condition, (&cell_population, zero_vector<double>(3), -unit_vector<double>(3,dim)));
+            simulator.AddCellPopulationBoundaryCondition(p_boundary_condition);
+        }
+
+        simulator.Solve();
+        mRecorder.StopBenchmark();
+
+        mRecorder.AddParameter("size", cells_across);
+        mRecorder.AddParameter("num_initial_cells", cells_across*cells_across*cells_across);
+        // Each process only owns some of the cells when run in parallel
+        unsigned num_local_cells = cell_population.GetNumRealCells();
+        unsigned num_final_cells = 0;
+        MPI_Allreduce(&num_local_cells, &num_final_cells, 1, MPI_UNSIGNED, MPI_SUM, PetscTools::GetWorld());
+        mRecorder.AddParameter("num_final_cells", num_final_cells);
+        mRecorder.AddParameter("end_time", end_time);
+        mRecorder.WriteJson();
+
+        for (unsigned i=0; i<nodes.size(); i++)
+        {
+            delete nodes[i];
+        }
+    }
+
+    void TestVertexBasedBenchmark()
+    {
+        EXIT_IF_PARALLEL;
+
+        const unsigned cells_across = BenchmarkRecorder::GetUnsignedOption("-benchmark_size", 10u);
+        const unsigned end_time = BenchmarkRecorder::GetUnsignedOption("-benchmark_end_time", 10u);
+
+        mRecorder.StartBenchmark("VertexBased2d");
+        VoronoiVertexMeshGenerator mesh_generator(cells_across, cells_across, 1, 1.0);
+        MutableVertexMesh<2,2>* p_mesh = mesh_generator.GetMesh();
+
+        std::vector<CellPtr> cells;
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_differentiated_type);
+        CellsGenerator<NoCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasicRandom(cells, p_mesh->GetNumElements(), p_differentiated_type);
+
+        VertexBasedCellPopulation<2> cell_population(*p_mesh, cells);
+        for (AbstractCellPopulation<2>::Iterator cell_iter = cell_population.Begin();
+             cell_iter != cell_population.End();
+             ++cell_iter)
+        {
+            cell_iter->GetCellData()->SetItem("target area", 1.0);
+        }
+
+        OffLatticeSimulation<2> simulator(cell_population);
+        simulator.SetOutputDirectory("BenchmarkVertexBased");
+        simulator.SetSamplingTimestepMultiple(100);
+        simulator.SetDt(0.01);
+        simulator.SetEndTime(end_time);
+
+        MAKE_PTR(FarhadifarForce<2>, p_force);
+        simulator.AddForce(p_force);
+        MAKE_PTR(TargetAreaLinearGrowthModifier<2>, p_growth_modifier);
+        simulator.AddSimulationModifier(p_growth_modifier);
+
+        simulator.Solve();
+        mRecorder.StopBenchmark();
+
+        mRecorder.AddParameter("size", cells_across);
+        mRecorder.AddParameter("num_cells", cell_population.GetNumRealCells());
+        mRecorder.AddParameter("end_time", end_time);
+        mRecorder.WriteJson();
+    }
+
+    void TestPottsBasedBenchmark()
+    {
+        EXIT_IF_PARALLEL;
+
+        const unsigned cells_across = BenchmarkRecorder::GetUnsignedOption("-benchmark_size", 10u);
+        const unsigned end_time = BenchmarkRecorder::GetUnsignedOption("-benchmark_end_time", 10u);
+
+        mRecorder.StartBenchmark("PottsBased2d");
+        PottsMeshGenerator<2> generator(6*cells_across, cells_across, 4, 6*cells_across, cells_across, 4);
+        PottsMesh<2>* p_mesh = generator.GetMesh();
+
+        std::vector<CellPtr> cells;
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_diff_type);
+        CellsGenerator<NoCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasicRandom(cells, p_mesh->GetNumElements(), p_diff_type);
+
+        PottsBasedCellPopulation<2> cell_population(*p_mesh, cells);
+
+        OnLatticeSimulation<2> simulator(cell_population);
+        simulator.SetOutputDirectory("BenchmarkPottsBased");
+        simulator.SetSamplingTimestepMultiple(100);
+        simulator.SetDt(0.1);
+        simulator.SetEndTime(end_time);
+
+        MAKE_PTR(VolumeConstraintPottsUpdateRule<2>, p_volume_constraint_update_rule);
+        p_volume_constraint_update_rule->SetMatureCellTargetVolume(16);
+        p_volume_constraint_update_rule->SetDeformationEnergyParameter(0.2);
+        simulator.AddUpdateRule(p_volume_constraint_update_rule);
+        MAKE_PTR(AdhesionPottsUpdateRule<2>, p_adhesion_update_rule);
+        simulator.AddUpdateRule(p_adhesion_update_rule);
+
+        simulator.Solve();
+        mRecorder.StopBenchmark();
+
+        mRecorder.AddParameter("size", cells_across);
+        mRecorder.AddParameter("num_cells", cell_population.GetNumRealCells());
+        mRecorder.AddParameter("end_time", end_time);
+        mRecorder.WriteJson();
+    }
+};
+
+#endif /*TESTCELLBASEDBENCHMARKS_HPP_*/
@@ -66,6 +66,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PopulationTestingForce.hpp"
 #include "PlaneBoundaryCondition.hpp"
 #include "ForwardEulerNumericalMethod.hpp"
+#include "RK23NumericalMethod.hpp"
+#include "BackwardEulerNumericalMethod.hpp"
+#include "StepSizeException.hpp"
 #include "Warnings.hpp"
 
 
@@ -542,6 +545,162 @@ public:
         }
     }
 
+    void TestUpdateAllNodePositionsWithRK23AndBackwardEuler()
+    {
+        // Create a simple mesh
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/square_4_elements");
+        MutableMesh<2,2> mesh;
+        mesh.ConstructFromMeshReader(mesh_reader);
+
+        // Create cells
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedG1GenerationalCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, mesh.GetNumNodes());
+
+        // Create a cell population
+        MeshBasedCellPopulation<2> cell_population(mesh, cells);
+        cell_population.SetDampingConstantNormal(1.1);
+
+        // Create a force collection with a force that depends linearly on node locations
+        std::vector<boost::shared_ptr<AbstractForce<2,2> > > force_collection;
+        MAKE_PTR_ARGS(PopulationTestingForce<2>, p_test_force, (true));
+        force_collection.push_back(p_test_force);
+
+        // Create numerical methods for testing
+        MAKE_PTR(RK23NumericalMethod<2>, p_rk23_method);
+        p_rk23_method->SetCellPopulation(&cell_population);
+        p_rk23_method->SetForceCollection(&force_collection);
+
+        MAKE_PTR(BackwardEulerNumericalMethod<2>, p_be_method);
+        p_be_method->SetCellPopulation(&cell_population);
+        p_be_method->SetForceCollection(&force_collection);
+
+        double dt = 0.01;
+        unsigned num_nodes = cell_population.GetNumNodes();
+
+        // Test RK23, with error control that accepts the step
+        p_rk23_method->SetUseAdaptiveTimestep(true);
+        std::vector<c_vector<double, 2> > old_posns(num_nodes);
+        for (unsigned j=0; j<num_nodes; j++)
+        {
+            old_posns[j] = cell_population.GetNode(j)->rGetLocation();
+        }
+
+        p_rk23_method->UpdateAllNodePositions(dt);
+
+        for (unsigned j=0; j<num_nodes; j++)
+        {
+            c_vector<double, 2> actualLocation = cell_population.GetNode(j)->rGetLocation();
+
+            double damping =  cell_population.GetDampingConstant(j);
+            c_vector<double, 2> expectedLocation;
+            expectedLocation = p_test_force->GetExpectedOneStepLocationRK23(j, damping, old_posns[j], dt);
+
+            TS_ASSERT_DELTA(norm_2(actualLocation - expectedLocation), 0, 1e-12);
+        }
+
+        // Test backward Euler, for which a single Newton iteration is exact for this force
+        for (unsigned j=0; j<num_nodes; j++)
+        {
+            old_posns[j] = cell_population.GetNode(j)->rGetLocation();
+        }
+
+        p_be_method->UpdateAllNodePositions(dt);
+
+        for (unsigned j=0; j<num_nodes; j++)
+        {
+            c_vector<double, 2> actualLocation = cell_population.GetNode(j)->rGetLocation();
+
+            double damping =  cell_population.GetDampingConstant(j);
+            c_vector<double, 2> expectedLocation;
+            expectedLocation = p_test_force->GetExpectedOneStepLocationBE(j, damping, old_posns[j], dt);
+
+            TS_ASSERT_DELTA(norm_2(actualLocation - expectedLocation), 0, 1e-6);
+        }
+
+        // A large step with a tight tolerance should be rejected, suggesting a smaller step
+        p_rk23_method->SetAbsoluteTolerance(1e-12);
+        TS_ASSERT_DELTA(p_rk23_method->GetAbsoluteTolerance(), 1e-12, 1e-18);
+        double large_dt = 10.0;
+        try
+        {
+            p_rk23_method->UpdateAllNodePositions(large_dt);
+            TS_FAIL("A StepSizeException should have been thrown");
+        }
+        catch (StepSizeException& e)
+        {
+            TS_ASSERT(!e.IsTerminal());
+            TS_ASSERT_LESS_THAN(e.GetSuggestedNewStep(), large_dt);
+        }
+
+        TS_ASSERT_THROWS_THIS(p_rk23_method->SetAbsoluteTolerance(0.0), "The absolute tolerance must be positive");
+
+        // Test the backward Euler parameters
+        TS_ASSERT_EQUALS(p_be_method->GetMaxNewtonIterations(), 1u);
+        TS_ASSERT_EQUALS(p_be_method->GetMaxLinearIterations(), 20u);
+        TS_ASSERT_DELTA(p_be_method->GetLinearSolverRelativeTolerance(), 1e-6, 1e-12);
+        p_be_method->SetMaxNewtonIterations(3);
+        p_be_method->SetMaxLinearIterations(50);
+        p_be_method->SetLinearSolverRelativeTolerance(1e-8);
+        TS_ASSERT_EQUALS(p_be_method->GetMaxNewtonIterations(), 3u);
+        TS_ASSERT_EQUALS(p_be_method->GetMaxLinearIterations(), 50u);
+        TS_ASSERT_DELTA(p_be_method->GetLinearSolverRelativeTolerance(), 1e-8, 1e-14);
+        TS_ASSERT_THROWS_THIS(p_be_method->SetLinearSolverRelativeTolerance(-1.0),
+                              "The linear solver relative tolerance must be positive");
+    }
+
+    void TestBackwardEulerWithNonPositiveCurvature()
+    {
+        // Create a small mesh, so that large steps give small displacements
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/square_4_elements");
+        MutableMesh<2,2> mesh;
+        mesh.ConstructFromMeshReader(mesh_reader);
+        mesh.Scale(0.1, 0.1);
+
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedG1GenerationalCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, mesh.GetNumNodes());
+
+        MeshBasedCellPopulation<2> cell_population(mesh, cells);
+        cell_population.SetDampingConstantNormal(0.008);
+
+        std::vector<boost::shared_ptr<AbstractForce<2,2> > > force_collection;
+        MAKE_PTR_ARGS(PopulationTestingForce<2>, p_test_force, (true));
+        force_collection.push_back(p_test_force);
+
+        MAKE_PTR(BackwardEulerNumericalMethod<2>, p_be_method);
+        p_be_method->SetCellPopulation(&cell_population);
+        p_be_method->SetForceCollection(&force_collection);
+
+        /*
+         * The test force pushes nodes away from the origin, with a stiffness that grows with the
+         * node index. For this step size the stiffness exceeds damping/dt at every node that moves,
+         * so the first conjugate gradient iteration meets non-positive curvature. The method should
+         * then fall back to the forward Euler step rather than leave the nodes where they are.
+         */
+        double dt = 1.0;
+        unsigned num_nodes = cell_population.GetNumNodes();
+        std::vector<c_vector<double, 2> > old_posns(num_nodes);
+        for (unsigned j=0; j<num_nodes; j++)
+        {
+            old_posns[j] = cell_population.GetNode(j)->rGetLocation();
+        }
+
+        p_be_method->UpdateAllNodePositions(dt);
+
+        for (unsigned j=0; j<num_nodes; j++)
+        {
+            c_vector<double, 2> actualLocation = cell_population.GetNode(j)->rGetLocation();
+
+            double damping = cell_population.GetDampingConstant(j);
+            c_vector<double, 2> expectedLocation;
+            expectedLocation = p_test_force->GetExpectedOneStepLocationFE(j, damping, old_posns[j], dt);
+
+            TS_ASSERT_DELTA(norm_2(actualLocation - expectedLocation), 0, 1e-12);
+        }
+        TS_ASSERT_DELTA(cell_population.GetNode(4)->rGetLocation()[1], 0.55, 1e-12);
+    }
+
     void TestSettingAndGettingFlags()
     {
         // Create numerical methods for testing
@@ -1135,6 +1135,81 @@ public:
         delete p_simulator2;
     }
 
+    void TestSaveAndLoadBinaryAndTextArchives()
+    {
+        EXIT_IF_PARALLEL;    // Cell based archiving doesn't work in parallel.
+
+        // Create a simple mesh
+        HoneycombMeshGenerator generator(4, 4, 0);
+        TetrahedralMesh<2,2>* p_generating_mesh = generator.GetMesh();
+
+        // Convert this to a NodesOnlyMesh
+        NodesOnlyMesh<2> mesh;
+        mesh.ConstructNodesWithoutMesh(*p_generating_mesh, 1.5);
+
+        // Create cells
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedG1GenerationalCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasicRandom(cells, mesh.GetNumNodes());
+
+        // Create a node based cell population
+        NodeBasedCellPopulation<2> node_based_cell_population(mesh, cells);
+
+        // Set up cell-based simulation
+        OffLatticeSimulation<2> simulator(node_based_cell_population);
+        simulator.SetEndTime(0.1);
+
+        // Create a force law and pass it to the simulation
+        MAKE_PTR(GeneralisedLinearSpringForce<2>, p_linear_force);
+        p_linear_force->SetCutOffLength(1.5);
+        simulator.AddForce(p_linear_force);
+
+        // Solve, then record the state of the simulation
+        simulator.SetOutputDirectory("TestOffLatticeSimulationWithNodeBasedCellPopulationBinaryArchive");
+        simulator.Solve();
+
+        unsigned num_cells = simulator.rGetCellPopulation().GetNumRealCells();
+        unsigned num_nodes = simulator.rGetCellPopulation().GetNumNodes();
+        std::vector<std::vector<double> > node_locations;
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            node_locations.push_back(simulator.GetNodeLocation(i));
+        }
+
+        // Save the simulation in a binary archive, and then in a text archive
+        CellBasedSimulationArchiver<2, OffLatticeSimulation<2> >::Save(&simulator, true);
+        simulator.SetOutputDirectory("TestOffLatticeSimulationWithNodeBasedCellPopulationTextArchive");
+        CellBasedSimulationArchiver<2, OffLatticeSimulation<2> >::Save(&simulator);
+
+        FileFinder binary_archive("TestOffLatticeSimulationWithNodeBasedCellPopulationBinaryArchive/archive/cell_population_sim_at_time_0.1.arch",
+                                  RelativeTo::ChasteTestOutput);
+        FileFinder text_archive("TestOffLatticeSimulationWithNodeBasedCellPopulationTextArchive/archive/cell_population_sim_at_time_0.1.arch",
+                                RelativeTo::ChasteTestOutput);
+        TS_ASSERT_EQUALS(ArchiveLocationInfo::IsBinaryArchiveFile(binary_archive), true);
+        TS_ASSERT_EQUALS(ArchiveLocationInfo::IsBinaryArchiveFile(text_archive), false);
+
+        // Load each archive, detecting its format, and check that the state is restored
+        std::vector<std::string> archive_directories;
+        archive_directories.push_back("TestOffLatticeSimulationWithNodeBasedCellPopulationBinaryArchive");
+        archive_directories.push_back("TestOffLatticeSimulationWithNodeBasedCellPopulationTextArchive");
+        for (unsigned i=0; i<archive_directories.size(); i++)
+        {
+            OffLatticeSimulation<2>* p_simulator = CellBasedSimulationArchiver<2, OffLatticeSimulation<2> >::Load(archive_directories[i], 0.1);
+
+            TS_ASSERT_DELTA(SimulationTime::Instance()->GetTime(), 0.1, 1e-12);
+            TS_ASSERT_EQUALS(p_simulator->rGetCellPopulation().GetNumRealCells(), num_cells);
+            TS_ASSERT_EQUALS(p_simulator->rGetCellPopulation().GetNumNodes(), num_nodes);
+            for (unsigned node_index=0; node_index<num_nodes; node_index++)
+            {
+                std::vector<double> node_location = p_simulator->GetNodeLocation(node_index);
+                TS_ASSERT_DELTA(node_location[0], node_locations[node_index][0], 1e-12);
+                TS_ASSERT_DELTA(node_location[1], node_locations[node_index][1], 1e-12);
+            }
+
+            delete p_simulator;
+        }
+    }
+
     /**
      * Create a simulation of a NodeBasedCellPopulation to test movement threshold.
      */
@@ -52,6 +52,27 @@ double CellBetaCateninWriter<ELEMENT_DIM, SPACE_DIM>::GetCellDataForVtkOutput(Ce
     return b_cat_cytoplasm;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+std::vector<std::string> CellBetaCateninWriter<ELEMENT_DIM, SPACE_DIM>::GetColumnNames()
+{
+    std::vector<std::string> column_names;
+    column_names.push_back("Beta catenin membrane");
+    column_names.push_back("Beta catenin cytoplasm");
+    column_names.push_back("Beta catenin nuclear");
+    return column_names;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellBetaCateninWriter<ELEMENT_DIM, SPACE_DIM>::GetColumnDataForCell(CellPtr pCell,
+                                                                         AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                                                                         std::vector<double>& rValues)
+{
+    AbstractVanLeeuwen2009WntSwatCellCycleModel* p_model = dynamic_cast<AbstractVanLeeuwen2009WntSwatCellCycleModel*>(pCell->GetCellCycleModel());
+    rValues[0] = p_model->GetMembraneBoundBetaCateninLevel();
+    rValues[1] = p_model->GetCytoplasmicBetaCateninLevel();
+    rValues[2] = p_model->GetNuclearBetaCateninLevel();
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void CellBetaCateninWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation)
 {
@@ -87,6 +87,28 @@ public:
      */
     double GetCellDataForVtkOutput(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation);
 
+    /**
+     * Overridden GetColumnNames() method.
+     *
+     * The columns are the membrane-bound, cytoplasmic and nuclear beta-catenin levels, as in the text output.
+     *
+     * @return the column names
+     */
+    std::vector<std::string> GetColumnNames();
+
+    /**
+     * Overridden GetColumnDataForCell() method.
+     *
+     * Get the cell's membrane-bound, cytoplasmic and nuclear beta-catenin levels.
+     *
+     * @param pCell a cell
+     * @param pCellPopulation a pointer to the cell population owning the cell
+     * @param rValues filled in with the values
+     */
+    void GetColumnDataForCell(CellPtr pCell,
+                              AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                              std::vector<double>& rValues);
+
     /**
      * Overridden VisitCell() method.
      * Visit a cell and write its data.
@@ -0,0 +1,263 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "CounterBasedRandomNumberGenerator.hpp"
+
+#include <cassert>
+#include <cmath>
+
+/** The multipliers and key increments ("Weyl constants") of Philox4x32. */
+static const boost::uint32_t PHILOX_M0 = 0xD2511F53u;
+/** @see PHILOX_M0 */
+static const boost::uint32_t PHILOX_M1 = 0xCD9E8D57u;
+/** @see PHILOX_M0 */
+static const boost::uint32_t PHILOX_W0 = 0x9E3779B9u;
+/** @see PHILOX_M0 */
+static const boost::uint32_t PHILOX_W1 = 0xBB67AE85u;
+
+///////////////////////////////////////////////////////////////////////////////////
+// CounterBasedRandomStream
+///////////////////////////////////////////////////////////////////////////////////
+
+CounterBasedRandomStream::CounterBasedRandomStream(unsigned seed, unsigned streamId, unsigned step, unsigned purpose)
+    : mBlockPosition(4u),
+      mHasCachedNormal(false),
+      mCachedNormal(0.0)
+{
+    mKey[0] = seed;
+    mKey[1] = 0u;
+
+    mCounter[0] = 0u;
+    mCounter[1] = streamId;
+    mCounter[2] = step;
+    mCounter[3] = purpose;
+}
+
+void CounterBasedRandomStream::Philox4x32(const boost::uint32_t* pCounter, const boost::uint32_t* pKey, boost::uint32_t* pOutput)
+{
+    boost::uint32_t ctr[4] = {pCounter[0], pCounter[1], pCounter[2], pCounter[3]};
+    boost::uint32_t key[2] = {pKey[0], pKey[1]};
+
+    for (unsigned round = 0; round < 10; round++)
+    {
+        if (round > 0)
+        {
+            key[0] += PHILOX_W0;
+            key[1] += PHILOX_W1;
+        }
+
+        boost::uint64_t product0 = static_cast<boost::uint64_t>(PHILOX_M0) * ctr[0];
+        boost::uint64_t product1 = static_cast<boost::uint64_t>(PHILOX_M1) * ctr[2];
+        boost::uint32_t hi0 = static_cast<boost::uint32_t>(product0 >> 32);
+        boost::uint32_t lo0 = static_cast<boost::uint32_t>(product0);
+        boost::uint32_t hi1 = static_cast<boost::uint32_t>(product1 >> 32);
+        boost::uint32_t lo1 = static_cast<boost::uint32_t>(product1);
+
+        ctr[0] = hi1 ^ ctr[1] ^ key[0];
+        ctr[1] = lo1;
+        ctr[2] = hi0 ^ ctr[3] ^ key[1];
+        ctr[3] = lo0;
+    }
+
+    for (unsigned i = 0; i < 4; i++)
+    {
+        pOutput[i] = ctr[i];
+    }
+}
+
+boost::uint32_t CounterBasedRandomStream::NextWord()
+{
+    if (mBlockPosition == 4u)
+    {
+        Philox4x32(mCounter, mKey, mBlock);
+        mCounter[0]++;
+        mBlockPosition = 0u;
+    }
+    return mBlock[mBlockPosition++];
+}
+
+double CounterBasedRandomStream::WordsToUnitReal(boost::uint32_t high, boost::uint32_t low)
+{
+    // 27 + 26 = 53 random bits; adding one maps [0, 2^53) onto (0, 2^53]
+    const double two_to_minus_53 = 1.0 / 9007199254740992.0;
+    boost::uint64_t bits = (static_cast<boost::uint64_t>(high >> 5) << 26) + (low >> 6) + 1u;
+    return static_cast<double>(bits) * two_to_minus_53;
+}
+
+double CounterBasedRandomStream::ranf()
+{
+    boost::uint32_t high = NextWord();
+    boost::uint32_t low = NextWord();
+    return WordsToUnitReal(high, low);
+}
+
+double CounterBasedRandomStream::StandardNormalRandomDeviate()
+{
+    if (mHasCachedNormal)
+    {
+        mHasCachedNormal = false;
+        return mCachedNormal;
+    }
+
+    // Box-Muller transform; ranf() never returns 0, so the logarithm is finite
+    double radius = sqrt(-2.0 * log(ranf()));
+    double angle = 2.0 * M_PI * ranf();
+
+    mCachedNormal = radius * sin(angle);
+    mHasCachedNormal = true;
+    return radius * cos(angle);
+}
+
+double CounterBasedRandomStream::NormalRandomDeviate(double mean, double stdDev)
+{
+    return stdDev * StandardNormalRandomDeviate() + mean;
+}
+
+double CounterBasedRandomStream::ExponentialRandomDeviate(double scale)
+{
+    assert(scale > 0.0);
+    return -log(ranf()) / scale;
+}
+
+unsigned CounterBasedRandomStream::randMod(unsigned base)
+{
+    assert(base > 0u);
+
+    // Lemire's multiply-and-reject method, which avoids the bias of taking a remainder
+    boost::uint64_t product = static_cast<boost::uint64_t>(NextWord()) * base;
+    boost::uint32_t low = static_cast<boost::uint32_t>(product);
+    if (low < base)
+    {
+        boost::uint32_t threshold = (0u - base) % base;
+        while (low < threshold)
+        {
+            product = static_cast<boost::uint64_t>(NextWord()) * base;
+            low = static_cast<boost::uint32_t>(product);
+        }
+    }
+    return static_cast<unsigned>(product >> 32);
+}
+
+void CounterBasedRandomStream::FillUniform(std::vector<double>& rValues)
+{
+    unsigned num_values = rValues.size();
+    unsigned index = 0;
+
+    // Use up any words left over from a previous call before generating whole blocks
+    while (index < num_values && mBlockPosition != 0u && mBlockPosition != 4u)
+    {
+        rValues[index++] = ranf();
+    }
+
+    // Each block of four words gives two numbers
+    boost::uint32_t block[4];
+    for (; index + 1 < num_values; index += 2)
+    {
+        Philox4x32(mCounter, mKey, block);
+        mCounter[0]++;
+        rValues[index] = WordsToUnitReal(block[0], block[1]);
+        rValues[index + 1] = WordsToUnitReal(block[2], block[3]);
+    }
+
+    if (index < num_values)
+    {
+        rValues[index] = ranf();
+    }
+}
+
+void CounterBasedRandomStream::FillStandardNormal(std::vector<double>& rValues)
+{
+    mHasCachedNormal = false;
+
+    unsigned num_values = rValues.size();
+    std::vector<double> uniforms(num_values + (num_values % 2));
+    FillUniform(uniforms);
+
+    for (unsigned index = 0; index < num_values; index += 2)
+    {
+        double radius = sqrt(-2.0 * log(uniforms[index]));
+        double angle = 2.0 * M_PI * uniforms[index + 1];
+        rValues[index] = radius * cos(angle);
+        if (index + 1 < num_values)
+        {
+            rValues[index + 1] = radius * sin(angle);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// CounterBasedRandomNumberGenerator
+///////////////////////////////////////////////////////////////////////////////////
+
+CounterBasedRandomNumberGenerator* CounterBasedRandomNumberGenerator::mpInstance = nullptr;
+
+CounterBasedRandomNumberGenerator::CounterBasedRandomNumberGenerator()
+    : mSeed(0u)
+{
+    assert(mpInstance == nullptr); // Ensure correct serialization
+}
+
+CounterBasedRandomNumberGenerator* CounterBasedRandomNumberGenerator::Instance()
+{
+    if (mpInstance == nullptr)
+    {
+        mpInstance = new CounterBasedRandomNumberGenerator();
+    }
+    return mpInstance;
+}
+
+void CounterBasedRandomNumberGenerator::Destroy()
+{
+    if (mpInstance)
+    {
+        delete mpInstance;
+        mpInstance = nullptr;
+    }
+}
+
+void CounterBasedRandomNumberGenerator::Reseed(unsigned seed)
+{
+    mSeed = seed;
+}
+
+unsigned CounterBasedRandomNumberGenerator::GetSeed() const
+{
+    return mSeed;
+}
+
+CounterBasedRandomStream CounterBasedRandomNumberGenerator::GetStream(unsigned streamId, unsigned step, unsigned purpose) const
+{
+    return CounterBasedRandomStream(mSeed, streamId, step, purpose);
+}
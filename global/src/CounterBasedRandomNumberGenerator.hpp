@@ -0,0 +1,261 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef COUNTERBASEDRANDOMNUMBERGENERATOR_HPP_
+#define COUNTERBASEDRANDOMNUMBERGENERATOR_HPP_
+
+#include <vector>
+#include <boost/cstdint.hpp>
+
+#include "ChasteSerialization.hpp"
+#include "SerializableSingleton.hpp"
+
+/**
+ * A single stream of random numbers from the counter-based Philox4x32-10 generator
+ * (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11).
+ *
+ * Unlike RandomNumberGenerator, a stream has no hidden state beyond a 128-bit
+ * counter and a 64-bit key: the n-th number drawn from the stream with a given
+ * seed, stream identifier, time step and purpose is a pure function of those
+ * values. Streams for different cells (or nodes), time steps or purposes are
+ * statistically independent, so they may be created and consumed in any order,
+ * on any process, and still give reproducible results.
+ *
+ * Streams are cheap to construct and are intended to be created when needed,
+ * via CounterBasedRandomNumberGenerator::GetStream(), rather than stored. For
+ * this reason they are not serializable; only the seed needs to be archived.
+ */
+class CounterBasedRandomStream
+{
+private:
+
+    /** The key of the Philox bijection (derived from the seed). */
+    boost::uint32_t mKey[2];
+
+    /**
+     * The counter. Word 0 counts blocks drawn from this stream; words 1-3 hold
+     * the stream identifier, time step and purpose respectively.
+     */
+    boost::uint32_t mCounter[4];
+
+    /** The most recently generated block of four 32-bit random words. */
+    boost::uint32_t mBlock[4];
+
+    /** Index of the next unused word in mBlock (4 when the block is exhausted). */
+    unsigned mBlockPosition;
+
+    /** Whether mCachedNormal holds the second deviate of a Box-Muller pair. */
+    bool mHasCachedNormal;
+
+    /** The cached second deviate of a Box-Muller pair. */
+    double mCachedNormal;
+
+    /**
+     * @return the next 32-bit random word of the stream.
+     */
+    boost::uint32_t NextWord();
+
+    /**
+     * Convert two 32-bit random words to a double in (0,1] with 53 random bits.
+     *
+     * @param high the word supplying the upper 27 bits
+     * @param low the word supplying the lower 26 bits
+     * @return a uniform random number in (0,1]
+     */
+    static double WordsToUnitReal(boost::uint32_t high, boost::uint32_t low);
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param seed the seed of the generator family
+     * @param streamId an identifier for the stream, such as a cell ID or node index
+     * @param step a second identifier, such as the time step number (defaults to 0)
+     * @param purpose a third identifier, distinguishing different uses of random
+     *     numbers for the same stream and step (defaults to 0)
+     */
+    CounterBasedRandomStream(unsigned seed, unsigned streamId, unsigned step=0u, unsigned purpose=0u);
+
+    /**
+     * @return Generate a uniform random number in (0,1].
+     */
+    double ranf();
+
+    /**
+     * @return a random number from the normal distribution with mean 0
+     * and standard deviation 1.
+     */
+    double StandardNormalRandomDeviate();
+
+    /**
+     * @return Generate a random number from a normal distribution with given
+     * mean and standard deviation.
+     *
+     * @param mean the mean of the normal distribution from which the random number is drawn
+     * @param stdDev the standard deviation of the normal distribution from which the random number is drawn
+     */
+    double NormalRandomDeviate(double mean, double stdDev);
+
+    /**
+     * @return Generate a random number from an exponential distribution with specified rate parameter.
+     *
+     * @param scale The rate parameter of the exponential distribution, often named lambda
+     *     (as in RandomNumberGenerator::ExponentialRandomDeviate())
+     */
+    double ExponentialRandomDeviate(double scale);
+
+    /**
+     * @return Generate an unbiased random integer within the range [0, base).
+     *
+     * @param base the number of possible values; must be positive
+     */
+    unsigned randMod(unsigned base);
+
+    /**
+     * Fill a vector with uniform random numbers in (0,1]. This is equivalent to
+     * calling ranf() rValues.size() times, but avoids the per-call overhead.
+     *
+     * @param rValues the vector to fill (its size determines how many numbers are drawn)
+     */
+    void FillUniform(std::vector<double>& rValues);
+
+    /**
+     * Fill a vector with standard normal random numbers, generated in pairs by
+     * the Box-Muller transform. Any deviate cached by StandardNormalRandomDeviate()
+     * is discarded.
+     *
+     * @param rValues the vector to fill (its size determines how many numbers are drawn)
+     */
+    void FillStandardNormal(std::vector<double>& rValues);
+
+    /**
+     * Apply the Philox4x32-10 bijection to a single counter.
+     *
+     * @param pCounter the four counter words
+     * @param pKey the two key words
+     * @param pOutput the four output words (may not alias pCounter)
+     */
+    static void Philox4x32(const boost::uint32_t* pCounter, const boost::uint32_t* pKey, boost::uint32_t* pOutput);
+};
+
+/**
+ * A special singleton class holding the seed of the counter-based random number
+ * generator family, from which independent CounterBasedRandomStream objects are
+ * obtained. It complements RandomNumberGenerator for code that draws random
+ * numbers per cell, per node or per process, where the result should not depend
+ * on the order in which entities are visited or on how they are distributed.
+ *
+ * This class is a singleton and an instance should be retrieved with:
+ * CounterBasedRandomNumberGenerator* p_gen = CounterBasedRandomNumberGenerator::Instance();
+ *
+ * It is archived in the same way as RandomNumberGenerator, through the object
+ * returned by GetSerializationWrapper().
+ */
+class CounterBasedRandomNumberGenerator : public SerializableSingleton<CounterBasedRandomNumberGenerator>
+{
+private:
+
+    /** The seed from which all streams are derived. */
+    unsigned mSeed;
+
+    /** Pointer to the single instance. */
+    static CounterBasedRandomNumberGenerator* mpInstance;
+
+    friend class boost::serialization::access;
+    /**
+     * Archive the seed.
+     *
+     * @note do not serialize this singleton directly.  Instead, serialize
+     * the object returned by GetSerializationWrapper().
+     *
+     * @param archive the archive
+     * @param version the current version of this class
+     */
+    template<class Archive>
+    void serialize(Archive & archive, const unsigned int version)
+    {
+        archive & mSeed;
+    }
+
+protected:
+
+    /**
+     * Protected constructor.
+     * Use Instance() to access the generator.
+     */
+    CounterBasedRandomNumberGenerator();
+
+public:
+
+    /**
+     * @return a pointer to the generator object.
+     * The object is created, with seed 0, the first time this method is called.
+     */
+    static CounterBasedRandomNumberGenerator* Instance();
+
+    /**
+     * Destroy the current instance of the generator.
+     * The next call to Instance will create a new instance with seed 0.
+     */
+    static void Destroy();
+
+    /**
+     * Reseed the generator family.
+     *
+     * @param seed the new seed
+     */
+    void Reseed(unsigned seed);
+
+    /**
+     * @return the current seed.
+     */
+    unsigned GetSeed() const;
+
+    /**
+     * Get the stream of random numbers associated with the given identifiers.
+     * Calling this twice with the same arguments (and the same seed) gives two
+     * streams producing identical sequences.
+     *
+     * @param streamId an identifier for the stream, such as a cell ID or node index
+     * @param step a second identifier, such as the time step number (defaults to 0)
+     * @param purpose a third identifier, distinguishing different uses of random
+     *     numbers for the same stream and step (defaults to 0)
+     * @return the stream
+     */
+    CounterBasedRandomStream GetStream(unsigned streamId, unsigned step=0u, unsigned purpose=0u) const;
+};
+
+#endif /*COUNTERBASEDRANDOMNUMBERGENERATOR_HPP_*/
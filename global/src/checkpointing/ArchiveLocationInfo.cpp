@@ -35,6 +35,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ArchiveLocationInfo.hpp"
 
+#include <cctype>
+#include <fstream>
 #include <sstream>
 
 #include "Exception.hpp"
@@ -42,6 +44,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 std::string ArchiveLocationInfo::mDirAbsPath = "";
 std::string ArchiveLocationInfo::mMeshFilename = "mesh";
+std::string ArchiveLocationInfo::mSharedMeshDirAbsPath = "";
+bool ArchiveLocationInfo::mSharedMeshIsWritten = false;
 
 void ArchiveLocationInfo::SetMeshPathname(const FileFinder& rDirectory, const std::string& rFilename)
 {
@@ -123,9 +127,75 @@ std::string ArchiveLocationInfo::GetArchiveRelativePath()
     }
 }
 
+void ArchiveLocationInfo::SetSharedMeshDirectory(const FileFinder& rDirectory, bool meshIsWritten)
+{
+    mSharedMeshDirAbsPath = rDirectory.GetAbsolutePath();
+    if (!(*(mSharedMeshDirAbsPath.end()-1) == '/'))
+    {
+        mSharedMeshDirAbsPath = mSharedMeshDirAbsPath + "/";
+    }
+    mSharedMeshIsWritten = meshIsWritten;
+}
+
+void ArchiveLocationInfo::ClearSharedMeshDirectory()
+{
+    mSharedMeshDirAbsPath = "";
+    mSharedMeshIsWritten = false;
+}
+
+bool ArchiveLocationInfo::IsMeshDirectoryShared()
+{
+    return (mSharedMeshDirAbsPath != "");
+}
+
+bool ArchiveLocationInfo::IsSharedMeshWritten()
+{
+    return mSharedMeshIsWritten;
+}
+
+std::string ArchiveLocationInfo::GetMeshDirectory()
+{
+    if (IsMeshDirectoryShared())
+    {
+        return mSharedMeshDirAbsPath;
+    }
+    return GetArchiveDirectory();
+}
+
+std::string ArchiveLocationInfo::GetMeshRelativePath()
+{
+    if (!IsMeshDirectoryShared())
+    {
+        return GetArchiveRelativePath();
+    }
+
+    std::string chaste_output = OutputFileHandler::GetChasteTestOutputDirectory();
+    std::string::size_type pos = mSharedMeshDirAbsPath.find(chaste_output, 0);
+    if (pos == 0)
+    {
+        return mSharedMeshDirAbsPath.substr(chaste_output.length());
+    }
+    else
+    {
+        return mSharedMeshDirAbsPath;
+    }
+}
+
 bool ArchiveLocationInfo::GetIsDirRelativeToChasteTestOutput()
 {
     std::string chaste_output = OutputFileHandler::GetChasteTestOutputDirectory();
     std::string::size_type pos = mDirAbsPath.find(chaste_output, 0);
     return (pos == 0);
 }
+
+bool ArchiveLocationInfo::IsBinaryArchiveFile(const FileFinder& rArchiveFile)
+{
+    std::string path = rArchiveFile.GetAbsolutePath();
+    std::ifstream archive_file(path.c_str(), std::ios::binary);
+    if (!archive_file.is_open())
+    {
+        EXCEPTION("Cannot open archive file: " + path);
+    }
+    int first_char = archive_file.get();
+    return (first_char == EOF || !std::isdigit(first_char));
+}
@@ -61,9 +61,18 @@ private:
     /** Absolute path for directory that archives are being written to. */
     static std::string mDirAbsPath;
 
-    /** Mesh filename (relative to #mDirAbsPath). */
+    /** Mesh filename (relative to #mDirAbsPath, or to #mSharedMeshDirAbsPath if that is set). */
     static std::string mMeshFilename;
 
+    /**
+     * Absolute path for a directory holding mesh (and fibre) files shared by several archives,
+     * or empty if the mesh files live alongside the archive.
+     */
+    static std::string mSharedMeshDirAbsPath;
+
+    /** Whether the static mesh (and fibre) files are already in #mSharedMeshDirAbsPath. */
+    static bool mSharedMeshIsWritten;
+
 public:
 
     /**
@@ -138,6 +147,62 @@ public:
      * @return true if the directory provided is relative to CHASTE_TEST_OUTPUT.
      */
     static bool GetIsDirRelativeToChasteTestOutput();
+
+    /**
+     * Store mesh files in a directory shared by several archives, rather than alongside each archive.
+     * Static meshes are then only written once.  Call ClearSharedMeshDirectory() when done.
+     *
+     * Whether the files are already there must be decided by the caller, and be the same on every
+     * process, since writing a mesh is a collective operation.
+     *
+     * @param rDirectory  the shared mesh directory
+     * @param meshIsWritten  whether the static mesh and fibre files are already in the shared directory
+     */
+    static void SetSharedMeshDirectory(const FileFinder& rDirectory, bool meshIsWritten=false);
+
+    /**
+     * Go back to storing mesh files alongside the archive.
+     */
+    static void ClearSharedMeshDirectory();
+
+    /**
+     * @return true if mesh files are stored in a directory shared by several archives.
+     */
+    static bool IsMeshDirectoryShared();
+
+    /**
+     * @return true if mesh files are stored in a shared directory which already holds the static
+     *     mesh and fibre files, so that archiving should not write them again.
+     */
+    static bool IsSharedMeshWritten();
+
+    /**
+     * Get the directory that mesh files are being written to or read from.  This is the shared
+     * mesh directory if one has been set, and the archive directory otherwise.
+     * Will always end in a '/'.
+     *
+     * @return full path to directory
+     */
+    static std::string GetMeshDirectory();
+
+    /**
+     * Get the directory that mesh files are being written to, relative to CHASTE_TEST_OUTPUT
+     * (or an absolute path if it is not within CHASTE_TEST_OUTPUT).
+     * Will always end in a '/'.
+     *
+     * @return relative path to directory
+     */
+    static std::string GetMeshRelativePath();
+
+    /**
+     * Determine whether an existing archive file was written with a binary archive
+     * (boost::archive::binary_oarchive) rather than a text archive.  Text archives
+     * start with a printed signature length, whereas binary archives start with raw bytes.
+     *
+     * @param rArchiveFile  the archive file to inspect
+     * @return true if the file holds a binary archive
+     */
+    static bool IsBinaryArchiveFile(const FileFinder& rArchiveFile);
 };
 
 #endif /*ARCHIVELOCATIONINFO_HPP_*/
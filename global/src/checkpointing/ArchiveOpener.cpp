@@ -36,9 +36,12 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // Must be included before any other serialization headers
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 
 #include <sstream>
 #include <fstream>
+#include <type_traits>
 
 #include "ArchiveOpener.hpp"
 #include "ArchiveLocationInfo.hpp"
@@ -46,14 +49,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Exception.hpp"
 #include "OutputFileHandler.hpp"
 
-/**
- * Specialization for input archives.
- * @param rDirectory
- * @param rFileNameBase
- * @param procId
- */
-template<>
-ArchiveOpener<boost::archive::text_iarchive, std::ifstream>::ArchiveOpener(
+template <class Archive, class Stream>
+ArchiveOpener<Archive, Stream>::ArchiveOpener(
         const FileFinder& rDirectory,
         const std::string& rFileNameBase,
         unsigned procId)
@@ -61,6 +58,22 @@ ArchiveOpener<boost::archive::text_iarchive, std::ifstream>::ArchiveOpener(
       mpPrivateStream(nullptr),
       mpCommonArchive(nullptr),
       mpPrivateArchive(nullptr)
+{
+    OpenArchives(rDirectory, rFileNameBase, procId, typename Archive::is_loading());
+}
+
+/**
+ * Open archives for reading.
+ * @param rDirectory
+ * @param rFileNameBase
+ * @param procId
+ */
+template <class Archive, class Stream>
+void ArchiveOpener<Archive, Stream>::OpenArchives(
+        const FileFinder& rDirectory,
+        const std::string& rFileNameBase,
+        unsigned procId,
+        boost::mpl::true_)
 {
     // Figure out where things live
     ArchiveLocationInfo::SetArchiveDirectory(rDirectory);
@@ -69,16 +82,24 @@ ArchiveOpener<boost::archive::text_iarchive, std::ifstream>::ArchiveOpener(
     common_path << ArchiveLocationInfo::GetArchiveDirectory() << rFileNameBase;
 
     // Try to open the main archive for replicated data
-    mpCommonStream = new std::ifstream(common_path.str().c_str(), std::ios::binary);
+    mpCommonStream = new Stream(common_path.str().c_str(), std::ios::binary);
     if (!mpCommonStream->is_open())
     {
         delete mpCommonStream;
         EXCEPTION("Cannot load main archive file: " + common_path.str());
     }
 
+    // Boost doesn't detect a text archive being read as binary (or vice versa) cleanly, so check first
+    bool expect_binary = std::is_same<Archive, boost::archive::binary_iarchive>::value;
+    if (ArchiveLocationInfo::IsBinaryArchiveFile(FileFinder(common_path.str(), RelativeTo::Absolute)) != expect_binary)
+    {
+        delete mpCommonStream;
+        EXCEPTION("Archive file '" + common_path.str() + "' is not a " + (expect_binary ? "binary" : "text") + " archive");
+    }
+
     try
     {
-        mpCommonArchive = new boost::archive::text_iarchive(*mpCommonStream);
+        mpCommonArchive = new Archive(*mpCommonStream);
     }
     catch (boost::archive::archive_exception& boost_exception)
     {
@@ -97,7 +118,7 @@ ArchiveOpener<boost::archive::text_iarchive, std::ifstream>::ArchiveOpener(
     }
 
     // Try to open the secondary archive for distributed data
-    mpPrivateStream = new std::ifstream(private_path.c_str(), std::ios::binary);
+    mpPrivateStream = new Stream(private_path.c_str(), std::ios::binary);
     if (!mpPrivateStream->is_open())
     {
         delete mpPrivateStream;
@@ -105,35 +126,22 @@ ArchiveOpener<boost::archive::text_iarchive, std::ifstream>::ArchiveOpener(
         delete mpCommonStream;
         EXCEPTION("Cannot load secondary archive file: " + private_path);
     }
-    mpPrivateArchive = new boost::archive::text_iarchive(*mpPrivateStream);
-    ProcessSpecificArchive<boost::archive::text_iarchive>::Set(mpPrivateArchive);
-}
-
-template<>
-ArchiveOpener<boost::archive::text_iarchive, std::ifstream>::~ArchiveOpener()
-{
-    ProcessSpecificArchive<boost::archive::text_iarchive>::Set(nullptr);
-    delete mpPrivateArchive;
-    delete mpPrivateStream;
-    delete mpCommonArchive;
-    delete mpCommonStream;
+    mpPrivateArchive = new Archive(*mpPrivateStream);
+    ProcessSpecificArchive<Archive>::Set(mpPrivateArchive);
 }
 
 /**
- * Specialization for output archives.
+ * Open archives for writing.
  * @param rDirectory
  * @param rFileNameBase
  * @param procId
  */
-template<>
-ArchiveOpener<boost::archive::text_oarchive, std::ofstream>::ArchiveOpener(
+template <class Archive, class Stream>
+void ArchiveOpener<Archive, Stream>::OpenArchives(
         const FileFinder& rDirectory,
         const std::string& rFileNameBase,
-        unsigned procId)
-    : mpCommonStream(nullptr),
-      mpPrivateStream(nullptr),
-      mpCommonArchive(nullptr),
-      mpPrivateArchive(nullptr)
+        unsigned procId,
+        boost::mpl::false_)
 {
     // Check for user error
     if (procId != PetscTools::GetMyRank())
@@ -155,7 +163,7 @@ ArchiveOpener<boost::archive::text_oarchive, std::ofstream>::ArchiveOpener(
     // Create master archive for replicated data
     if (PetscTools::AmMaster())
     {
-        mpCommonStream = new std::ofstream(common_path.str().c_str(), std::ios::binary | std::ios::trunc);
+        mpCommonStream = new Stream(common_path.str().c_str(), std::ios::binary | std::ios::trunc);
         if (!mpCommonStream->is_open())
         {
             delete mpCommonStream;
@@ -166,9 +174,9 @@ ArchiveOpener<boost::archive::text_oarchive, std::ofstream>::ArchiveOpener(
     {
         // Non-master processes need to go through the serialization methods, but not write any data
 #ifdef _MSC_VER
-        mpCommonStream = new std::ofstream("NUL", std::ios::binary | std::ios::trunc);
+        mpCommonStream = new Stream("NUL", std::ios::binary | std::ios::trunc);
 #else
-        mpCommonStream = new std::ofstream("/dev/null", std::ios::binary | std::ios::trunc);
+        mpCommonStream = new Stream("/dev/null", std::ios::binary | std::ios::trunc);
 #endif
         // LCOV_EXCL_START
         if (!mpCommonStream->is_open())
@@ -178,10 +186,10 @@ ArchiveOpener<boost::archive::text_oarchive, std::ofstream>::ArchiveOpener(
         }
         // LCOV_EXCL_STOP
     }
-    mpCommonArchive = new boost::archive::text_oarchive(*mpCommonStream);
+    mpCommonArchive = new Archive(*mpCommonStream);
 
     // Create secondary archive for distributed data
-    mpPrivateStream = new std::ofstream(private_path.c_str(), std::ios::binary | std::ios::trunc);
+    mpPrivateStream = new Stream(private_path.c_str(), std::ios::binary | std::ios::trunc);
     if (!mpPrivateStream->is_open())
     {
         delete mpPrivateStream;
@@ -189,23 +197,41 @@ ArchiveOpener<boost::archive::text_oarchive, std::ofstream>::ArchiveOpener(
         delete mpCommonStream;
         EXCEPTION("Failed to open secondary archive file for writing: " + private_path);
     }
-    mpPrivateArchive = new boost::archive::text_oarchive(*mpPrivateStream);
-    ProcessSpecificArchive<boost::archive::text_oarchive>::Set(mpPrivateArchive);
+    mpPrivateArchive = new Archive(*mpPrivateStream);
+    ProcessSpecificArchive<Archive>::Set(mpPrivateArchive);
 }
 
-template<>
-ArchiveOpener<boost::archive::text_oarchive, std::ofstream>::~ArchiveOpener()
+template <class Archive, class Stream>
+ArchiveOpener<Archive, Stream>::~ArchiveOpener()
 {
-    ProcessSpecificArchive<boost::archive::text_oarchive>::Set(nullptr);
+    ProcessSpecificArchive<Archive>::Set(nullptr);
     delete mpPrivateArchive;
     delete mpPrivateStream;
     delete mpCommonArchive;
     delete mpCommonStream;
 
-    /* In a parallel setting, make sure all processes have finished writing before
-     * continuing, to avoid nasty race conditions.
-     * For example, many tests will write an archive then immediately read it back
-     * in, which could easily break without this.
-     */
-    PetscTools::Barrier("~ArchiveOpener");
+    if (!Archive::is_loading::value)
+    {
+        /* In a parallel setting, make sure all processes have finished writing before
+         * continuing, to avoid nasty race conditions.
+         * For example, many tests will write an archive then immediately read it back
+         * in, which could easily break without this.
+         */
+        PetscTools::Barrier("~ArchiveOpener");
+    }
 }
+
+/*
+ * Explicit instantiation.  Only the constructor and destructor are instantiated, since each
+ * archive type only uses one of the two OpenArchives() methods.
+ */
+/** \cond */
+template ArchiveOpener<boost::archive::text_iarchive, std::ifstream>::ArchiveOpener(const FileFinder&, const std::string&, unsigned);
+template ArchiveOpener<boost::archive::text_iarchive, std::ifstream>::~ArchiveOpener();
+template ArchiveOpener<boost::archive::text_oarchive, std::ofstream>::ArchiveOpener(const FileFinder&, const std::string&, unsigned);
+template ArchiveOpener<boost::archive::text_oarchive, std::ofstream>::~ArchiveOpener();
+template ArchiveOpener<boost::archive::binary_iarchive, std::ifstream>::ArchiveOpener(const FileFinder&, const std::string&, unsigned);
+template ArchiveOpener<boost::archive::binary_iarchive, std::ifstream>::~ArchiveOpener();
+template ArchiveOpener<boost::archive::binary_oarchive, std::ofstream>::ArchiveOpener(const FileFinder&, const std::string&, unsigned);
+template ArchiveOpener<boost::archive::binary_oarchive, std::ofstream>::~ArchiveOpener();
+/** \endcond */
@@ -37,6 +37,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <string>
 #include <cassert>
+#include <boost/mpl/bool.hpp>
 
 #include "PetscTools.hpp"
 #include "FileFinder.hpp"
@@ -53,9 +54,11 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  * Internally the class uses ProcessSpecificArchive<Archive> to store the secondary archive.
  *
- * Note also that implementations of this templated class only exist for text archives, i.e.
- * Archive = boost::archive::text_iarchive (with Stream = std::ifstream), or
- * Archive = boost::archive::text_oarchive (with Stream = std::ofstream).
+ * Note also that implementations of this templated class only exist for text and binary archives, i.e.
+ * Archive = boost::archive::text_iarchive or boost::archive::binary_iarchive (with Stream = std::ifstream), or
+ * Archive = boost::archive::text_oarchive or boost::archive::binary_oarchive (with Stream = std::ofstream).
+ * Binary archives are much faster to write and read, and smaller, but are only portable between
+ * machines with the same architecture and Boost version.
  */
 template <class Archive, class Stream>
 class ArchiveOpener
@@ -103,6 +106,24 @@ public:
 
 private:
 
+    /**
+     * Open the archives for reading.  Called by the constructor for input archives.
+     *
+     * @param rDirectory  folder containing archive files
+     * @param rFileNameBase  base name of archive files
+     * @param procId  the secondary archive to read
+     */
+    void OpenArchives(const FileFinder& rDirectory, const std::string& rFileNameBase, unsigned procId, boost::mpl::true_);
+
+    /**
+     * Open the archives for writing.  Called by the constructor for output archives.
+     *
+     * @param rDirectory  folder to contain archive files
+     * @param rFileNameBase  base name of archive files
+     * @param procId  must be this process' rank
+     */
+    void OpenArchives(const FileFinder& rDirectory, const std::string& rFileNameBase, unsigned procId, boost::mpl::false_);
+
     /** The file stream for the main archive. */
     Stream* mpCommonStream;
 
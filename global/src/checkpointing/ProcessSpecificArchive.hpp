@@ -55,8 +55,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * archive must ensure it exists for the duration of the serialization process, and call
  * Set(NULL) prior to closing the archive for safety.
  *
- * Note also that implementations of this templated class only exist for text archives, i.e.
- * Archive = boost::archive::text_iarchive or Archive = boost::archive::text_oarchive.
+ * Note also that implementations of this templated class only exist for text and binary archives, i.e.
+ * Archive = boost::archive::text_iarchive, boost::archive::text_oarchive, boost::archive::binary_iarchive
+ * or boost::archive::binary_oarchive.
  */
 template <class Archive>
 class ProcessSpecificArchive
@@ -0,0 +1,207 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "BenchmarkRecorder.hpp"
+
+#include <cstdio>
+
+#include "CommandLineArguments.hpp"
+#include "Exception.hpp"
+#include "OutputFileHandler.hpp"
+#include "PetscTools.hpp"
+#include "Timer.hpp"
+#include "Version.hpp"
+
+BenchmarkRecorder::BenchmarkRecorder(const std::string& rSuiteName)
+    : mSuiteName(rSuiteName),
+      mRunning(false),
+      mStartTime(0.0)
+{
+}
+
+void BenchmarkRecorder::StartBenchmark(const std::string& rName)
+{
+    if (mRunning)
+    {
+        EXCEPTION("Benchmark '" << mResults.back().mName << "' has not been stopped.");
+    }
+    Result result;
+    result.mName = rName;
+    result.mMinTime = 0.0;
+    result.mMeanTime = 0.0;
+    result.mMaxTime = 0.0;
+    mResults.push_back(result);
+    mRunning = true;
+
+    PetscTools::Barrier("BenchmarkRecorder::StartBenchmark");
+    mStartTime = Timer::GetWallTime();
+}
+
+void BenchmarkRecorder::AddParameter(const std::string& rName, double value)
+{
+    if (mResults.empty())
+    {
+        EXCEPTION("No benchmark has been started.");
+    }
+    mResults.back().mParameters.push_back(std::make_pair(rName, value));
+}
+
+void BenchmarkRecorder::StopBenchmark()
+{
+    if (!mRunning)
+    {
+        EXCEPTION("No benchmark is in progress.");
+    }
+    double elapsed = Timer::GetWallTime() - mStartTime;
+
+    // Time on each process before waiting for the others, so that imbalance shows up
+    Result& r_result = mResults.back();
+    MPI_Allreduce(&elapsed, &r_result.mMinTime, 1, MPI_DOUBLE, MPI_MIN, PetscTools::GetWorld());
+    MPI_Allreduce(&elapsed, &r_result.mMaxTime, 1, MPI_DOUBLE, MPI_MAX, PetscTools::GetWorld());
+    MPI_Allreduce(&elapsed, &r_result.mMeanTime, 1, MPI_DOUBLE, MPI_SUM, PetscTools::GetWorld());
+    r_result.mMeanTime /= PetscTools::GetNumProcs();
+    mRunning = false;
+}
+
+unsigned BenchmarkRecorder::GetNumBenchmarks() const
+{
+    return mRunning ? mResults.size() - 1u : mResults.size();
+}
+
+double BenchmarkRecorder::GetMaxTime(unsigned index) const
+{
+    if (index >= GetNumBenchmarks())
+    {
+        EXCEPTION("There is no completed benchmark with index " << index << ".");
+    }
+    return mResults[index].mMaxTime;
+}
+
+void BenchmarkRecorder::WriteJson(const std::string& rDirectory, const std::string& rFileName) const
+{
+    std::string directory = rDirectory;
+    std::string file_name = rFileName.empty() ? mSuiteName + ".json" : rFileName;
+    if (CommandLineArguments::Instance()->OptionExists("-benchmark_output_dir"))
+    {
+        directory = CommandLineArguments::Instance()->GetStringCorrespondingToOption("-benchmark_output_dir");
+    }
+    if (CommandLineArguments::Instance()->OptionExists("-benchmark_output_file"))
+    {
+        file_name = CommandLineArguments::Instance()->GetStringCorrespondingToOption("-benchmark_output_file");
+    }
+
+    OutputFileHandler handler(directory, false);
+    if (PetscTools::AmMaster())
+    {
+        out_stream p_file = handler.OpenOutputFile(file_name);
+        p_file->precision(9);
+        (*p_file) << "{\n"
+                  << "  \"suite\": \"" << EscapeJsonString(mSuiteName) << "\",\n"
+                  << "  \"num_procs\": " << PetscTools::GetNumProcs() << ",\n"
+                  << "  \"chaste_version\": \"" << EscapeJsonString(ChasteBuildInfo::GetVersionString()) << "\",\n"
+                  << "  \"build\": \"" << EscapeJsonString(ChasteBuildInfo::GetBuildInformation()) << "\",\n"
+                  << "  \"compiler\": \"" << EscapeJsonString(std::string(ChasteBuildInfo::GetCompilerType()) + " " + ChasteBuildInfo::GetCompilerVersion()) << "\",\n"
+                  << "  \"benchmarks\": [";
+        const unsigned num_benchmarks = GetNumBenchmarks();
+        for (unsigned i=0; i<num_benchmarks; i++)
+        {
+            const Result& r_result = mResults[i];
+            (*p_file) << (i == 0u ? "\n" : ",\n")
+                      << "    {\n"
+                      << "      \"name\": \"" << EscapeJsonString(r_result.mName) << "\",\n"
+                      << "      \"parameters\": {";
+            for (unsigned j=0; j<r_result.mParameters.size(); j++)
+            {
+                (*p_file) << (j == 0u ? "" : ", ") << "\"" << EscapeJsonString(r_result.mParameters[j].first) << "\": " << r_result.mParameters[j].second;
+            }
+            (*p_file) << "},\n"
+                      << "      \"wall_time\": {\"min\": " << r_result.mMinTime
+                      << ", \"mean\": " << r_result.mMeanTime
+                      << ", \"max\": " << r_result.mMaxTime << "}\n"
+                      << "    }";
+        }
+        (*p_file) << "\n  ]\n}\n";
+        p_file->close();
+    }
+    PetscTools::Barrier("BenchmarkRecorder::WriteJson");
+}
+
+unsigned BenchmarkRecorder::GetUnsignedOption(const std::string& rOption, unsigned defaultValue)
+{
+    if (CommandLineArguments::Instance()->OptionExists(rOption))
+    {
+        return CommandLineArguments::Instance()->GetUnsignedCorrespondingToOption(rOption);
+    }
+    return defaultValue;
+}
+
+std::string BenchmarkRecorder::EscapeJsonString(const std::string& rString)
+{
+    std::string escaped;
+    for (std::string::const_iterator it = rString.begin(); it != rString.end(); ++it)
+    {
+        const char c = *it;
+        switch (c)
+        {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\r':
+                escaped += "\\r";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char code[7];
+                    snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(static_cast<unsigned char>(c)));
+                    escaped += code;
+                }
+                else
+                {
+                    escaped += c;
+                }
+        }
+    }
+    return escaped;
+}
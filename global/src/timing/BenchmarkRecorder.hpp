@@ -0,0 +1,162 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BENCHMARKRECORDER_HPP_
+#define BENCHMARKRECORDER_HPP_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Times a series of benchmarks and writes the results as JSON, for tracking
+ * performance regressions and scaling across releases.
+ *
+ * Each benchmark is bracketed by StartBenchmark() and StopBenchmark(), which
+ * are collective and synchronise the processes, so that the recorded time is
+ * for the whole job. The minimum, mean and maximum time over processes are
+ * recorded, together with any parameters describing the problem (e.g. its
+ * size) added with AddParameter().
+ *
+ * Benchmarks take their problem sizes from command line options; see
+ * GetUnsignedOption(). Scaling curves are built by running the same suite
+ * with different sizes and numbers of processes: the JSON records both.
+ *
+ * Usage:
+ *
+ *  BenchmarkRecorder recorder("heart");
+ *  unsigned size = BenchmarkRecorder::GetUnsignedOption("-benchmark_size", 2u);
+ *  recorder.StartBenchmark("Monodomain3d");
+ *  recorder.AddParameter("size", size);
+ *  // do something
+ *  recorder.StopBenchmark();
+ *  recorder.WriteJson();
+ */
+class BenchmarkRecorder
+{
+private:
+    /** The results of one benchmark. */
+    struct Result
+    {
+        std::string mName; /**< The benchmark name */
+        std::vector<std::pair<std::string, double> > mParameters; /**< Parameters describing the problem */
+        double mMinTime; /**< Minimum wall time over processes (s) */
+        double mMeanTime; /**< Mean wall time over processes (s) */
+        double mMaxTime; /**< Maximum wall time over processes (s) */
+    };
+
+    /** The name of this suite of benchmarks. */
+    std::string mSuiteName;
+
+    /** The completed benchmarks, and the one in progress (if any) at the end. */
+    std::vector<Result> mResults;
+
+    /** Whether a benchmark is in progress. */
+    bool mRunning;
+
+    /** The wall time at which the benchmark in progress started. */
+    double mStartTime;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param rSuiteName  the name of this suite of benchmarks
+     */
+    BenchmarkRecorder(const std::string& rSuiteName);
+
+    /**
+     * Start timing a benchmark. This is collective.
+     *
+     * @param rName  the benchmark name
+     */
+    void StartBenchmark(const std::string& rName);
+
+    /**
+     * Record a parameter describing the current (or, once stopped, the last) benchmark.
+     *
+     * @param rName  the parameter name
+     * @param value  its value
+     */
+    void AddParameter(const std::string& rName, double value);
+
+    /**
+     * Stop timing the current benchmark. This is collective.
+     */
+    void StopBenchmark();
+
+    /**
+     * @return the number of completed benchmarks
+     */
+    unsigned GetNumBenchmarks() const;
+
+    /**
+     * @return the maximum wall time over processes for a completed benchmark (s)
+     *
+     * @param index  the index of the benchmark, in order of completion
+     */
+    double GetMaxTime(unsigned index) const;
+
+    /**
+     * Write the results of the completed benchmarks as JSON. Only the master process writes.
+     *
+     * The output location can be overridden with the command line options
+     * -benchmark_output_dir and -benchmark_output_file.
+     *
+     * @param rDirectory  the output directory, relative to CHASTE_TEST_OUTPUT (not cleaned)
+     * @param rFileName  the file name; defaults to the suite name with a ".json" extension
+     */
+    void WriteJson(const std::string& rDirectory="Benchmarks", const std::string& rFileName="") const;
+
+    /**
+     * Get a benchmark size parameter from the command line, if given.
+     *
+     * @param rOption  the option, e.g. "-benchmark_size"
+     * @param defaultValue  the value to use if the option is not given
+     * @return the value
+     */
+    static unsigned GetUnsignedOption(const std::string& rOption, unsigned defaultValue);
+
+    /**
+     * Escape a string for writing as a JSON string value, i.e. escape quotes, backslashes
+     * and control characters.
+     *
+     * @param rString  the string to escape
+     * @return the escaped string (without surrounding quotes)
+     */
+    static std::string EscapeJsonString(const std::string& rString);
+};
+
+#endif /*BENCHMARKRECORDER_HPP_*/
@@ -38,8 +38,12 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cassert>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "Exception.hpp"
+#include "HardwareCounters.hpp"
+#include "OutputFileHandler.hpp"
 #include "PetscTools.hpp"
 #include "Timer.hpp"
 
@@ -53,6 +57,13 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * The methods in this class are not implemented separately as then they would not be
  * inline, which could impact performance; we generally want timing routines to be very
  * lightweight.
+ *
+ * Optionally (see EnableTracing) each completed event is also recorded with its start
+ * and end time in a fixed-size ring buffer, which can be written out in the Chrome
+ * trace event format (loadable in Perfetto or chrome://tracing) with WriteTrace.
+ *
+ * Hardware performance counters (see HardwareCounters) can also be accumulated per
+ * event, in the same way as wall time, by calling EnableHardwareCounters.
  */
 template <unsigned NUM_EVENTS, class CONCRETE>
 class GenericEventHandler
@@ -68,6 +79,26 @@ private:
     bool mEnabled; /**< Whether the event handler is recording event times */
     bool mInUse; /**< Determines if any of the event have begun */
 
+    /** A completed event, as recorded when tracing. */
+    struct TraceRecord
+    {
+        unsigned mEvent; /**< The event index */
+        double mStart; /**< Wall time at which the event began, relative to #mTraceEpoch */
+        double mEnd; /**< Wall time at which the event ended, relative to #mTraceEpoch */
+    };
+
+    bool mTracing; /**< Whether completed events are being recorded in #mTraceBuffer */
+    std::vector<TraceRecord> mTraceBuffer; /**< Ring buffer of completed events */
+    unsigned mNumTraceRecords; /**< Total number of events recorded since tracing was enabled; may exceed the buffer size */
+    double mTraceEpoch; /**< Wall time at which tracing was enabled */
+    std::vector<double> mBeginTime; /**< Wall time at which each event in progress began */
+
+    HardwareCounters mHardwareCounters; /**< Hardware performance counters for this process */
+    bool mCountersEnabled; /**< Whether hardware counters are accumulated for each event */
+    std::vector<double> mCounterTotals; /**< Counter totals, indexed by event*HardwareCounters::NUM_COUNTERS + counter */
+    std::vector<double> mCounterBeginValues; /**< Counter values when each event in progress began, indexed as #mCounterTotals */
+    std::vector<bool> mCountersBegun; /**< Whether the counters were read when each event in progress began */
+
     /**
      * Sleep for a specified number of milliseconds.
      * Used in testing.
@@ -200,6 +231,95 @@ public:
         return Instance()->IsEnabledImpl();
     }
 
+    /**
+     * Start recording each completed event in a ring buffer, discarding anything
+     * recorded previously. Once the buffer is full the oldest events are overwritten.
+     *
+     * This is collective, so that the trace times on each process start together.
+     *
+     * @param bufferSize  the maximum number of events to keep (defaults to 65536)
+     */
+    static void EnableTracing(unsigned bufferSize=65536u)
+    {
+        Instance()->EnableTracingImpl(bufferSize);
+    }
+
+    /** Stop recording events for tracing (those already recorded are kept). */
+    static void DisableTracing()
+    {
+        Instance()->mTracing = false;
+    }
+
+    /**
+     * @return whether completed events are being recorded for tracing
+     */
+    static bool IsTracing()
+    {
+        return Instance()->mTracing;
+    }
+
+    /**
+     * @return the number of events recorded since tracing was enabled, including
+     * any which have since been overwritten in the ring buffer
+     */
+    static unsigned GetNumberOfTraceRecords()
+    {
+        return Instance()->mNumTraceRecords;
+    }
+
+    /**
+     * Write the events recorded on all processes to a single JSON file in the
+     * Chrome trace event format. Each process appears as a separate "pid".
+     * Events which had not ended when recorded are not included.
+     *
+     * This is collective.
+     *
+     * @param rDirectory  the output directory, relative to CHASTE_TEST_OUTPUT (not cleaned)
+     * @param rFileName  the file name, e.g. "trace.json"
+     */
+    static void WriteTrace(const std::string& rDirectory, const std::string& rFileName)
+    {
+        Instance()->WriteTraceImpl(rDirectory, rFileName);
+    }
+
+    /**
+     * Start accumulating hardware performance counters for each event, in addition
+     * to wall time. Report() will then also print the instructions per cycle and the
+     * memory bandwidth implied by last-level cache misses for each event.
+     *
+     * Reading the counters needs a system call at the start and end of each event,
+     * so this should only be used for profiling.
+     *
+     * @return whether any counter is available on this machine
+     */
+    static bool EnableHardwareCounters()
+    {
+        return Instance()->EnableHardwareCountersImpl();
+    }
+
+    /**
+     * Stop accumulating hardware performance counters. Events in progress will not
+     * have their counters accumulated when they end.
+     */
+    static void DisableHardwareCounters()
+    {
+        Instance()->mCountersEnabled = false;
+        Instance()->mCountersBegun.assign(NUM_EVENTS, false);
+        Instance()->mHardwareCounters.Close();
+    }
+
+    /**
+     * @return the total of a hardware counter accumulated so far for an event (which must have ended)
+     *
+     * @param event  the index of an event (this must be less than NUM_EVENTS)
+     * @param counter  a HardwareCounters::CounterType
+     */
+    static double GetHardwareCounterValue(unsigned event, unsigned counter)
+    {
+        assert(event<NUM_EVENTS && counter<HardwareCounters::NUM_COUNTERS);
+        return Instance()->mCounterTotals[event*HardwareCounters::NUM_COUNTERS + counter];
+    }
+
 protected:
 
     /**
@@ -211,6 +331,14 @@ protected:
         mInUse = false;
         mWallTime.resize(NUM_EVENTS, 0.0);
         mHasBegun.resize(NUM_EVENTS, false);
+        mTracing = false;
+        mNumTraceRecords = 0u;
+        mTraceEpoch = 0.0;
+        mBeginTime.resize(NUM_EVENTS, 0.0);
+        mCountersEnabled = false;
+        mCounterTotals.resize(NUM_EVENTS*HardwareCounters::NUM_COUNTERS, 0.0);
+        mCounterBeginValues.resize(NUM_EVENTS*HardwareCounters::NUM_COUNTERS, 0.0);
+        mCountersBegun.resize(NUM_EVENTS, false);
     }
 
 private:
@@ -224,7 +352,9 @@ private:
         {
             mWallTime[event] = 0.0;
             mHasBegun[event] = false;
+            mCountersBegun[event] = false;
         }
+        mCounterTotals.assign(mCounterTotals.size(), 0.0);
         Enable();
         mInUse = false;
     }
@@ -264,7 +394,15 @@ private:
             Disable();
             return;
         }
-        mWallTime[event] -= Timer::GetWallTime();
+        // Events which begin before counters are enabled do not accumulate them
+        mCountersBegun[event] = mCountersEnabled;
+        if (mCountersEnabled)
+        {
+            mHardwareCounters.Read(&mCounterBeginValues[event*HardwareCounters::NUM_COUNTERS]);
+        }
+        const double now = Timer::GetWallTime();
+        mWallTime[event] -= now;
+        mBeginTime[event] = now;
         mHasBegun[event] = true;
         //std::cout << PetscTools::GetMyRank()<<": Beginning " << EVENT_NAME[event] << " @ " << (clock()/1000) << std::endl;
     }
@@ -292,8 +430,22 @@ private:
             msg += "' had not begun when EndEvent was called.";
             EXCEPTION(msg);
         }
-        mWallTime[event] += Timer::GetWallTime();
+        const double now = Timer::GetWallTime();
+        mWallTime[event] += now;
         mHasBegun[event] = false;
+        if (mCountersBegun[event])
+        {
+            AccumulateCounters(event);
+            mCountersBegun[event] = false;
+        }
+        if (mTracing)
+        {
+            TraceRecord& r_record = mTraceBuffer[mNumTraceRecords % mTraceBuffer.size()];
+            r_record.mEvent = event;
+            r_record.mStart = mBeginTime[event] - mTraceEpoch;
+            r_record.mEnd = now - mTraceEpoch;
+            mNumTraceRecords++;
+        }
         //std::cout << PetscTools::GetMyRank()<<": Ending " << EVENT_NAME[event] << " @ " << (clock()/1000) << std::endl;
     }
 
@@ -383,6 +535,39 @@ private:
                 printf("(%3.0f%%)  ", total == 0.0 ? 0.0 : (secs/total*100.0));
             }
             std::cout << "(seconds) \n";
+
+            if (mCountersEnabled)
+            {
+                const unsigned num_counters = HardwareCounters::NUM_COUNTERS;
+                if (PetscTools::IsParallel())
+                {
+                    printf("%3u: ", PetscTools::GetMyRank());
+                }
+                for (unsigned event=0; event<NUM_EVENTS; event++)
+                {
+                    const double cycles = mCounterTotals[event*num_counters + HardwareCounters::CYCLES];
+                    const double instructions = mCounterTotals[event*num_counters + HardwareCounters::INSTRUCTIONS];
+                    printf("%8.2f%9s", cycles == 0.0 ? 0.0 : instructions/cycles, "");
+                }
+                std::cout << "(instructions per cycle) \n";
+
+                if (PetscTools::IsParallel())
+                {
+                    printf("%3u: ", PetscTools::GetMyRank());
+                }
+                for (unsigned event=0; event<NUM_EVENTS; event++)
+                {
+                    const double secs = ConvertWallTimeToSeconds(mWallTime[event]);
+                    const double bytes = mCounterTotals[event*num_counters + HardwareCounters::LLC_MISSES]
+                                         * HardwareCounters::BYTES_PER_CACHE_LINE;
+                    printf("%8.2f%9s", secs == 0.0 ? 0.0 : bytes/secs*1e-9, "");
+                }
+                std::cout << "(GB/s from LLC misses) \n";
+                if (mHardwareCounters.WasMultiplexed())
+                {
+                    std::cout << "(hardware counters were multiplexed, so counts are scaled estimates) \n";
+                }
+            }
         }
         PetscTools::EndRoundRobin();
 
@@ -418,6 +603,30 @@ private:
                 }
                 std::cout << "(seconds) \n";
             }
+
+            double min_cpu_time[NUM_EVENTS];
+            MPI_Reduce(&mWallTime[0], min_cpu_time, NUM_EVENTS, MPI_DOUBLE, MPI_MIN, 0, PetscTools::GetWorld());
+            if (PetscTools::AmMaster())
+            {
+                total = ConvertWallTimeToSeconds(min_cpu_time[top_event]);
+                printf("min: "); //5 chars
+                for (unsigned event=0; event<NUM_EVENTS; event++)
+                {
+                    const double secs = ConvertWallTimeToSeconds(min_cpu_time[event]);
+                    printf(format, secs);
+                    printf("(%3.0f%%)  ", total == 0.0 ? 0.0 : (secs/total*100.0));
+                }
+                std::cout << "(seconds) \n";
+
+                // Load imbalance: how much longer the slowest process took than the average
+                printf("imb: "); //5 chars
+                for (unsigned event=0; event<NUM_EVENTS; event++)
+                {
+                    const double mean = total_cpu_time[event]/PetscTools::GetNumProcs();
+                    printf("%8.2f%9s", mean == 0.0 ? 1.0 : max_cpu_time[event]/mean, "");
+                }
+                std::cout << "(max/avg) \n";
+            }
         }
         std::cout.flush();
         PetscTools::Barrier();
@@ -451,6 +660,102 @@ private:
         }
     }
 
+    /**
+     * Open the hardware counters and start accumulating them for each event.
+     *
+     * @return whether any counter is available
+     */
+    bool EnableHardwareCountersImpl()
+    {
+        mCountersEnabled = mHardwareCounters.Open();
+        return mCountersEnabled;
+    }
+
+    /**
+     * Add the change in the hardware counter values since an event began to its totals.
+     *
+     * @param event  the index of an event, whose counters were read when it began
+     */
+    void AccumulateCounters(unsigned event)
+    {
+        double values[HardwareCounters::NUM_COUNTERS];
+        mHardwareCounters.Read(values);
+        for (unsigned counter=0; counter<HardwareCounters::NUM_COUNTERS; counter++)
+        {
+            const unsigned index = event*HardwareCounters::NUM_COUNTERS + counter;
+            mCounterTotals[index] += values[counter] - mCounterBeginValues[index];
+        }
+    }
+
+    /**
+     * Start recording completed events for tracing.
+     *
+     * @param bufferSize  the maximum number of events to keep
+     */
+    void EnableTracingImpl(unsigned bufferSize)
+    {
+        if (bufferSize == 0u)
+        {
+            EXCEPTION("The trace buffer must be able to hold at least one event.");
+        }
+        mTraceBuffer.resize(bufferSize);
+        mNumTraceRecords = 0u;
+        PetscTools::Barrier("EnableTracing");
+        mTraceEpoch = Timer::GetWallTime();
+        mTracing = true;
+    }
+
+    /**
+     * Write the recorded events from all processes in the Chrome trace event format.
+     *
+     * @param rDirectory  the output directory, relative to CHASTE_TEST_OUTPUT
+     * @param rFileName  the file name
+     */
+    void WriteTraceImpl(const std::string& rDirectory, const std::string& rFileName)
+    {
+        OutputFileHandler handler(rDirectory, false);
+        if (PetscTools::AmMaster())
+        {
+            out_stream p_file = handler.OpenOutputFile(rFileName);
+            (*p_file) << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+            p_file->close();
+        }
+
+        // Processes take turns to append their events; the master's first line has no leading comma
+        PetscTools::BeginRoundRobin();
+        {
+            const unsigned rank = PetscTools::GetMyRank();
+            out_stream p_file = handler.OpenOutputFile(rFileName, std::ios::app);
+            p_file->precision(15);
+            (*p_file) << (rank == 0u ? "" : ",\n")
+                      << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+                      << ",\"tid\":0,\"args\":{\"name\":\"Process " << rank << "\"}}";
+
+            // Oldest first
+            const unsigned buffer_size = mTraceBuffer.size();
+            const unsigned num_kept = (mNumTraceRecords < buffer_size) ? mNumTraceRecords : buffer_size;
+            for (unsigned i=mNumTraceRecords-num_kept; i<mNumTraceRecords; i++)
+            {
+                const TraceRecord& r_record = mTraceBuffer[i % buffer_size];
+                // Times are in microseconds
+                (*p_file) << ",\n{\"name\":\"" << CONCRETE::EventName[r_record.mEvent]
+                          << "\",\"ph\":\"X\",\"pid\":" << rank << ",\"tid\":0"
+                          << ",\"ts\":" << r_record.mStart*1e6
+                          << ",\"dur\":" << (r_record.mEnd - r_record.mStart)*1e6 << "}";
+            }
+            p_file->close();
+        }
+        PetscTools::EndRoundRobin();
+
+        if (PetscTools::AmMaster())
+        {
+            out_stream p_file = handler.OpenOutputFile(rFileName, std::ios::app);
+            (*p_file) << "\n]}\n";
+            p_file->close();
+        }
+        PetscTools::Barrier("WriteTrace");
+    }
+
     /** Enable the event handler so that it will record event durations. */
     void EnableImpl()
     {
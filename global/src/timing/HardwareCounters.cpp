@@ -0,0 +1,166 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "HardwareCounters.hpp"
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <stdint.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // __linux__
+
+const char* HardwareCounters::CounterName[] = { "cycles", "instructions", "LLC misses" };
+
+HardwareCounters::HardwareCounters()
+    : mGroupFd(-1),
+      mFds(NUM_COUNTERS, -1),
+      mMultiplexed(false)
+{
+}
+
+HardwareCounters::~HardwareCounters()
+{
+    Close();
+}
+
+bool HardwareCounters::Open()
+{
+    if (IsOpen())
+    {
+        return true;
+    }
+#ifdef __linux__
+    const uint64_t config[NUM_COUNTERS] = { PERF_COUNT_HW_CPU_CYCLES,
+                                            PERF_COUNT_HW_INSTRUCTIONS,
+                                            PERF_COUNT_HW_CACHE_MISSES };
+    for (unsigned counter=0; counter<NUM_COUNTERS; counter++)
+    {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config[counter];
+        attr.disabled = (mGroupFd == -1) ? 1 : 0; // The whole group is started via the leader
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        // This thread, on any CPU
+        int fd = syscall(__NR_perf_event_open, &attr, 0, -1, mGroupFd, 0);
+        if (fd != -1)
+        {
+            if (mGroupFd == -1)
+            {
+                mGroupFd = fd;
+            }
+            mFds[counter] = fd;
+            mGroupOrder.push_back(counter);
+        }
+    }
+    if (mGroupFd != -1)
+    {
+        ioctl(mGroupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(mGroupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif // __linux__
+    return IsOpen();
+}
+
+void HardwareCounters::Close()
+{
+#ifdef __linux__
+    for (unsigned counter=0; counter<NUM_COUNTERS; counter++)
+    {
+        if (mFds[counter] != -1)
+        {
+            close(mFds[counter]);
+        }
+    }
+#endif // __linux__
+    mFds.assign(NUM_COUNTERS, -1);
+    mGroupOrder.clear();
+    mGroupFd = -1;
+    mMultiplexed = false;
+}
+
+bool HardwareCounters::IsOpen() const
+{
+    return mGroupFd != -1;
+}
+
+bool HardwareCounters::IsAvailable(unsigned counter) const
+{
+    return counter < NUM_COUNTERS && mFds[counter] != -1;
+}
+
+void HardwareCounters::Read(double* pValues) const
+{
+    for (unsigned counter=0; counter<NUM_COUNTERS; counter++)
+    {
+        pValues[counter] = 0.0;
+    }
+#ifdef __linux__
+    if (IsOpen())
+    {
+        // Layout for our read format: the number of counters, the times the group was enabled and
+        // actually counting, then the counter values in the order they were opened
+        uint64_t buffer[3 + NUM_COUNTERS];
+        if (read(mGroupFd, buffer, sizeof(buffer)) > 0)
+        {
+            const uint64_t time_enabled = buffer[1];
+            const uint64_t time_running = buffer[2];
+            double scale = 1.0;
+            if (time_running > 0 && time_running < time_enabled)
+            {
+                // The group was multiplexed, so estimate the counts over the whole time it was enabled
+                scale = (double)time_enabled/(double)time_running;
+                mMultiplexed = true;
+            }
+            for (unsigned i=0; i<buffer[0] && i<mGroupOrder.size(); i++)
+            {
+                pValues[mGroupOrder[i]] = scale*(double)buffer[3 + i];
+            }
+        }
+    }
+#endif // __linux__
+}
+
+bool HardwareCounters::WasMultiplexed() const
+{
+    return mMultiplexed;
+}
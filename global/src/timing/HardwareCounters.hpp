@@ -0,0 +1,135 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef HARDWARECOUNTERS_HPP_
+#define HARDWARECOUNTERS_HPP_
+
+#include <vector>
+
+/**
+ * Reads hardware performance counters for the calling thread, using the Linux
+ * perf_event_open interface. Counters are opened as a single group so that they
+ * are read together with one system call.
+ *
+ * Not every counter is available on every machine (or virtual machine); those
+ * which cannot be opened always read as zero. On other operating systems no
+ * counters are available.
+ *
+ * Only user-space activity is counted, so that this works with the default
+ * perf_event_paranoid setting.
+ *
+ * If the kernel has to multiplex the group with other counters (e.g. those of a
+ * profiler), the counts read are scaled up by the fraction of time the group was
+ * actually counting, and WasMultiplexed() will return true.
+ */
+class HardwareCounters
+{
+public:
+    /** The counters which can be read. */
+    typedef enum
+    {
+        CYCLES=0,
+        INSTRUCTIONS,
+        LLC_MISSES,
+        NUM_COUNTERS
+    } CounterType;
+
+    /** Names of the counters, for reports. */
+    static const char* CounterName[NUM_COUNTERS];
+
+    /** The number of bytes assumed to be transferred per last-level cache miss. */
+    static const unsigned BYTES_PER_CACHE_LINE = 64u;
+
+    /** Constructor; no counters are opened until Open() is called. */
+    HardwareCounters();
+
+    /** Destructor; closes any open counters. */
+    ~HardwareCounters();
+
+    /**
+     * Open and start the counters.
+     *
+     * @return whether any counter is available
+     */
+    bool Open();
+
+    /** Close the counters. */
+    void Close();
+
+    /**
+     * @return whether any counter is open
+     */
+    bool IsOpen() const;
+
+    /**
+     * @param counter  a CounterType
+     * @return whether the given counter is being read
+     */
+    bool IsAvailable(unsigned counter) const;
+
+    /**
+     * Read the current counter values.
+     *
+     * @param pValues  array of NUM_COUNTERS entries to fill in; unavailable counters are set to zero
+     */
+    void Read(double* pValues) const;
+
+    /**
+     * @return whether any value read since the counters were opened had to be scaled
+     * because the group was multiplexed
+     */
+    bool WasMultiplexed() const;
+
+private:
+    /** Copying is not allowed: the counters belong to one object. */
+    HardwareCounters(const HardwareCounters&);
+
+    /** Assignment is not allowed. */
+    HardwareCounters& operator=(const HardwareCounters&);
+
+    /** File descriptor of the group leader, or -1 if no counters are open. */
+    int mGroupFd;
+
+    /** File descriptor for each counter, or -1 if it is not available. */
+    std::vector<int> mFds;
+
+    /** The counters in the order they appear in a group read. */
+    std::vector<unsigned> mGroupOrder;
+
+    /** Whether any value read has been scaled for multiplexing. */
+    mutable bool mMultiplexed;
+};
+
+#endif /*HARDWARECOUNTERS_HPP_*/
@@ -42,6 +42,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/vector.hpp>
 #include <boost/foreach.hpp>
 #include <boost/version.hpp>
 
@@ -58,6 +61,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // Save typing, and allow the use of these in cxxtest macros
 typedef ArchiveOpener<boost::archive::text_iarchive, std::ifstream> InputArchiveOpener;
 typedef ArchiveOpener<boost::archive::text_oarchive, std::ofstream> OutputArchiveOpener;
+typedef ArchiveOpener<boost::archive::binary_iarchive, std::ifstream> BinaryInputArchiveOpener;
+typedef ArchiveOpener<boost::archive::binary_oarchive, std::ofstream> BinaryOutputArchiveOpener;
 
 class TestArchivingHelperClasses : public CxxTest::TestSuite
 {
@@ -265,6 +270,72 @@ public:
         PetscTools::Barrier("TestArchiveOpenerExceptions-5");
     }
 
+    void TestBinaryArchiveOpenerReadAndWrite()
+    {
+        FileFinder archive_dir("archiving_helpers_binary", RelativeTo::ChasteTestOutput);
+        std::string archive_file = "archive_opener.arch";
+        std::string text_archive_file = "archive_opener_text.arch";
+        const unsigned test_int = 123;
+        std::vector<double> test_vector(1000);
+        for (unsigned i=0; i<test_vector.size(); i++)
+        {
+            test_vector[i] = 0.1*i;
+        }
+
+        // Write a binary archive, and a text one to compare against
+        {
+            BinaryOutputArchiveOpener archive_opener_out(archive_dir, archive_file);
+            boost::archive::binary_oarchive* p_arch = archive_opener_out.GetCommonArchive();
+            boost::archive::binary_oarchive* p_process_arch = ProcessSpecificArchive<boost::archive::binary_oarchive>::Get();
+
+            (*p_arch) & test_int;
+            (*p_process_arch) & test_int;
+            (*p_process_arch) & test_vector;
+        }
+        {
+            OutputArchiveOpener archive_opener_out(archive_dir, text_archive_file);
+            (*archive_opener_out.GetCommonArchive()) & test_int;
+        }
+
+        // The format of each file can be detected
+        FileFinder binary_file(archive_file, archive_dir);
+        FileFinder text_file(text_archive_file, archive_dir);
+        TS_ASSERT(ArchiveLocationInfo::IsBinaryArchiveFile(binary_file));
+        TS_ASSERT(!ArchiveLocationInfo::IsBinaryArchiveFile(text_file));
+        TS_ASSERT_THROWS_CONTAINS(ArchiveLocationInfo::IsBinaryArchiveFile(FileFinder("absent.arch", archive_dir)),
+                                  "Cannot open archive file: ");
+
+        // Read
+        {
+            BinaryInputArchiveOpener archive_opener_in(archive_dir, archive_file);
+            boost::archive::binary_iarchive* p_arch = archive_opener_in.GetCommonArchive();
+            boost::archive::binary_iarchive* p_process_arch = ProcessSpecificArchive<boost::archive::binary_iarchive>::Get();
+
+            unsigned test_int1, test_int2;
+            std::vector<double> test_vector2;
+            (*p_arch) & test_int1;
+            (*p_process_arch) & test_int2;
+            (*p_process_arch) & test_vector2;
+
+            TS_ASSERT_EQUALS(test_int1, test_int);
+            TS_ASSERT_EQUALS(test_int2, test_int);
+            TS_ASSERT_EQUALS(test_vector2.size(), test_vector.size());
+            for (unsigned i=0; i<test_vector.size(); i++)
+            {
+                // Binary archives store doubles exactly
+                TS_ASSERT_EQUALS(test_vector2[i], test_vector[i]);
+            }
+        }
+
+        // Opening an archive with the wrong format gives a sensible error
+        TS_ASSERT_THROWS_CONTAINS(InputArchiveOpener archive_opener_in(archive_dir, archive_file),
+                                  "is not a text archive");
+        TS_ASSERT_THROWS_CONTAINS(BinaryInputArchiveOpener archive_opener_in(archive_dir, text_archive_file),
+                                  "is not a binary archive");
+
+        PetscTools::Barrier("TestBinaryArchiveOpenerReadAndWrite");
+    }
+
     void TestSpecifyingSecondaryArchive()
     {
         FileFinder archive_dir("archive", RelativeTo::ChasteTestOutput);
@@ -0,0 +1,109 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTBENCHMARKRECORDER_HPP_
+#define TESTBENCHMARKRECORDER_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include <fstream>
+#include <sstream>
+
+#include "BenchmarkRecorder.hpp"
+#include "FileFinder.hpp"
+#include "Timer.hpp"
+
+#include "PetscSetupAndFinalize.hpp"
+
+class TestBenchmarkRecorder : public CxxTest::TestSuite
+{
+public:
+    void TestRecordAndWrite()
+    {
+        BenchmarkRecorder recorder("TestSuite");
+        TS_ASSERT_EQUALS(recorder.GetNumBenchmarks(), 0u);
+        TS_ASSERT_THROWS_THIS(recorder.StopBenchmark(), "No benchmark is in progress.");
+        TS_ASSERT_THROWS_THIS(recorder.AddParameter("size", 1.0), "No benchmark has been started.");
+
+        recorder.StartBenchmark("Sleep");
+        recorder.AddParameter("size", 3.0);
+        TS_ASSERT_THROWS_THIS(recorder.StartBenchmark("Other"), "Benchmark 'Sleep' has not been stopped.");
+        TS_ASSERT_EQUALS(recorder.GetNumBenchmarks(), 0u);
+        double min_end = Timer::GetWallTime() + 0.01;
+        while (Timer::GetWallTime() < min_end)
+        {
+        }
+        recorder.StopBenchmark();
+        TS_ASSERT_EQUALS(recorder.GetNumBenchmarks(), 1u);
+        TS_ASSERT_LESS_THAN_EQUALS(0.01, recorder.GetMaxTime(0));
+        TS_ASSERT_THROWS_THIS(recorder.GetMaxTime(1), "There is no completed benchmark with index 1.");
+
+        recorder.StartBenchmark("Nothing");
+        recorder.AddParameter("size", 1.0);
+        recorder.AddParameter("steps", 10.0);
+        recorder.StopBenchmark();
+
+        // Strings are escaped in the output
+        recorder.StartBenchmark("Say \"hi\"\\\t\x01");
+        recorder.StopBenchmark();
+
+        // A benchmark still running is not written
+        recorder.StartBenchmark("Unfinished");
+        recorder.WriteJson("TestBenchmarkRecorder");
+        recorder.StopBenchmark();
+
+        FileFinder json_file("TestBenchmarkRecorder/TestSuite.json", RelativeTo::ChasteTestOutput);
+        TS_ASSERT(json_file.IsFile());
+        std::ifstream file(json_file.GetAbsolutePath().c_str());
+        std::stringstream contents;
+        contents << file.rdbuf();
+        std::string json = contents.str();
+
+        std::stringstream num_procs;
+        num_procs << "\"num_procs\": " << PetscTools::GetNumProcs() << ",";
+        TS_ASSERT_DIFFERS(json.find("\"suite\": \"TestSuite\","), std::string::npos);
+        TS_ASSERT_DIFFERS(json.find(num_procs.str()), std::string::npos);
+        TS_ASSERT_DIFFERS(json.find("\"name\": \"Sleep\","), std::string::npos);
+        TS_ASSERT_DIFFERS(json.find("\"parameters\": {\"size\": 3},"), std::string::npos);
+        TS_ASSERT_DIFFERS(json.find("\"parameters\": {\"size\": 1, \"steps\": 10},"), std::string::npos);
+        TS_ASSERT_DIFFERS(json.find("\"name\": \"Say \\\"hi\\\"\\\\\\t\\u0001\","), std::string::npos);
+        TS_ASSERT_EQUALS(json.find("Unfinished"), std::string::npos);
+        TS_ASSERT_EQUALS(json.substr(json.size()-6u), "  ]\n}\n");
+
+        TS_ASSERT_EQUALS(BenchmarkRecorder::GetUnsignedOption("-benchmark_no_such_option", 7u), 7u);
+    }
+};
+
+#endif /*TESTBENCHMARKRECORDER_HPP_*/
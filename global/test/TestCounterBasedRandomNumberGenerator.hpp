@@ -0,0 +1,235 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTCOUNTERBASEDRANDOMNUMBERGENERATOR_HPP_
+#define TESTCOUNTERBASEDRANDOMNUMBERGENERATOR_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include "CheckpointArchiveTypes.hpp"
+
+#include "CounterBasedRandomNumberGenerator.hpp"
+#include "OutputFileHandler.hpp"
+
+//This test is always run sequentially (never in parallel)
+#include "FakePetscSetup.hpp"
+
+class TestCounterBasedRandomNumberGenerator : public CxxTest::TestSuite
+{
+public:
+
+    void TestPhiloxKnownAnswers()
+    {
+        // Known answer tests from the Random123 distribution (kat_vectors, philox4x32 with 10 rounds)
+        boost::uint32_t output[4];
+
+        boost::uint32_t zero_counter[4] = {0u, 0u, 0u, 0u};
+        boost::uint32_t zero_key[2] = {0u, 0u};
+        CounterBasedRandomStream::Philox4x32(zero_counter, zero_key, output);
+        TS_ASSERT_EQUALS(output[0], 0x6627e8d5u);
+        TS_ASSERT_EQUALS(output[1], 0xe169c58du);
+        TS_ASSERT_EQUALS(output[2], 0xbc57ac4cu);
+        TS_ASSERT_EQUALS(output[3], 0x9b00dbd8u);
+
+        boost::uint32_t max_counter[4] = {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu};
+        boost::uint32_t max_key[2] = {0xffffffffu, 0xffffffffu};
+        CounterBasedRandomStream::Philox4x32(max_counter, max_key, output);
+        TS_ASSERT_EQUALS(output[0], 0x408f276du);
+        TS_ASSERT_EQUALS(output[1], 0x41c83b0eu);
+        TS_ASSERT_EQUALS(output[2], 0xa20bc7c6u);
+        TS_ASSERT_EQUALS(output[3], 0x6d5451fdu);
+
+        boost::uint32_t pi_counter[4] = {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u};
+        boost::uint32_t pi_key[2] = {0xa4093822u, 0x299f31d0u};
+        CounterBasedRandomStream::Philox4x32(pi_counter, pi_key, output);
+        TS_ASSERT_EQUALS(output[0], 0xd16cfe09u);
+        TS_ASSERT_EQUALS(output[1], 0x94fdccebu);
+        TS_ASSERT_EQUALS(output[2], 0x5001e420u);
+        TS_ASSERT_EQUALS(output[3], 0x24126ea1u);
+    }
+
+    void TestStreamsAreReproducibleAndIndependent()
+    {
+        CounterBasedRandomNumberGenerator* p_gen = CounterBasedRandomNumberGenerator::Instance();
+        TS_ASSERT_EQUALS(p_gen->GetSeed(), 0u);
+        p_gen->Reseed(17);
+        TS_ASSERT_EQUALS(p_gen->GetSeed(), 17u);
+
+        // The same identifiers give the same sequence, whatever has been drawn elsewhere
+        CounterBasedRandomStream stream_a = p_gen->GetStream(3, 10, 1);
+        std::vector<double> first_draws;
+        for (unsigned i = 0; i < 10; i++)
+        {
+            first_draws.push_back(stream_a.ranf());
+        }
+
+        CounterBasedRandomStream other_stream = p_gen->GetStream(4, 10, 1);
+        other_stream.ranf();
+
+        CounterBasedRandomStream stream_b = p_gen->GetStream(3, 10, 1);
+        for (unsigned i = 0; i < 10; i++)
+        {
+            TS_ASSERT_EQUALS(stream_b.ranf(), first_draws[i]);
+        }
+
+        // Changing any identifier or the seed changes the sequence
+        TS_ASSERT_DIFFERS(p_gen->GetStream(4, 10, 1).ranf(), first_draws[0]);
+        TS_ASSERT_DIFFERS(p_gen->GetStream(3, 11, 1).ranf(), first_draws[0]);
+        TS_ASSERT_DIFFERS(p_gen->GetStream(3, 10, 2).ranf(), first_draws[0]);
+        p_gen->Reseed(18);
+        TS_ASSERT_DIFFERS(p_gen->GetStream(3, 10, 1).ranf(), first_draws[0]);
+
+        CounterBasedRandomNumberGenerator::Destroy();
+    }
+
+    void TestDistributions()
+    {
+        CounterBasedRandomStream stream = CounterBasedRandomNumberGenerator::Instance()->GetStream(0);
+
+        const unsigned num_samples = 100000;
+        double uniform_sum = 0.0;
+        double normal_sum = 0.0;
+        double normal_sum_squares = 0.0;
+        double exponential_sum = 0.0;
+        std::vector<unsigned> counts(5, 0u);
+        for (unsigned i = 0; i < num_samples; i++)
+        {
+            double uniform = stream.ranf();
+            TS_ASSERT_LESS_THAN(0.0, uniform);
+            TS_ASSERT_LESS_THAN_EQUALS(uniform, 1.0);
+            uniform_sum += uniform;
+
+            double normal = stream.NormalRandomDeviate(2.0, 0.5);
+            normal_sum += normal;
+            normal_sum_squares += normal*normal;
+
+            exponential_sum += stream.ExponentialRandomDeviate(4.0);
+
+            unsigned integer = stream.randMod(5);
+            TS_ASSERT_LESS_THAN(integer, 5u);
+            counts[integer]++;
+        }
+
+        TS_ASSERT_DELTA(uniform_sum/num_samples, 0.5, 1e-2);
+        double normal_mean = normal_sum/num_samples;
+        TS_ASSERT_DELTA(normal_mean, 2.0, 1e-2);
+        TS_ASSERT_DELTA(normal_sum_squares/num_samples - normal_mean*normal_mean, 0.25, 1e-2);
+        TS_ASSERT_DELTA(exponential_sum/num_samples, 0.25, 1e-2);
+        for (unsigned i = 0; i < 5; i++)
+        {
+            TS_ASSERT_DELTA(counts[i]/(double)num_samples, 0.2, 1e-2);
+        }
+        TS_ASSERT_EQUALS(stream.randMod(1), 0u);
+
+        CounterBasedRandomNumberGenerator::Destroy();
+    }
+
+    void TestBulkGeneration()
+    {
+        CounterBasedRandomNumberGenerator* p_gen = CounterBasedRandomNumberGenerator::Instance();
+
+        // Bulk uniforms match repeated calls to ranf(), including after a partial block has been used
+        for (unsigned num_values = 0; num_values < 6; num_values++)
+        {
+            CounterBasedRandomStream bulk_stream = p_gen->GetStream(7);
+            CounterBasedRandomStream single_stream = p_gen->GetStream(7);
+            TS_ASSERT_EQUALS(bulk_stream.ranf(), single_stream.ranf());
+            TS_ASSERT_EQUALS(bulk_stream.randMod(100), single_stream.randMod(100));
+
+            std::vector<double> values(num_values);
+            bulk_stream.FillUniform(values);
+            for (unsigned i = 0; i < num_values; i++)
+            {
+                TS_ASSERT_EQUALS(values[i], single_stream.ranf());
+            }
+            TS_ASSERT_EQUALS(bulk_stream.ranf(), single_stream.ranf());
+        }
+
+        // Bulk normals match repeated calls to StandardNormalRandomDeviate() on a fresh stream
+        std::vector<double> normals(7);
+        CounterBasedRandomStream bulk_stream = p_gen->GetStream(8);
+        bulk_stream.FillStandardNormal(normals);
+        CounterBasedRandomStream single_stream = p_gen->GetStream(8);
+        for (unsigned i = 0; i < normals.size(); i++)
+        {
+            TS_ASSERT_DELTA(normals[i], single_stream.StandardNormalRandomDeviate(), 1e-12);
+        }
+
+        CounterBasedRandomNumberGenerator::Destroy();
+    }
+
+    void TestArchiveCounterBasedRandomNumberGenerator()
+    {
+        OutputFileHandler handler("archive", false);
+        std::string archive_filename = handler.GetOutputDirectoryFullPath() + "counter_based_random_number.arch";
+
+        double first_draw;
+
+        // Create and archive the generator
+        {
+            CounterBasedRandomNumberGenerator* p_gen = CounterBasedRandomNumberGenerator::Instance();
+            p_gen->Reseed(7);
+            first_draw = p_gen->GetStream(1, 2, 3).ranf();
+
+            std::ofstream ofs(archive_filename.c_str());
+            boost::archive::text_oarchive output_arch(ofs);
+
+            SerializableSingleton<CounterBasedRandomNumberGenerator>* const p_wrapper = p_gen->GetSerializationWrapper();
+            output_arch << p_wrapper;
+
+            CounterBasedRandomNumberGenerator::Destroy();
+        }
+
+        // Restore
+        {
+            CounterBasedRandomNumberGenerator* p_gen = CounterBasedRandomNumberGenerator::Instance();
+            p_gen->Reseed(25);
+
+            std::ifstream ifs(archive_filename.c_str(), std::ios::binary);
+            boost::archive::text_iarchive input_arch(ifs);
+
+            SerializableSingleton<CounterBasedRandomNumberGenerator>* p_wrapper;
+            input_arch >> p_wrapper;
+            TS_ASSERT_EQUALS(p_gen, CounterBasedRandomNumberGenerator::Instance());
+
+            TS_ASSERT_EQUALS(p_gen->GetSeed(), 7u);
+            TS_ASSERT_EQUALS(p_gen->GetStream(1, 2, 3).ranf(), first_draw);
+
+            CounterBasedRandomNumberGenerator::Destroy();
+        }
+    }
+};
+
+#endif /*TESTCOUNTERBASEDRANDOMNUMBERGENERATOR_HPP_*/
@@ -36,6 +36,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef TESTGENERICEVENTHANDLER_HPP_
 #define TESTGENERICEVENTHANDLER_HPP_
 
+#include <fstream>
+
+#include "FileFinder.hpp"
 #include "GenericEventHandler.hpp"
 #include "PetscSetupAndFinalize.hpp"
 
@@ -186,6 +189,155 @@ public:
         AnEventHandler::EndEvent(AnEventHandler::TEST3);
         AnEventHandler::Report();
     }
+
+    void TestTracing()
+    {
+        AnEventHandler::Reset();
+        TS_ASSERT(!AnEventHandler::IsTracing());
+        TS_ASSERT_THROWS_THIS(AnEventHandler::EnableTracing(0u),
+                              "The trace buffer must be able to hold at least one event.");
+
+        // Only completed events are recorded
+        AnEventHandler::EnableTracing(4u);
+        TS_ASSERT(AnEventHandler::IsTracing());
+        AnEventHandler::BeginEvent(AnEventHandler::TEST1);
+        AnEventHandler::MilliSleep(10);
+        TS_ASSERT_EQUALS(AnEventHandler::GetNumberOfTraceRecords(), 0u);
+        AnEventHandler::EndEvent(AnEventHandler::TEST1);
+        TS_ASSERT_EQUALS(AnEventHandler::GetNumberOfTraceRecords(), 1u);
+
+        TS_ASSERT_EQUALS(AnEventHandler::Instance()->mTraceBuffer[0].mEvent, (unsigned)AnEventHandler::TEST1);
+        TS_ASSERT_LESS_THAN_EQUALS(0.010, AnEventHandler::Instance()->mTraceBuffer[0].mEnd
+                                          - AnEventHandler::Instance()->mTraceBuffer[0].mStart);
+
+        // Overflow the ring buffer, so the first few events are lost
+        for (unsigned i=0; i<4u; i++)
+        {
+            AnEventHandler::BeginEvent(AnEventHandler::TEST2);
+            AnEventHandler::EndEvent(AnEventHandler::TEST2);
+        }
+        TS_ASSERT_EQUALS(AnEventHandler::GetNumberOfTraceRecords(), 5u);
+
+        // Nothing is recorded once tracing is disabled
+        AnEventHandler::DisableTracing();
+        TS_ASSERT(!AnEventHandler::IsTracing());
+        AnEventHandler::BeginEvent(AnEventHandler::TEST2);
+        AnEventHandler::EndEvent(AnEventHandler::TEST2);
+        TS_ASSERT_EQUALS(AnEventHandler::GetNumberOfTraceRecords(), 5u);
+
+        AnEventHandler::WriteTrace("TestGenericEventHandler", "trace.json");
+
+        FileFinder trace_file("TestGenericEventHandler/trace.json", RelativeTo::ChasteTestOutput);
+        TS_ASSERT(trace_file.IsFile());
+        std::ifstream file(trace_file.GetAbsolutePath().c_str());
+        std::string line;
+        std::getline(file, line);
+        TS_ASSERT_EQUALS(line, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+        unsigned num_test1 = 0;
+        unsigned num_test2 = 0;
+        unsigned num_processes = 0;
+        while (std::getline(file, line))
+        {
+            if (line.find("\"name\":\"Test1\"") != std::string::npos)
+            {
+                num_test1++;
+            }
+            if (line.find("\"name\":\"Test2\"") != std::string::npos)
+            {
+                num_test2++;
+            }
+            if (line.find("process_name") != std::string::npos)
+            {
+                num_processes++;
+            }
+        }
+        TS_ASSERT_EQUALS(line, "]}");
+        TS_ASSERT_EQUALS(num_test1, 0u);
+        TS_ASSERT_EQUALS(num_test2, 4u*PetscTools::GetNumProcs());
+        TS_ASSERT_EQUALS(num_processes, PetscTools::GetNumProcs());
+
+        AnEventHandler::Report();
+    }
+
+    void TestHardwareCounters()
+    {
+        // Counters may not be available (e.g. in a virtual machine), in which case they read as zero
+        HardwareCounters counters;
+        TS_ASSERT(!counters.IsOpen());
+        bool available = counters.Open();
+        TS_ASSERT_EQUALS(counters.IsOpen(), available);
+        TS_ASSERT(!counters.IsAvailable(HardwareCounters::NUM_COUNTERS));
+
+        double before[HardwareCounters::NUM_COUNTERS];
+        double after[HardwareCounters::NUM_COUNTERS];
+        counters.Read(before);
+        AnEventHandler::MilliSleep(10);
+        counters.Read(after);
+        for (unsigned counter=0; counter<HardwareCounters::NUM_COUNTERS; counter++)
+        {
+            if (counters.IsAvailable(counter))
+            {
+                TS_ASSERT_LESS_THAN_EQUALS(before[counter], after[counter]);
+            }
+            else
+            {
+                TS_ASSERT_EQUALS(after[counter], 0.0);
+            }
+        }
+        if (counters.IsAvailable(HardwareCounters::INSTRUCTIONS))
+        {
+            TS_ASSERT_LESS_THAN(before[HardwareCounters::INSTRUCTIONS], after[HardwareCounters::INSTRUCTIONS]);
+        }
+        counters.Close();
+        TS_ASSERT(!counters.IsOpen());
+        TS_ASSERT(!counters.IsAvailable(HardwareCounters::CYCLES));
+
+        // Counters are accumulated per event by the event handler
+        AnEventHandler::Reset();
+        TS_ASSERT_EQUALS(AnEventHandler::EnableHardwareCounters(), available);
+        AnEventHandler::BeginEvent(AnEventHandler::TEST1);
+        AnEventHandler::MilliSleep(10);
+        AnEventHandler::EndEvent(AnEventHandler::TEST1);
+        if (available)
+        {
+            TS_ASSERT_LESS_THAN(0.0, AnEventHandler::GetHardwareCounterValue(AnEventHandler::TEST1, HardwareCounters::CYCLES)
+                                     + AnEventHandler::GetHardwareCounterValue(AnEventHandler::TEST1, HardwareCounters::INSTRUCTIONS));
+        }
+        else
+        {
+            TS_ASSERT_EQUALS(AnEventHandler::GetHardwareCounterValue(AnEventHandler::TEST1, HardwareCounters::INSTRUCTIONS), 0.0);
+        }
+        TS_ASSERT_EQUALS(AnEventHandler::GetHardwareCounterValue(AnEventHandler::TEST2, HardwareCounters::INSTRUCTIONS), 0.0);
+        AnEventHandler::Report();
+
+        // Reporting resets the totals
+        TS_ASSERT_EQUALS(AnEventHandler::GetHardwareCounterValue(AnEventHandler::TEST1, HardwareCounters::CYCLES), 0.0);
+
+        // Events in progress when the counters are disabled or enabled do not accumulate them
+        AnEventHandler::BeginEvent(AnEventHandler::TEST2);
+        AnEventHandler::DisableHardwareCounters();
+        AnEventHandler::EndEvent(AnEventHandler::TEST2);
+        AnEventHandler::BeginEvent(AnEventHandler::TEST2);
+        TS_ASSERT_EQUALS(AnEventHandler::EnableHardwareCounters(), available);
+        AnEventHandler::MilliSleep(10);
+        AnEventHandler::EndEvent(AnEventHandler::TEST2);
+        for (unsigned counter=0; counter<HardwareCounters::NUM_COUNTERS; counter++)
+        {
+            TS_ASSERT_EQUALS(AnEventHandler::GetHardwareCounterValue(AnEventHandler::TEST2, counter), 0.0);
+        }
+
+        // But they do once the counters are enabled before the event begins
+        AnEventHandler::BeginEvent(AnEventHandler::TEST2);
+        AnEventHandler::MilliSleep(10);
+        AnEventHandler::EndEvent(AnEventHandler::TEST2);
+        if (available)
+        {
+            TS_ASSERT_LESS_THAN(0.0, AnEventHandler::GetHardwareCounterValue(AnEventHandler::TEST2, HardwareCounters::CYCLES)
+                                     + AnEventHandler::GetHardwareCounterValue(AnEventHandler::TEST2, HardwareCounters::INSTRUCTIONS));
+        }
+        AnEventHandler::Reset();
+        AnEventHandler::DisableHardwareCounters();
+    }
 };
 
 #endif /*TESTGENERICEVENTHANDLER_HPP_*/
@@ -240,9 +240,9 @@ OdeSolution AbstractBackwardEulerCardiacCell<SIZE>::Compute(double tStart, doubl
 
     // Initialise solution store
     OdeSolution solutions;
+    solutions.SetSink(this->mpSolutionSink);
     solutions.SetNumberOfTimeSteps(n_steps);
-    solutions.rGetSolutions().push_back(rGetStateVariables());
-    solutions.rGetTimes().push_back(tStart);
+    solutions.AddSample(tStart, rGetStateVariables());
     solutions.SetOdeSystemInformation(this->mpSystemInfo);
 
     // Loop over time
@@ -264,8 +264,7 @@ OdeSolution AbstractBackwardEulerCardiacCell<SIZE>::Compute(double tStart, doubl
         }
 
         // Update solutions
-        solutions.rGetSolutions().push_back(rGetStateVariables());
-        solutions.rGetTimes().push_back(curr_time+mDt);
+        solutions.AddSample(curr_time+mDt, rGetStateVariables());
     }
 
     return solutions;
@@ -399,9 +398,9 @@ public:
 
         // Initialise solution store
         OdeSolution solutions;
+        solutions.SetSink(this->mpSolutionSink);
         solutions.SetNumberOfTimeSteps(n_steps);
-        solutions.rGetSolutions().push_back(rGetStateVariables());
-        solutions.rGetTimes().push_back(tStart);
+        solutions.AddSample(tStart, rGetStateVariables());
         solutions.SetOdeSystemInformation(this->mpSystemInfo);
 
         // Loop over time
@@ -423,8 +422,7 @@ public:
             }
 
             // Update solutions
-            solutions.rGetSolutions().push_back(rGetStateVariables());
-            solutions.rGetTimes().push_back(curr_time+mDt);
+            solutions.AddSample(curr_time+mDt, rGetStateVariables());
         }
 
         return solutions;
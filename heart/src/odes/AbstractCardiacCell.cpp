@@ -78,7 +78,36 @@ OdeSolution AbstractCardiacCell::Compute(double tStart, double tEnd, double tSam
     {
         tSamp = mDt;
     }
-    return mpOdeSolver->Solve(this, rGetStateVariables(), tStart, tEnd, mDt, tSamp);
+    if (!mpSolutionSink)
+    {
+        return mpOdeSolver->Solve(this, rGetStateVariables(), tStart, tEnd, mDt, tSamp);
+    }
+
+    // Use our sink for this solve only, since the solver may be shared with other cells
+    boost::shared_ptr<AbstractOdeSolutionSink> p_solver_sink = mpOdeSolver->GetSolutionSink();
+    mpOdeSolver->SetSolutionSink(mpSolutionSink);
+    OdeSolution solutions;
+    try
+    {
+        solutions = mpOdeSolver->Solve(this, rGetStateVariables(), tStart, tEnd, mDt, tSamp);
+    }
+    catch (const Exception&)
+    {
+        mpOdeSolver->SetSolutionSink(p_solver_sink);
+        throw;
+    }
+    mpOdeSolver->SetSolutionSink(p_solver_sink);
+    return solutions;
+}
+
+void AbstractCardiacCell::SetSolutionSink(boost::shared_ptr<AbstractOdeSolutionSink> pSink)
+{
+    mpSolutionSink = pSink;
+}
+
+boost::shared_ptr<AbstractOdeSolutionSink> AbstractCardiacCell::GetSolutionSink() const
+{
+    return mpSolutionSink;
 }
 
 void AbstractCardiacCell::ComputeExceptVoltage(double tStart, double tEnd)
@@ -136,6 +136,12 @@ protected:
     /** The timestep to use when simulating this cell.  Set from the HeartConfig object. */
     double mDt;
 
+    /**
+     * If set, the samples computed by Compute() are passed to this sink rather than
+     * stored in the returned OdeSolution.  Not archived.
+     */
+    boost::shared_ptr<AbstractOdeSolutionSink> mpSolutionSink;
+
 public:
     /** Create a new cardiac cell. The state variables of the cell will be
      *  set to AbstractOdeSystemInformation::GetInitialConditions(). Note that
@@ -172,6 +178,20 @@ public:
      */
     void SetTimestep(double dt);
 
+    /**
+     * Stream the samples computed by Compute() to a sink, rather than storing them in the
+     * returned OdeSolution.  For cells simulated with an ODE solver this takes precedence
+     * over any sink set on the solver itself.
+     *
+     * @param pSink  the sink (an empty pointer means store samples as normal)
+     */
+    void SetSolutionSink(boost::shared_ptr<AbstractOdeSolutionSink> pSink);
+
+    /**
+     * @return the sink that samples computed by Compute() are streamed to, if any.
+     */
+    boost::shared_ptr<AbstractOdeSolutionSink> GetSolutionSink() const;
+
     /**
      * Simulate this cell's behaviour between the time interval [tStart, tEnd],
      * with timestemp #mDt, updating the internal state variable values.
@@ -50,6 +50,8 @@ const char CardiacCellChasteCitation[] = "@article{cooper2015cce,\n"
 "  doi = {10.3389/fphys.2014.00511},\n"
 "}\n";
 
+unsigned AbstractCardiacCellInterface::mStimulusChangeCounter = 0u;
+
 AbstractCardiacCellInterface::AbstractCardiacCellInterface(
             boost::shared_ptr<AbstractIvpOdeSolver> pOdeSolver,
             unsigned voltageIndex,
@@ -94,6 +96,12 @@ double AbstractCardiacCellInterface::GetStimulus(double time)
 void AbstractCardiacCellInterface::SetIntracellularStimulusFunction(boost::shared_ptr<AbstractStimulusFunction> pStimulus)
 {
     mpIntracellularStimulus = pStimulus;
+    mStimulusChangeCounter++;
+}
+
+unsigned AbstractCardiacCellInterface::GetStimulusChangeCounter()
+{
+    return mStimulusChangeCounter;
 }
 
 
@@ -296,6 +296,13 @@ public:
      */
     void SetIntracellularStimulusFunction(boost::shared_ptr<AbstractStimulusFunction> pStimulus);
 
+    /**
+     * @return a counter incremented whenever any cell has its intracellular stimulus function
+     * replaced. Used by tissues to detect when cached information about which cells are
+     * stimulated needs to be regenerated.
+     */
+    static unsigned GetStimulusChangeCounter();
+
     /**
      * @return the value of the intracellular stimulus.
      * This will have units of uA/cm^2 for single-cell problems,
@@ -432,6 +439,9 @@ protected:
     /** The intracellular stimulus current. */
     boost::shared_ptr<AbstractStimulusFunction> mpIntracellularStimulus;
 
+    /** Number of times any cell has had its intracellular stimulus function replaced. */
+    static unsigned mStimulusChangeCounter;
+
     /**
      * Flag set to true if ComputeExceptVoltage is called, to indicate
      * to subclass EvaluateYDerivatives methods that V should be
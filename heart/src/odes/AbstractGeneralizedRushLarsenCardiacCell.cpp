@@ -81,9 +81,9 @@ OdeSolution AbstractGeneralizedRushLarsenCardiacCell::Compute(double tStart, dou
 
     // Initialise solution store
     OdeSolution solutions;
+    solutions.SetSink(this->mpSolutionSink);
     solutions.SetNumberOfTimeSteps(n_steps);
-    solutions.rGetSolutions().push_back(rGetStateVariables());
-    solutions.rGetTimes().push_back(tStart);
+    solutions.AddSample(tStart, rGetStateVariables());
     solutions.SetOdeSystemInformation(this->mpSystemInfo);
 
     // Loop over time
@@ -105,8 +105,7 @@ OdeSolution AbstractGeneralizedRushLarsenCardiacCell::Compute(double tStart, dou
         }
 
         // Update solutions
-        solutions.rGetSolutions().push_back(rGetStateVariables());
-        solutions.rGetTimes().push_back(curr_time+mDt);
+        solutions.AddSample(curr_time+mDt, rGetStateVariables());
     }
 
     return solutions;
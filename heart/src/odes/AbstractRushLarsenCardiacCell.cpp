@@ -73,9 +73,9 @@ OdeSolution AbstractRushLarsenCardiacCell::Compute(double tStart, double tEnd, d
 
     // Initialise solution store
     OdeSolution solutions;
+    solutions.SetSink(this->mpSolutionSink);
     solutions.SetNumberOfTimeSteps(n_steps);
-    solutions.rGetSolutions().push_back(rGetStateVariables());
-    solutions.rGetTimes().push_back(tStart);
+    solutions.AddSample(tStart, rGetStateVariables());
     solutions.SetOdeSystemInformation(this->mpSystemInfo);
 
     std::vector<double> dy(mNumberOfStateVariables, 0);
@@ -96,8 +96,7 @@ OdeSolution AbstractRushLarsenCardiacCell::Compute(double tStart, double tEnd, d
         }
 
         // Update solutions
-        solutions.rGetSolutions().push_back(rGetStateVariables());
-        solutions.rGetTimes().push_back(curr_time+mDt);
+        solutions.AddSample(curr_time+mDt, rGetStateVariables());
     }
 
     return solutions;
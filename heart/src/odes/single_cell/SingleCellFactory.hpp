@@ -0,0 +1,85 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef SINGLECELLFACTORY_HPP_
+#define SINGLECELLFACTORY_HPP_
+
+#include "AbstractSingleCellFactory.hpp"
+#include "EulerIvpOdeSolver.hpp"
+
+/**
+ * A single cell factory for a cell model class with the usual
+ * (solver, stimulus) constructor.
+ *
+ * Each cell gets its own instance of SOLVER. CVODE cells ignore the solver.
+ */
+template<class CELL, class SOLVER=EulerIvpOdeSolver>
+class SingleCellFactory : public AbstractSingleCellFactory
+{
+private:
+    /** The timestep to give each cell, or 0 to keep the cell's default. */
+    double mTimestep;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param timestep  the timestep (maximum timestep for CVODE cells) to give each cell;
+     *     defaults to 0, meaning keep the cell's default
+     */
+    SingleCellFactory(double timestep=0.0)
+        : mTimestep(timestep)
+    {
+    }
+
+    /**
+     * Create a new cell.
+     *
+     * @param pStimulus  the intracellular stimulus to give the cell
+     * @return the new cell
+     */
+    boost::shared_ptr<AbstractCardiacCellInterface> CreateCell(boost::shared_ptr<AbstractStimulusFunction> pStimulus)
+    {
+        boost::shared_ptr<AbstractIvpOdeSolver> p_solver(new SOLVER);
+        boost::shared_ptr<AbstractCardiacCellInterface> p_cell(new CELL(p_solver, pStimulus));
+        if (mTimestep > 0.0)
+        {
+            p_cell->SetTimestep(mTimestep);
+        }
+        return p_cell;
+    }
+};
+
+#endif // SINGLECELLFACTORY_HPP_
@@ -0,0 +1,330 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "SingleCellParameterSweep.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "CellProperties.hpp"
+#include "Exception.hpp"
+#include "OdeSolution.hpp"
+#include "OutputFileHandler.hpp"
+#include "PetscTools.hpp"
+
+SingleCellParameterSweep::SingleCellParameterSweep(boost::shared_ptr<AbstractSingleCellFactory> pFactory,
+                                                   boost::shared_ptr<RegularStimulus> pStimulus,
+                                                   const std::vector<std::string>& rParameterNames)
+    : mpFactory(pFactory),
+      mpStimulus(pStimulus),
+      mParameterNames(rParameterNames),
+      mMaxNumPaces(100u),
+      mSteadyStateTolerance(0.0),
+      mSamplingInterval(0.1),
+      mThreshold(-30.0),
+      mReuseCells(true)
+{
+    mMetricNames.resize(NUM_METRICS);
+    mMetricNames[APD90] = "APD90";
+    mMetricNames[APD50] = "APD50";
+    mMetricNames[PEAK_VOLTAGE] = "PeakVoltage";
+    mMetricNames[RESTING_VOLTAGE] = "RestingVoltage";
+    mMetricNames[MAX_UPSTROKE_VELOCITY] = "MaxUpstrokeVelocity";
+    mMetricNames[PEAK_CALCIUM] = "PeakCalcium";
+    mMetricNames[DIASTOLIC_CALCIUM] = "DiastolicCalcium";
+    mMetricNames[CALCIUM_TRANSIENT_AMPLITUDE] = "CalciumTransientAmplitude";
+    mMetricNames[NUM_PACES] = "NumPaces";
+    mMetricNames[FINAL_PACE_STATE_CHANGE] = "FinalPaceStateChange";
+}
+
+void SingleCellParameterSweep::AddParameterSet(const std::vector<double>& rScalings)
+{
+    if (rScalings.size() != mParameterNames.size())
+    {
+        EXCEPTION("A parameter set must have one scaling factor per parameter name (" << mParameterNames.size()
+                  << "), not " << rScalings.size() << ".");
+    }
+    mParameterSets.push_back(rScalings);
+}
+
+void SingleCellParameterSweep::AddParameterGrid(const std::vector<std::vector<double> >& rScalingsPerParameter)
+{
+    if (rScalingsPerParameter.size() != mParameterNames.size())
+    {
+        EXCEPTION("A parameter grid must have one list of scaling factors per parameter name (" << mParameterNames.size()
+                  << "), not " << rScalingsPerParameter.size() << ".");
+    }
+    unsigned num_sets = 1u;
+    for (unsigned i=0; i<rScalingsPerParameter.size(); i++)
+    {
+        num_sets *= rScalingsPerParameter[i].size();
+    }
+
+    std::vector<double> scalings(mParameterNames.size());
+    for (unsigned set=0; set<num_sets; set++)
+    {
+        // Decode the set index with the last parameter varying fastest
+        unsigned remainder = set;
+        for (unsigned i=mParameterNames.size(); i-- > 0; )
+        {
+            const unsigned num_values = rScalingsPerParameter[i].size();
+            scalings[i] = rScalingsPerParameter[i][remainder % num_values];
+            remainder /= num_values;
+        }
+        mParameterSets.push_back(scalings);
+    }
+}
+
+const std::vector<std::vector<double> >& SingleCellParameterSweep::rGetParameterSets() const
+{
+    return mParameterSets;
+}
+
+const std::vector<std::string>& SingleCellParameterSweep::rGetMetricNames() const
+{
+    return mMetricNames;
+}
+
+void SingleCellParameterSweep::SetMaxNumPaces(unsigned maxNumPaces)
+{
+    if (maxNumPaces == 0u)
+    {
+        EXCEPTION("Please set a maximum number of paces that is positive");
+    }
+    mMaxNumPaces = maxNumPaces;
+}
+
+void SingleCellParameterSweep::SetSteadyStateTolerance(double tolerance)
+{
+    mSteadyStateTolerance = tolerance;
+}
+
+void SingleCellParameterSweep::SetSamplingInterval(double samplingInterval)
+{
+    mSamplingInterval = samplingInterval;
+}
+
+void SingleCellParameterSweep::SetThreshold(double threshold)
+{
+    mThreshold = threshold;
+}
+
+void SingleCellParameterSweep::SetReuseCells(bool reuseCells)
+{
+    mReuseCells = reuseCells;
+}
+
+void SingleCellParameterSweep::SimulateCell(boost::shared_ptr<AbstractCardiacCellInterface> pCell, std::vector<double>& rMetrics)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    rMetrics.assign(mMetricNames.size(), nan);
+
+    const double period = mpStimulus->GetPeriod();
+    std::vector<double> old_state = pCell->GetStdVecStateVariables();
+    std::vector<double> new_state;
+    double state_change = nan;
+
+    // Pace until the final pace (or until steady), without storing anything
+    unsigned pace = 0u;
+    for (; pace+1u < mMaxNumPaces; pace++)
+    {
+        pCell->SolveAndUpdateState(pace*period, (pace+1u)*period);
+        new_state = pCell->GetStdVecStateVariables();
+        state_change = 0.0;
+        for (unsigned i=0; i<new_state.size(); i++)
+        {
+            state_change += fabs(new_state[i] - old_state[i]);
+        }
+        old_state.swap(new_state);
+        if (state_change < mSteadyStateTolerance)
+        {
+            pace++;
+            break;
+        }
+    }
+
+    // Record and analyse the final pace
+    OdeSolution solution = pCell->Compute(pace*period, (pace+1u)*period, mSamplingInterval);
+    new_state = pCell->GetStdVecStateVariables();
+    state_change = 0.0;
+    for (unsigned i=0; i<new_state.size(); i++)
+    {
+        state_change += fabs(new_state[i] - old_state[i]);
+    }
+    rMetrics[NUM_PACES] = pace + 1u;
+    rMetrics[FINAL_PACE_STATE_CHANGE] = state_change;
+
+    std::vector<double> voltages = solution.GetVariableAtIndex(pCell->GetVoltageIndex());
+    try
+    {
+        CellProperties properties(voltages, solution.rGetTimes(), mThreshold);
+        rMetrics[PEAK_VOLTAGE] = properties.GetLastPeakPotential();
+        rMetrics[RESTING_VOLTAGE] = properties.GetLastRestingPotential();
+        rMetrics[MAX_UPSTROKE_VELOCITY] = properties.GetLastMaxUpstrokeVelocity();
+        rMetrics[APD90] = properties.GetLastActionPotentialDuration(90.0);
+        rMetrics[APD50] = properties.GetLastActionPotentialDuration(50.0);
+    }
+    catch (const Exception&)
+    {
+        // No (complete) action potential in the final pace; leave the remaining metrics as NaN
+    }
+
+    const std::vector<std::string>& r_names = pCell->rGetStateVariableNames();
+    std::vector<std::string>::const_iterator it = std::find(r_names.begin(), r_names.end(), "cytosolic_calcium_concentration");
+    if (it != r_names.end())
+    {
+        std::vector<double> calcium = solution.GetVariableAtIndex(it - r_names.begin());
+        rMetrics[PEAK_CALCIUM] = *std::max_element(calcium.begin(), calcium.end());
+        rMetrics[DIASTOLIC_CALCIUM] = *std::min_element(calcium.begin(), calcium.end());
+        rMetrics[CALCIUM_TRANSIENT_AMPLITUDE] = rMetrics[PEAK_CALCIUM] - rMetrics[DIASTOLIC_CALCIUM];
+    }
+}
+
+void SingleCellParameterSweep::Run()
+{
+    const unsigned num_sets = mParameterSets.size();
+    if (num_sets == 0u)
+    {
+        EXCEPTION("No parameter sets have been added to the sweep.");
+    }
+    const unsigned num_metrics = mMetricNames.size();
+
+    // Contiguous block of parameter sets for this process
+    const unsigned num_procs = PetscTools::GetNumProcs();
+    const unsigned rank = PetscTools::GetMyRank();
+    const unsigned lo = (unsigned)(((unsigned long long)num_sets * rank) / num_procs);
+    const unsigned hi = (unsigned)(((unsigned long long)num_sets * (rank+1u)) / num_procs);
+
+    // Owned entries are filled in, the rest stay zero so that a sum gathers everything
+    std::vector<double> local_results(num_sets*num_metrics, 0.0);
+
+    boost::shared_ptr<AbstractCardiacCellInterface> p_cell;
+    std::vector<double> initial_state;
+    std::vector<double> default_parameters(mParameterNames.size());
+    std::vector<double> metrics;
+    try
+    {
+        for (unsigned set=lo; set<hi; set++)
+        {
+            if (!p_cell || !mReuseCells)
+            {
+                p_cell = mpFactory->CreateCell(mpStimulus);
+                initial_state = p_cell->GetStdVecStateVariables();
+                for (unsigned i=0; i<mParameterNames.size(); i++)
+                {
+                    default_parameters[i] = p_cell->GetParameter(mParameterNames[i]);
+                }
+            }
+            else
+            {
+                p_cell->SetStateVariables(initial_state);
+            }
+            for (unsigned i=0; i<mParameterNames.size(); i++)
+            {
+                p_cell->SetParameter(mParameterNames[i], default_parameters[i] * mParameterSets[set][i]);
+            }
+
+            try
+            {
+                SimulateCell(p_cell, metrics);
+            }
+            catch (const Exception&)
+            {
+                // These parameters are no good (e.g. the model is unstable), so record the failure and move on.
+                // The cell may be left in a state that can't be reset cleanly, so start the next set afresh.
+                metrics.assign(num_metrics, std::numeric_limits<double>::quiet_NaN());
+                p_cell.reset();
+            }
+            std::copy(metrics.begin(), metrics.end(), local_results.begin() + set*num_metrics);
+        }
+    }
+    catch (Exception& e)
+    {
+        // Don't leave the other processes waiting in the gather below
+        PetscTools::ReplicateException(true);
+        throw e;
+    }
+    PetscTools::ReplicateException(false);
+
+    std::vector<double> all_results(num_sets*num_metrics);
+    MPI_Allreduce(&local_results[0], &all_results[0], num_sets*num_metrics, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+
+    mResults.resize(num_sets);
+    for (unsigned set=0; set<num_sets; set++)
+    {
+        mResults[set].assign(all_results.begin() + set*num_metrics, all_results.begin() + (set+1u)*num_metrics);
+    }
+}
+
+const std::vector<std::vector<double> >& SingleCellParameterSweep::rGetResults() const
+{
+    return mResults;
+}
+
+void SingleCellParameterSweep::WriteResults(const std::string& rDirectory, const std::string& rFileName, bool cleanOutputDirectory) const
+{
+    if (mResults.size() != mParameterSets.size())
+    {
+        EXCEPTION("Run() must be called before the results can be written.");
+    }
+
+    OutputFileHandler handler(rDirectory, cleanOutputDirectory);
+    if (PetscTools::AmMaster())
+    {
+        out_stream p_file = handler.OpenOutputFile(rFileName);
+        p_file->precision(8);
+        for (unsigned i=0; i<mParameterNames.size(); i++)
+        {
+            (*p_file) << mParameterNames[i] << "\t";
+        }
+        for (unsigned i=0; i<mMetricNames.size(); i++)
+        {
+            (*p_file) << mMetricNames[i] << (i+1u < mMetricNames.size() ? "\t" : "\n");
+        }
+        for (unsigned set=0; set<mParameterSets.size(); set++)
+        {
+            for (unsigned i=0; i<mParameterSets[set].size(); i++)
+            {
+                (*p_file) << mParameterSets[set][i] << "\t";
+            }
+            for (unsigned i=0; i<mResults[set].size(); i++)
+            {
+                (*p_file) << mResults[set][i] << (i+1u < mResults[set].size() ? "\t" : "\n");
+            }
+        }
+        p_file->close();
+    }
+}
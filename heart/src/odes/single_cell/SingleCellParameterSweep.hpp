@@ -0,0 +1,230 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef SINGLECELLPARAMETERSWEEP_HPP_
+#define SINGLECELLPARAMETERSWEEP_HPP_
+
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+
+#include "AbstractSingleCellFactory.hpp"
+#include "RegularStimulus.hpp"
+
+/**
+ * Run a population of single cell simulations, one per parameter set, and
+ * collect summary metrics from each.
+ *
+ * Each parameter set is a list of scaling factors, one per parameter name,
+ * applied to the default parameter values of the cell model. Every cell is
+ * paced with the same RegularStimulus from its default initial conditions,
+ * for at most #mMaxNumPaces paces. If a steady state tolerance is set, pacing
+ * stops early once the summed absolute change in the state variables over a
+ * pace drops below it. The final pace is recorded and analysed with
+ * CellProperties (action potential metrics) and, where the model annotates
+ * cytosolic_calcium_concentration, for the calcium transient.
+ *
+ * Parameter sets are distributed in contiguous blocks across processes, and
+ * the metrics are gathered so that every process holds the full results
+ * after Run(). A single cell object is created per process and reset between
+ * parameter sets, unless SetReuseCells(false) is called.
+ *
+ * If the simulation of a parameter set fails (e.g. the cell model is unstable
+ * for those parameters), all its metrics are NaN and the sweep carries on.
+ */
+class SingleCellParameterSweep
+{
+public:
+    /** The metrics computed for each parameter set, in the order they appear in rGetResults(). */
+    typedef enum
+    {
+        APD90=0,
+        APD50,
+        PEAK_VOLTAGE,
+        RESTING_VOLTAGE,
+        MAX_UPSTROKE_VELOCITY,
+        PEAK_CALCIUM,
+        DIASTOLIC_CALCIUM,
+        CALCIUM_TRANSIENT_AMPLITUDE,
+        NUM_PACES,
+        FINAL_PACE_STATE_CHANGE,
+        NUM_METRICS
+    } Metric;
+
+private:
+    /** Creates the cells to simulate. */
+    boost::shared_ptr<AbstractSingleCellFactory> mpFactory;
+
+    /** The pacing protocol. */
+    boost::shared_ptr<RegularStimulus> mpStimulus;
+
+    /** The names of the parameters being scaled. */
+    std::vector<std::string> mParameterNames;
+
+    /** The scaling factors for each parameter set, indexed by [set][parameter]. */
+    std::vector<std::vector<double> > mParameterSets;
+
+    /** The metrics for each parameter set, indexed by [set][#Metric]; filled in by Run(). */
+    std::vector<std::vector<double> > mResults;
+
+    /** The names of the metrics, in the order they appear in #mResults. */
+    std::vector<std::string> mMetricNames;
+
+    /** The maximum number of paces to simulate for each parameter set. */
+    unsigned mMaxNumPaces;
+
+    /** Stop pacing once the change in the state over a pace is below this; 0 means always run #mMaxNumPaces. */
+    double mSteadyStateTolerance;
+
+    /** The sampling interval used when recording the final pace (ms). */
+    double mSamplingInterval;
+
+    /** The voltage threshold passed to CellProperties (mV). */
+    double mThreshold;
+
+    /** Whether to simulate every parameter set on this process with the same cell object. */
+    bool mReuseCells;
+
+    /**
+     * Simulate a single parameter set.
+     *
+     * @param pCell  the cell to simulate, already reset to its default state and parameters
+     * @param rMetrics  filled in with the metrics, indexed by #Metric
+     */
+    void SimulateCell(boost::shared_ptr<AbstractCardiacCellInterface> pCell, std::vector<double>& rMetrics);
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param pFactory  creates the cells to simulate
+     * @param pStimulus  the pacing protocol; its period is the length of each pace
+     * @param rParameterNames  the names of the parameters to scale
+     */
+    SingleCellParameterSweep(boost::shared_ptr<AbstractSingleCellFactory> pFactory,
+                             boost::shared_ptr<RegularStimulus> pStimulus,
+                             const std::vector<std::string>& rParameterNames);
+
+    /**
+     * Add a single parameter set to the sweep.
+     *
+     * @param rScalings  scaling factors, one per parameter name
+     */
+    void AddParameterSet(const std::vector<double>& rScalings);
+
+    /**
+     * Add every combination of the given scaling factors to the sweep.
+     * The last parameter varies fastest.
+     *
+     * @param rScalingsPerParameter  for each parameter name, the scaling factors to try
+     */
+    void AddParameterGrid(const std::vector<std::vector<double> >& rScalingsPerParameter);
+
+    /**
+     * @return the scaling factors for each parameter set, indexed by [set][parameter]
+     */
+    const std::vector<std::vector<double> >& rGetParameterSets() const;
+
+    /**
+     * @return the names of the metrics computed for each parameter set
+     */
+    const std::vector<std::string>& rGetMetricNames() const;
+
+    /**
+     * Set the maximum number of paces to simulate for each parameter set (defaults to 100).
+     *
+     * @param maxNumPaces  the number of paces
+     */
+    void SetMaxNumPaces(unsigned maxNumPaces);
+
+    /**
+     * Stop pacing once the summed absolute change in the state variables
+     * over a pace is below the given tolerance (defaults to 0, i.e. never).
+     *
+     * @param tolerance  the tolerance
+     */
+    void SetSteadyStateTolerance(double tolerance);
+
+    /**
+     * Set the sampling interval used when recording the final pace (defaults to 0.1ms).
+     *
+     * @param samplingInterval  the sampling interval (ms)
+     */
+    void SetSamplingInterval(double samplingInterval);
+
+    /**
+     * Set the voltage threshold used to detect action potentials (defaults to -30mV).
+     *
+     * @param threshold  the threshold (mV)
+     */
+    void SetThreshold(double threshold);
+
+    /**
+     * Set whether every parameter set on a process is simulated with the same
+     * cell object, reset in between (the default), or with a new cell each time.
+     *
+     * @param reuseCells  whether to reuse cells
+     */
+    void SetReuseCells(bool reuseCells);
+
+    /**
+     * Simulate the parameter sets owned by this process, then share the results.
+     * Must be called collectively.
+     *
+     * Metrics which cannot be computed for a parameter set (e.g. no action
+     * potential occurred, or the model has no annotated calcium) are NaN, as
+     * are all the metrics of a parameter set whose simulation threw.  Errors
+     * in setting up a cell (e.g. an unknown parameter name) are thrown on
+     * every process.
+     */
+    void Run();
+
+    /**
+     * @return the metrics for each parameter set, indexed by [set][#Metric]
+     */
+    const std::vector<std::vector<double> >& rGetResults() const;
+
+    /**
+     * Write the parameter scalings and metrics to a tab-separated file, one
+     * row per parameter set. Only the master process writes.
+     *
+     * @param rDirectory  the output directory, relative to CHASTE_TEST_OUTPUT
+     * @param rFileName  the file name
+     * @param cleanOutputDirectory  whether to clean the directory first
+     */
+    void WriteResults(const std::string& rDirectory, const std::string& rFileName, bool cleanOutputDirectory=true) const;
+};
+
+#endif // SINGLECELLPARAMETERSWEEP_HPP_
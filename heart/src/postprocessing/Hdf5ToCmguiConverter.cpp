@@ -39,7 +39,6 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "HeartConfig.hpp"
 #include "PetscTools.hpp"
 #include "Exception.hpp"
-#include "ReplicatableVector.hpp"
 #include "DistributedVector.hpp"
 #include "DistributedVectorFactory.hpp"
 #include "Version.hpp"
@@ -55,9 +54,15 @@ void Hdf5ToCmguiConverter<ELEMENT_DIM,SPACE_DIM>::Write(std::string type)
 
     DistributedVectorFactory factory(num_nodes);
 
-    Vec data = factory.CreateVec();//for V
-    Vec data_phie = factory.CreateVec();//for phi_e
-    Vec data_second_cell = factory.CreateVec();//for the V of the second cell, used in extended bidomain problems.
+    // One vector per variable. Each process reads its own part of the data, which is
+    // streamed to the master one process at a time.
+    unsigned num_vars = this->mpReader->GetVariableNames().size();
+    std::vector<Vec> data(num_vars);
+    for (unsigned var=0; var<num_vars; var++)
+    {
+        data[var] = factory.CreateVec();
+    }
+    std::vector<std::vector<double> > blocks;
 
     for (unsigned time_step=0; time_step<num_timesteps; time_step++)
     {
@@ -77,15 +82,10 @@ void Hdf5ToCmguiConverter<ELEMENT_DIM,SPACE_DIM>::Write(std::string type)
             }
         }
 
-        std::vector<ReplicatableVector*> all_data;
-        unsigned num_vars = this->mpReader->GetVariableNames().size();
         for (unsigned var=0; var<num_vars; var++)
         {
             // Read the data for this time step
-            this->mpReader->GetVariableOverNodes(data, this->mpReader->GetVariableNames()[var], time_step);
-            ReplicatableVector* p_repl_data = new ReplicatableVector(data);
-            assert(p_repl_data->GetSize()==num_nodes);
-            all_data.push_back(p_repl_data);
+            this->mpReader->GetVariableOverNodes(data[var], this->mpReader->GetVariableNames()[var], time_step);
         }
 
         if (PetscTools::AmMaster())
@@ -104,27 +104,30 @@ void Hdf5ToCmguiConverter<ELEMENT_DIM,SPACE_DIM>::Write(std::string type)
                     *p_file << "\n";
                 }
             }
+        }
 
-            // Write the data
-            for (unsigned i=0; i<num_nodes; i++)
+        // Write the data
+        for (unsigned process=0; process<PetscTools::GetNumProcs(); process++)
+        {
+            unsigned offset = this->GetBlockOnMaster(data, process, blocks);
+            if (PetscTools::AmMaster())
             {
-                // cmgui counts nodes from 1
-                *p_file << "Node: "<< i+1 << "\n";
-                for (unsigned var=0; var<num_vars; var++)
+                for (unsigned i=0; i<blocks[0].size(); i++)
                 {
-                    *p_file  << (*(all_data[var]))[i] << "\n";
+                    // cmgui counts nodes from 1
+                    *p_file << "Node: "<< offset+i+1 << "\n";
+                    for (unsigned var=0; var<num_vars; var++)
+                    {
+                        *p_file  << blocks[var][i] << "\n";
+                    }
                 }
             }
         }
-
-        for (unsigned var=0; var<num_vars; var++)
-        {
-           delete all_data[var];
-        }
     }
-    PetscTools::Destroy(data);
-    PetscTools::Destroy(data_phie);
-    PetscTools::Destroy(data_second_cell);
+    for (unsigned var=0; var<num_vars; var++)
+    {
+        PetscTools::Destroy(data[var]);
+    }
 
     if (PetscTools::AmMaster())
     {
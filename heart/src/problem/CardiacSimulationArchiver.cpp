@@ -33,7 +33,11 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
+#include <utility>
 
 // Must be included before any other serialization headers
 #include "CheckpointArchiveTypes.hpp"
@@ -51,26 +55,77 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "BidomainProblem.hpp"
 #include "BidomainWithBathProblem.hpp"
 
+template<class PROBLEM_CLASS>
+template<class Archive>
+void CardiacSimulationArchiver<PROBLEM_CLASS>::SaveArchives(PROBLEM_CLASS& rSimulationToArchive,
+                                                            const FileFinder& rDirectory)
+{
+    // Open the archive files
+    ArchiveOpener<Archive, std::ofstream> archive_opener(rDirectory, "archive.arch");
+    Archive* p_main_archive = archive_opener.GetCommonArchive();
+
+    // And save
+    PROBLEM_CLASS* const p_simulation_to_archive = &rSimulationToArchive;
+    (*p_main_archive) & p_simulation_to_archive;
+}
+
 template<class PROBLEM_CLASS>
 void CardiacSimulationArchiver<PROBLEM_CLASS>::Save(PROBLEM_CLASS& rSimulationToArchive,
                                                     const std::string& rDirectory,
-                                                    bool clearDirectory)
+                                                    bool clearDirectory,
+                                                    bool useBinaryArchive)
+{
+    SaveCheckpoint(rSimulationToArchive, rDirectory, clearDirectory, useBinaryArchive, "");
+}
+
+template<class PROBLEM_CLASS>
+void CardiacSimulationArchiver<PROBLEM_CLASS>::SaveCheckpoint(PROBLEM_CLASS& rSimulationToArchive,
+                                                              const std::string& rDirectory,
+                                                              bool clearDirectory,
+                                                              bool useBinaryArchive,
+                                                              const std::string& rSeriesDirectory)
 {
     // Clear directory if requested (and make sure it exists)
     OutputFileHandler handler(rDirectory, clearDirectory);
 
-    // Nest the archive writing, so the ArchiveOpener goes out of scope before
-    // the method ends.
+    const bool share_mesh = !rSeriesDirectory.empty();
+    FileFinder dir(rDirectory, RelativeTo::ChasteTestOutput);
+
+    // The ArchiveOpener goes out of scope (and so flushes the files) before SaveArchives returns
+    try
     {
-        // Open the archive files
-        FileFinder dir(rDirectory, RelativeTo::ChasteTestOutput);
-        ArchiveOpener<boost::archive::text_oarchive, std::ofstream> archive_opener(dir, "archive.arch");
-        boost::archive::text_oarchive* p_main_archive = archive_opener.GetCommonArchive();
+        if (share_mesh)
+        {
+            // The static mesh and fibre files are only written by the first checkpoint in the series.  Writing
+            // them is collective, so the master process decides whether they are there and tells the others.
+            FileFinder mesh_dir(rSeriesDirectory + "/mesh", RelativeTo::ChasteTestOutput);
+            bool mesh_is_written = false;
+            if (PetscTools::AmMaster())
+            {
+                FileFinder node_file(rSeriesDirectory + "/mesh/" + ArchiveLocationInfo::GetMeshFilename() + ".node",
+                                     RelativeTo::ChasteTestOutput);
+                mesh_is_written = node_file.Exists();
+            }
+            mesh_is_written = PetscTools::ReplicateBool(mesh_is_written);
+            ArchiveLocationInfo::SetSharedMeshDirectory(mesh_dir, mesh_is_written);
+        }
 
-        // And save
-        PROBLEM_CLASS* const p_simulation_to_archive = &rSimulationToArchive;
-        (*p_main_archive) & p_simulation_to_archive;
+        if (useBinaryArchive)
+        {
+            SaveArchives<boost::archive::binary_oarchive>(rSimulationToArchive, dir);
+        }
+        else
+        {
+            SaveArchives<boost::archive::text_oarchive>(rSimulationToArchive, dir);
+        }
+    }
+    catch (...)
+    {
+        // Don't leave later (non-incremental) archives pointing at the shared mesh
+        ArchiveLocationInfo::ClearSharedMeshDirectory();
+        throw;
     }
+    ArchiveLocationInfo::ClearSharedMeshDirectory();
 
     // Write the info file
     if (PetscTools::AmMaster())
@@ -85,7 +140,12 @@ void CardiacSimulationArchiver<PROBLEM_CLASS>::Save(PROBLEM_CLASS& rSimulationTo
         }
         PetscTools::ReplicateBool(false);
         unsigned archive_version = 0; // Note that Boost version numbers are per-class; this only needs to change if we change the Load/Save methods here
-        info_file << PetscTools::GetNumProcs() << " " << archive_version;
+        info_file << PetscTools::GetNumProcs() << " " << archive_version << " " << (useBinaryArchive ? "binary" : "text");
+        if (share_mesh)
+        {
+            // Where the mesh files are, relative to the archive directory
+            info_file << " ../mesh/";
+        }
     }
     else
     {
@@ -134,11 +194,197 @@ PROBLEM_CLASS* CardiacSimulationArchiver<PROBLEM_CLASS>::Migrate(const FileFinde
     unsigned num_procs, archive_version;
     info_file >> num_procs >> archive_version;
 
+    // Checkpoints written before binary archives were supported have no format entry
+    std::string archive_format;
+    if (!(info_file >> archive_format))
+    {
+        archive_format = "text";
+    }
+
+    if (archive_format != "binary" && archive_format != "text")
+    {
+        EXCEPTION("Unknown archive format '" + archive_format + "' in archive information file: " + info_path);
+    }
+
+    // Incremental checkpoints keep their mesh in a directory shared with other checkpoints
+    std::string shared_mesh_path;
+    const bool share_mesh = static_cast<bool>(info_file >> shared_mesh_path);
+
+    PROBLEM_CLASS* p_unarchived_simulation = NULL;
+    try
+    {
+        if (share_mesh)
+        {
+            ArchiveLocationInfo::SetSharedMeshDirectory(FileFinder(dir_path + shared_mesh_path, RelativeTo::Absolute));
+        }
+
+        if (archive_format == "binary")
+        {
+            p_unarchived_simulation = LoadArchives<boost::archive::binary_iarchive>(rDirectory, num_procs, archive_version);
+        }
+        else
+        {
+            p_unarchived_simulation = LoadArchives<boost::archive::text_iarchive>(rDirectory, num_procs, archive_version);
+        }
+    }
+    catch (...)
+    {
+        ArchiveLocationInfo::ClearSharedMeshDirectory();
+        throw;
+    }
+    ArchiveLocationInfo::ClearSharedMeshDirectory();
+    return p_unarchived_simulation;
+}
+
+/**
+ * @return the name of the folder holding an incremental checkpoint
+ * @param time  the simulation time of the checkpoint
+ */
+static std::string GetIncrementalCheckpointName(double time)
+{
+    // Write out without scientific notation in time, as for CardiacSimulation checkpoints
+    char time_stamp[60];
+    std::sprintf(time_stamp, "%0.16g", time);
+    return std::string("checkpoint_") + time_stamp + "ms";
+}
+
+/**
+ * @return the checkpoints in a series written by SaveIncremental(), as (time, folder name) pairs in
+ *     increasing order of time.  The folder name identifies a checkpoint exactly; the time is only
+ *     as precise as the name, so is used for ordering and not for identification.
+ * @param rSeriesDirectory  directory holding the series of checkpoints (relative to CHASTE_TEST_OUTPUT)
+ */
+static std::vector<std::pair<double, std::string> > GetIncrementalCheckpoints(const std::string& rSeriesDirectory)
+{
+    std::vector<std::pair<double, std::string> > checkpoints;
+    FileFinder series_dir(rSeriesDirectory, RelativeTo::ChasteTestOutput);
+    if (series_dir.IsDir())
+    {
+        std::vector<FileFinder> matches = series_dir.FindMatches("checkpoint_*");
+        const std::string prefix("checkpoint_");
+        const std::string suffix("ms");
+        for (unsigned i=0; i<matches.size(); i++)
+        {
+            std::string name = matches[i].GetLeafName();
+            if (matches[i].IsDir() && name.size() > prefix.size() + suffix.size()
+                && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+            {
+                double time = std::atof(name.substr(prefix.size(), name.size() - prefix.size() - suffix.size()).c_str());
+                checkpoints.push_back(std::make_pair(time, name));
+            }
+        }
+    }
+    std::sort(checkpoints.begin(), checkpoints.end());
+    return checkpoints;
+}
+
+template<class PROBLEM_CLASS>
+std::string CardiacSimulationArchiver<PROBLEM_CLASS>::SaveIncremental(PROBLEM_CLASS& rSimulationToArchive,
+                                                                      const std::string& rSeriesDirectory,
+                                                                      unsigned maxCheckpointsOnDisk,
+                                                                      bool useBinaryArchive)
+{
+    if (maxCheckpointsOnDisk == 0)
+    {
+        EXCEPTION("At least one incremental checkpoint must be kept on disk");
+    }
+    const double time = rSimulationToArchive.GetCurrentTime();
+    const std::string checkpoint_name = GetIncrementalCheckpointName(time);
+
+    // Only the master process looks at (and removes) existing checkpoints, so that every process takes
+    // the same collective path below
+    std::vector<std::pair<double, std::string> > checkpoints;
+    if (PetscTools::AmMaster())
+    {
+        checkpoints = GetIncrementalCheckpoints(rSeriesDirectory);
+    }
+    bool series_exists = PetscTools::ReplicateBool(!checkpoints.empty());
+
+    // Start a new series afresh, so that a stale mesh is never referenced
+    OutputFileHandler series_handler(rSeriesDirectory, !series_exists);
+
+    if (PetscTools::AmMaster())
+    {
+        // Checkpoints later than this one belong to an abandoned run
+        while (!checkpoints.empty() && checkpoints.back().second != checkpoint_name && checkpoints.back().first > time)
+        {
+            FileFinder stale_dir(checkpoints.back().second, series_handler.FindFile(""));
+            ABORT_IF_THROWS(stale_dir.Remove());
+            checkpoints.pop_back();
+        }
+    }
+    PetscTools::Barrier("CardiacSimulationArchiver::SaveIncremental-1");
+
+    std::string checkpoint_dir = rSeriesDirectory + "/" + checkpoint_name;
+    SaveCheckpoint(rSimulationToArchive, checkpoint_dir, true, useBinaryArchive, rSeriesDirectory);
+
+    // Rolling retention of the most recent checkpoints; the shared mesh is always kept
+    if (PetscTools::AmMaster())
+    {
+        if (checkpoints.empty() || checkpoints.back().second != checkpoint_name)
+        {
+            checkpoints.push_back(std::make_pair(time, checkpoint_name));
+        }
+        for (unsigned i=0; i+maxCheckpointsOnDisk<checkpoints.size(); i++)
+        {
+            FileFinder old_dir(checkpoints[i].second, series_handler.FindFile(""));
+            ABORT_IF_THROWS(old_dir.Remove());
+        }
+    }
+    PetscTools::Barrier("CardiacSimulationArchiver::SaveIncremental-2");
+
+    return checkpoint_dir;
+}
+
+template<class PROBLEM_CLASS>
+std::vector<double> CardiacSimulationArchiver<PROBLEM_CLASS>::GetIncrementalCheckpointTimes(const std::string& rSeriesDirectory)
+{
+    std::vector<std::pair<double, std::string> > checkpoints = GetIncrementalCheckpoints(rSeriesDirectory);
+    std::vector<double> times;
+    for (unsigned i=0; i<checkpoints.size(); i++)
+    {
+        times.push_back(checkpoints[i].first);
+    }
+    return times;
+}
+
+template<class PROBLEM_CLASS>
+PROBLEM_CLASS* CardiacSimulationArchiver<PROBLEM_CLASS>::LoadIncremental(const std::string& rSeriesDirectory, double time)
+{
+    std::string checkpoint_name;
+    if (time == DOUBLE_UNSET)
+    {
+        std::vector<std::pair<double, std::string> > checkpoints = GetIncrementalCheckpoints(rSeriesDirectory);
+        if (checkpoints.empty())
+        {
+            EXCEPTION("No incremental checkpoints found in " + rSeriesDirectory);
+        }
+        checkpoint_name = checkpoints.back().second;
+    }
+    else
+    {
+        checkpoint_name = GetIncrementalCheckpointName(time);
+    }
+
+    FileFinder checkpoint_dir(rSeriesDirectory + "/" + checkpoint_name, RelativeTo::ChasteTestOutput);
+    if (!checkpoint_dir.IsDir())
+    {
+        EXCEPTION("No incremental checkpoint " + checkpoint_name + " in " + rSeriesDirectory);
+    }
+    return Migrate(checkpoint_dir);
+}
+
+template<class PROBLEM_CLASS>
+template<class Archive>
+PROBLEM_CLASS* CardiacSimulationArchiver<PROBLEM_CLASS>::LoadArchives(const FileFinder& rDirectory,
+                                                                      unsigned numProcs,
+                                                                      unsigned archiveVersion)
+{
     PROBLEM_CLASS *p_unarchived_simulation = NULL; // Shouldn't be necessary but is on some setups!
 
     // Avoid the DistributedVectorFactory throwing a 'wrong number of processes' exception when loading,
     // and make it get the original DistributedVectorFactory from the archive so we can compare against
-    // num_procs.
+    // numProcs.
     DistributedVectorFactory::SetCheckNumberOfProcessesOnLoad(false);
     // Put what follows in a try-catch to make sure we reset this
     try
@@ -146,19 +392,19 @@ PROBLEM_CLASS* CardiacSimulationArchiver<PROBLEM_CLASS>::Migrate(const FileFinde
         // Figure out which process-specific archive to load first.  If we're loading on the same number of
         // processes, we must load our own one, or the mesh gets confused.  Otherwise, start with 0 to make
         // sure it exists.
-        unsigned initial_archive = num_procs == PetscTools::GetNumProcs() ? PetscTools::GetMyRank() : 0u;
+        unsigned initial_archive = numProcs == PetscTools::GetNumProcs() ? PetscTools::GetMyRank() : 0u;
 
         // Load the master and initial process-specific archive files.
         // This will also set up ArchiveLocationInfo for us.
-        ArchiveOpener<boost::archive::text_iarchive, std::ifstream> archive_opener(rDirectory, "archive.arch", initial_archive);
-        boost::archive::text_iarchive* p_main_archive = archive_opener.GetCommonArchive();
+        ArchiveOpener<Archive, std::ifstream> archive_opener(rDirectory, "archive.arch", initial_archive);
+        Archive* p_main_archive = archive_opener.GetCommonArchive();
         (*p_main_archive) >> p_unarchived_simulation;
 
         // Work out how many more process-specific files to load
         DistributedVectorFactory* p_factory = p_unarchived_simulation->rGetMesh().GetDistributedVectorFactory();
         assert(p_factory != NULL);
         unsigned original_num_procs = p_factory->GetOriginalFactory()->GetNumProcs();
-        assert(original_num_procs == num_procs); // Paranoia
+        assert(original_num_procs == numProcs); // Paranoia
 
         // Merge in the extra data
         for (unsigned archive_num=0; archive_num<original_num_procs; archive_num++)
@@ -166,9 +412,9 @@ PROBLEM_CLASS* CardiacSimulationArchiver<PROBLEM_CLASS>::Migrate(const FileFinde
             if (archive_num != initial_archive)
             {
                 std::string archive_path = ArchiveLocationInfo::GetProcessUniqueFilePath("archive.arch", archive_num);
-                std::ifstream ifs(archive_path.c_str());
-                boost::archive::text_iarchive archive(ifs);
-                p_unarchived_simulation->LoadExtraArchive(archive, archive_version);
+                std::ifstream ifs(archive_path.c_str(), std::ios::binary);
+                Archive archive(ifs);
+                p_unarchived_simulation->LoadExtraArchive(archive, archiveVersion);
             }
         }
     }
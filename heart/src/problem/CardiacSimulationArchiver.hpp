@@ -36,8 +36,11 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef CARDIACSIMULATIONARCHIVER_HPP_
 #define CARDIACSIMULATIONARCHIVER_HPP_
 
+#include <climits>
 #include <string>
+#include <vector>
 
+#include "Exception.hpp"
 #include "FileFinder.hpp"
 
 
@@ -51,6 +54,40 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 template<class PROBLEM_CLASS>
 class CardiacSimulationArchiver
 {
+private:
+    /**
+     * Archive a simulation, optionally keeping the mesh files in a directory shared with other checkpoints.
+     *
+     * @param rSimulationToArchive object defining the simulation to archive
+     * @param rDirectory directory where the checkpoint will be stored (relative to CHASTE_TEST_OUTPUT)
+     * @param clearDirectory whether the directory needs to be cleared or not
+     * @param useBinaryArchive whether to write Boost binary archives rather than text archives
+     * @param rSeriesDirectory if not empty, the parent of rDirectory; the mesh files then go in its
+     *     "mesh" subfolder, and are written only if they are not already there
+     */
+    static void SaveCheckpoint(PROBLEM_CLASS& rSimulationToArchive, const std::string& rDirectory,
+                               bool clearDirectory, bool useBinaryArchive, const std::string& rSeriesDirectory);
+
+    /**
+     * Write the main and process-specific archive files using the given archive type.
+     *
+     * @param rSimulationToArchive object defining the simulation to archive
+     * @param rDirectory directory where the checkpoint will be stored
+     */
+    template<class Archive>
+    static void SaveArchives(PROBLEM_CLASS& rSimulationToArchive, const FileFinder& rDirectory);
+
+    /**
+     * Read the main and all relevant process-specific archive files using the given archive type.
+     *
+     * @param rDirectory directory where the checkpoint is located
+     * @param numProcs the number of processes the checkpoint was written by
+     * @param archiveVersion the version number read from the archive.info file
+     * @return a pointer to the unarchived cardiac problem class
+     */
+    template<class Archive>
+    static PROBLEM_CLASS* LoadArchives(const FileFinder& rDirectory, unsigned numProcs, unsigned archiveVersion);
+
 public:
     /**
      * Archives a simulation in the directory specified.
@@ -61,8 +98,13 @@ public:
      * @param rDirectory directory where the multiple files defining the checkpoint will be stored
      *     (relative to CHASTE_TEST_OUTPUT)
      * @param clearDirectory whether the directory needs to be cleared or not.
+     * @param useBinaryArchive whether to write Boost binary archives rather than text archives.
+     *     Binary checkpoints are considerably faster to write and read, and smaller, but can only
+     *     be loaded on a machine with the same architecture and Boost version.  The format is
+     *     recorded in archive.info, so Load() picks the right reader automatically.
      */
-    static void Save(PROBLEM_CLASS& rSimulationToArchive, const std::string& rDirectory, bool clearDirectory=true);
+    static void Save(PROBLEM_CLASS& rSimulationToArchive, const std::string& rDirectory, bool clearDirectory=true,
+                     bool useBinaryArchive=false);
 
 
     /**
@@ -110,6 +152,50 @@ public:
      * @return a pointer to the migrated cardiac problem class
      */
     static PROBLEM_CLASS* Migrate(const FileFinder& rDirectory);
+
+    /**
+     * Add a checkpoint to a series of incremental checkpoints of one simulation.
+     *
+     * Each checkpoint in the series is stored in a subfolder "checkpoint_<time>ms" of rSeriesDirectory.
+     * Static data that does not change between checkpoints (the mesh and any fibre file) is written
+     * once, to the subfolder "mesh", and referenced by every checkpoint, so that only the time-varying
+     * state (cell models, solution and configuration) is written each time.
+     *
+     * If the series contains no checkpoints yet, the series directory is cleared first.  Any checkpoints
+     * later than the current simulation time (e.g. left behind by a run that was resumed from an earlier
+     * checkpoint) are removed, and then the oldest checkpoints are removed until at most
+     * maxCheckpointsOnDisk remain.
+     *
+     * Any checkpoint in the series can be resumed with Load() (given its folder) or LoadIncremental().
+     *
+     * @note Must be called collectively, i.e. by all processes.
+     *
+     * @param rSimulationToArchive object defining the simulation to archive
+     * @param rSeriesDirectory directory holding the series of checkpoints (relative to CHASTE_TEST_OUTPUT)
+     * @param maxCheckpointsOnDisk the number of most recent checkpoints to keep (defaults to all)
+     * @param useBinaryArchive whether to write Boost binary archives rather than text archives
+     * @return the folder of the new checkpoint, relative to CHASTE_TEST_OUTPUT
+     */
+    static std::string SaveIncremental(PROBLEM_CLASS& rSimulationToArchive, const std::string& rSeriesDirectory,
+                                       unsigned maxCheckpointsOnDisk=UINT_MAX, bool useBinaryArchive=false);
+
+    /**
+     * @return the times of the checkpoints in a series written by SaveIncremental(), in increasing order
+     *
+     * @param rSeriesDirectory directory holding the series of checkpoints (relative to CHASTE_TEST_OUTPUT)
+     */
+    static std::vector<double> GetIncrementalCheckpointTimes(const std::string& rSeriesDirectory);
+
+    /**
+     * Unarchive a simulation from a series of checkpoints written by SaveIncremental().
+     *
+     * @note Must be called collectively, i.e. by all processes.
+     *
+     * @param rSeriesDirectory directory holding the series of checkpoints (relative to CHASTE_TEST_OUTPUT)
+     * @param time the time of the checkpoint to load (defaults to the latest checkpoint)
+     * @return a pointer to the unarchived cardiac problem class
+     */
+    static PROBLEM_CLASS* LoadIncremental(const std::string& rSeriesDirectory, double time=DOUBLE_UNSET);
 };
 
 #endif /*CARDIACSIMULATIONARCHIVER_HPP_*/
@@ -0,0 +1,638 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "EikonalActivationSolver.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+#include "UblasCustomFunctions.hpp"
+#include "DistributedTetrahedralMesh.hpp"
+#include "HeartConfig.hpp"
+#include "HeartRegionCodes.hpp"
+#include "OutputFileHandler.hpp"
+#include "SimpleStimulus.hpp"
+#include "RegularStimulus.hpp"
+#include "PetscTools.hpp"
+#include "Exception.hpp"
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::EikonalActivationSolver(AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>& rMesh,
+                                                                         AbstractConductivityTensors<ELEMENT_DIM, SPACE_DIM>& rConductivityTensors,
+                                                                         double conductionVelocityScale)
+    : mrMesh(rMesh),
+      mpConductivityTensors(&rConductivityTensors),
+      mpTissue(NULL),
+      mConductionVelocityScale(conductionVelocityScale)
+{
+    CommonConstructor();
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::EikonalActivationSolver(AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>& rMesh,
+                                                                         AbstractCardiacTissue<ELEMENT_DIM, SPACE_DIM>& rTissue,
+                                                                         double conductionVelocityScale)
+    : mrMesh(rMesh),
+      mpConductivityTensors(NULL),
+      mpTissue(&rTissue),
+      mConductionVelocityScale(conductionVelocityScale)
+{
+    CommonConstructor();
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::CommonConstructor()
+{
+    if (mConductionVelocityScale <= 0.0)
+    {
+        EXCEPTION("The conduction velocity scale must be positive.");
+    }
+
+    mRoundCounter = 0u;
+    mWorkOnEntireMesh = true;
+    mLo = 0u;
+    mHi = mrMesh.GetNumNodes();
+
+    DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>* p_distributed_mesh = dynamic_cast<DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>*>(&mrMesh);
+    if (PetscTools::IsParallel() && p_distributed_mesh != NULL)
+    {
+        mWorkOnEntireMesh = false;
+        mLo = mrMesh.GetDistributedVectorFactory()->GetLow();
+        mHi = mrMesh.GetDistributedVectorFactory()->GetHigh();
+
+        // Ownership ranges are contiguous, so these tell us which process owns each halo node
+        mProcessLows = mrMesh.GetDistributedVectorFactory()->rGetGlobalLows();
+
+        p_distributed_mesh->GetHaloNodeIndices(mHaloNodeIndices);
+        std::sort(mHaloNodeIndices.begin(), mHaloNodeIndices.end());
+
+        // Tell the owners which of their nodes we hold as halo nodes
+        unsigned num_procs = PetscTools::GetNumProcs();
+        std::vector<int> send_counts(num_procs, 0);
+        unsigned owner = 0;
+        for (unsigned i=0; i<mHaloNodeIndices.size(); i++)
+        {
+            while (owner+1 < num_procs && mHaloNodeIndices[i] >= mProcessLows[owner+1])
+            {
+                owner++;
+            }
+            send_counts[owner]++;
+        }
+
+        std::vector<int> receive_counts(num_procs);
+        MPI_Alltoall(&send_counts[0], 1, MPI_INT, &receive_counts[0], 1, MPI_INT, PETSC_COMM_WORLD);
+
+        std::vector<int> send_displacements(num_procs, 0);
+        std::vector<int> receive_displacements(num_procs, 0);
+        for (unsigned process=1; process<num_procs; process++)
+        {
+            send_displacements[process] = send_displacements[process-1] + send_counts[process-1];
+            receive_displacements[process] = receive_displacements[process-1] + receive_counts[process-1];
+        }
+        std::vector<unsigned> shared_nodes(receive_displacements[num_procs-1] + receive_counts[num_procs-1]);
+
+        MPI_Alltoallv(mHaloNodeIndices.data(), &send_counts[0], &send_displacements[0], MPI_UNSIGNED,
+                      shared_nodes.data(), &receive_counts[0], &receive_displacements[0], MPI_UNSIGNED,
+                      PETSC_COMM_WORLD);
+
+        for (unsigned process=0; process<num_procs; process++)
+        {
+            for (int i=receive_displacements[process]; i<receive_displacements[process]+receive_counts[process]; i++)
+            {
+                mHaloSharers[shared_nodes[i]].push_back(process);
+            }
+        }
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+const c_matrix<double, SPACE_DIM, SPACE_DIM>& EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::rGetConductivityTensor(unsigned elementIndex)
+{
+    if (mpTissue)
+    {
+        return mpTissue->rGetIntracellularConductivityTensor(elementIndex);
+    }
+    return (*mpConductivityTensors)[elementIndex];
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::ComputeElementMetrics()
+{
+    mElementMetrics.assign(mrMesh.GetNumLocalElements(), zero_matrix<double>(SPACE_DIM, SPACE_DIM));
+    mLocalElementIndices.assign(mrMesh.GetNumAllElements(), UINT_MAX);
+    const double scale_squared = mConductionVelocityScale*mConductionVelocityScale;
+    unsigned local_index = 0;
+    for (typename AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ElementIterator it = mrMesh.GetElementIteratorBegin();
+         it != mrMesh.GetElementIteratorEnd();
+         ++it, ++local_index)
+    {
+        if (HeartRegionCode::IsRegionBath(it->GetUnsignedAttribute()))
+        {
+            continue;
+        }
+
+        const c_matrix<double, SPACE_DIM, SPACE_DIM>& r_sigma = rGetConductivityTensor(it->GetIndex());
+        if (Determinant(r_sigma) <= 0.0)
+        {
+            // Not conductive
+            continue;
+        }
+        mElementMetrics[local_index] = Inverse(r_sigma)/scale_squared;
+        mLocalElementIndices[it->GetIndex()] = local_index;
+    }
+    assert(local_index == mElementMetrics.size());
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::IsNodeKnownLocally(unsigned nodeIndex) const
+{
+    return (mLo<=nodeIndex && nodeIndex<mHi)
+           || std::binary_search(mHaloNodeIndices.begin(), mHaloNodeIndices.end(), nodeIndex);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::UpdateNode(unsigned nodeIndex, double time)
+{
+    mActivationTimes[nodeIndex] = time;
+
+    // Push a negative priority so that the earliest node is popped first
+    mActivePriorityNodeIndexQueue.push(std::pair<double, unsigned>(-time, nodeIndex));
+
+    if (!mWorkOnEntireMesh)
+    {
+        if (!(mLo<=nodeIndex && nodeIndex<mHi) || mHaloSharers.find(nodeIndex) != mHaloSharers.end())
+        {
+            mUpdatedSharedNodes.push_back(nodeIndex);
+        }
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::AddStimulusSite(unsigned nodeIndex, double time)
+{
+    if (nodeIndex >= mrMesh.GetNumNodes())
+    {
+        EXCEPTION("Stimulus site " << nodeIndex << " is not a node of the mesh.");
+    }
+    mStimulusSites.push_back(std::make_pair(nodeIndex, time));
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::AddStimulusSitesFromHeartConfig()
+{
+    std::vector<boost::shared_ptr<AbstractStimulusFunction> > stimuli;
+    std::vector<boost::shared_ptr<AbstractChasteRegion<SPACE_DIM> > > stimulated_areas;
+    HeartConfig::Instance()->GetStimuli(stimuli, stimulated_areas);
+
+    std::vector<double> start_times;
+    for (unsigned i=0; i<stimuli.size(); i++)
+    {
+        boost::shared_ptr<SimpleStimulus> p_simple = boost::dynamic_pointer_cast<SimpleStimulus>(stimuli[i]);
+        boost::shared_ptr<RegularStimulus> p_regular = boost::dynamic_pointer_cast<RegularStimulus>(stimuli[i]);
+        if (p_simple)
+        {
+            start_times.push_back(p_simple->GetStartTime());
+        }
+        else if (p_regular)
+        {
+            start_times.push_back(p_regular->GetStartTime());
+        }
+        else
+        {
+            NEVER_REACHED; // HeartConfig only creates the above
+        }
+    }
+
+    // Each process looks at the nodes it owns
+    for (typename AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::NodeIterator it = mrMesh.GetNodeIteratorBegin();
+         it != mrMesh.GetNodeIteratorEnd();
+         ++it)
+    {
+        double earliest = DBL_MAX;
+        for (unsigned i=0; i<stimulated_areas.size(); i++)
+        {
+            if (stimulated_areas[i]->DoesContain(it->GetPoint()))
+            {
+                earliest = std::min(earliest, start_times[i]);
+            }
+        }
+        if (earliest < DBL_MAX)
+        {
+            AddStimulusSite(it->GetIndex(), earliest);
+        }
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::Solve()
+{
+    unsigned num_nodes = mrMesh.GetNumNodes();
+    mActivationTimes.assign(num_nodes, DBL_MAX);
+    mUpdatedSharedNodes.clear();
+    assert(mActivePriorityNodeIndexQueue.empty());
+    ComputeElementMetrics();
+
+    for (unsigned i=0; i<mStimulusSites.size(); i++)
+    {
+        unsigned node_index = mStimulusSites[i].first;
+        double time = mStimulusSites[i].second;
+        if (time < mActivationTimes[node_index])
+        {
+            if (IsNodeKnownLocally(node_index))
+            {
+                UpdateNode(node_index, time);
+            }
+            else
+            {
+                // The owner deals with it; just make sure the final reduction keeps it
+                mActivationTimes[node_index] = time;
+            }
+        }
+    }
+
+    mRoundCounter = 0u;
+    bool work_left = true;
+    while (work_left)
+    {
+        WorkOnLocalQueue();
+        mRoundCounter++;
+        work_left = ExchangeSharedNodes();
+    }
+
+    if (!mWorkOnEntireMesh)
+    {
+        // Share the best values from everywhere with everyone
+        std::vector<double> local_times = mActivationTimes;
+        MPI_Allreduce(&local_times[0], &mActivationTimes[0], num_nodes, MPI_DOUBLE, MPI_MIN, PETSC_COMM_WORLD);
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::WorkOnLocalQueue()
+{
+    while (!mActivePriorityNodeIndexQueue.empty())
+    {
+        unsigned current_node_index = mActivePriorityNodeIndexQueue.top().second;
+        double time_when_queued = -mActivePriorityNodeIndexQueue.top().first;
+        mActivePriorityNodeIndexQueue.pop();
+
+        // Skip nodes that have been improved since they were queued
+        if (time_when_queued != mActivationTimes[current_node_index])
+        {
+            continue;
+        }
+
+        Node<SPACE_DIM>* p_current_node = mrMesh.GetNodeOrHaloNode(current_node_index);
+        for (typename Node<SPACE_DIM>::ContainingElementIterator element_iterator = p_current_node->ContainingElementsBegin();
+             element_iterator != p_current_node->ContainingElementsEnd();
+             ++element_iterator)
+        {
+            const unsigned local_element_index = mLocalElementIndices[*element_iterator];
+            if (local_element_index == UINT_MAX)
+            {
+                // Bath, or not conductive
+                continue;
+            }
+            const c_matrix<double, SPACE_DIM, SPACE_DIM>& r_metric = mElementMetrics[local_element_index];
+            Element<ELEMENT_DIM, SPACE_DIM>* p_element = mrMesh.GetElement(*element_iterator);
+
+            for (unsigned local_index=0; local_index<p_element->GetNumNodes(); local_index++)
+            {
+                unsigned neighbour_node_index = p_element->GetNodeGlobalIndex(local_index);
+                if (neighbour_node_index == current_node_index)
+                {
+                    continue;
+                }
+                double updated_time = ComputeLocalUpdate(p_element, local_index, r_metric);
+                if (updated_time < mActivationTimes[neighbour_node_index] - 2*DBL_EPSILON*fabs(updated_time))
+                {
+                    UpdateNode(neighbour_node_index, updated_time);
+                }
+            }
+        }
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+double EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::ComputeLocalUpdate(Element<ELEMENT_DIM, SPACE_DIM>* pElement,
+                                                                           unsigned localIndex,
+                                                                           const c_matrix<double, SPACE_DIM, SPACE_DIM>& rMetric) const
+{
+    const c_vector<double, SPACE_DIM>& r_target = pElement->GetNode(localIndex)->rGetLocation();
+
+    // The other nodes of the element with a known time
+    unsigned known[ELEMENT_DIM];
+    unsigned num_known = 0;
+    for (unsigned i=0; i<pElement->GetNumNodes(); i++)
+    {
+        if (i != localIndex && mActivationTimes[pElement->GetNodeGlobalIndex(i)] < DBL_MAX)
+        {
+            known[num_known++] = i;
+        }
+    }
+
+    /*
+     * The arrival time through a face with nodes x_0..x_k (times T_0..T_k) is the minimum over
+     * points p = x_k + sum_i mu_i (x_i - x_k) of the face of
+     *
+     *   T(p) + |x - p|,  with T(p) = T_k + sum_i mu_i (T_i - T_k) and |r|^2 = r' M r.
+     *
+     * The function is convex in mu, so its minimum over the face is either a stationary point inside
+     * the face or lies on a smaller face. Taking the least over every face (each subset of the known
+     * nodes) of the interior stationary points, and of the vertices, gives the exact minimum.
+     */
+    double best_time = DBL_MAX;
+    for (unsigned subset=1; subset < (1u<<num_known); subset++)
+    {
+        unsigned members[ELEMENT_DIM];
+        unsigned num_members = 0;
+        for (unsigned i=0; i<num_known; i++)
+        {
+            if (subset & (1u<<i))
+            {
+                members[num_members++] = known[i];
+            }
+        }
+
+        const unsigned base = members[num_members-1];
+        double base_time = mActivationTimes[pElement->GetNodeGlobalIndex(base)];
+        c_vector<double, SPACE_DIM> y = r_target - pElement->GetNode(base)->rGetLocation();
+        c_vector<double, SPACE_DIM> metric_y = prod(rMetric, y);
+        double y_norm_squared = inner_prod(y, metric_y);
+
+        double time = DBL_MAX;
+        if (num_members == 1)
+        {
+            time = base_time + sqrt(y_norm_squared);
+        }
+        else
+        {
+            // Edges e_i = x_i - x_k of the face, their Gram matrix G = E'ME, b = E'My and time differences t
+            c_vector<double, SPACE_DIM> edges[2];
+            c_vector<double, SPACE_DIM> metric_edges[2];
+            double t[2];
+            double b[2];
+            double gram[2][2];
+            unsigned num_edges = num_members - 1;
+            for (unsigned i=0; i<num_edges; i++)
+            {
+                edges[i] = pElement->GetNode(members[i])->rGetLocation() - pElement->GetNode(base)->rGetLocation();
+                metric_edges[i] = prod(rMetric, edges[i]);
+                t[i] = mActivationTimes[pElement->GetNodeGlobalIndex(members[i])] - base_time;
+                b[i] = inner_prod(metric_edges[i], y);
+            }
+            for (unsigned i=0; i<num_edges; i++)
+            {
+                for (unsigned j=0; j<num_edges; j++)
+                {
+                    gram[i][j] = inner_prod(edges[i], metric_edges[j]);
+                }
+            }
+
+            // Inverse of the Gram matrix
+            double inverse[2][2];
+            if (num_edges == 1)
+            {
+                inverse[0][0] = 1.0/gram[0][0];
+            }
+            else
+            {
+                double det = gram[0][0]*gram[1][1] - gram[0][1]*gram[1][0];
+                if (det <= 1e-12*gram[0][0]*gram[1][1])
+                {
+                    // Degenerate face: covered by its edges
+                    continue;
+                }
+                inverse[0][0] = gram[1][1]/det;
+                inverse[0][1] = -gram[0][1]/det;
+                inverse[1][0] = -gram[1][0]/det;
+                inverse[1][1] = gram[0][0]/det;
+            }
+
+            /*
+             * Stationarity gives E'M r = d t, with r = y - E mu and d = |r|, so mu = G^{-1}(b - d t) and
+             * d^2 (1 - t'G^{-1}t) = y'My - b'G^{-1}b.
+             */
+            double t_g_t = 0.0;
+            double b_g_b = 0.0;
+            for (unsigned i=0; i<num_edges; i++)
+            {
+                for (unsigned j=0; j<num_edges; j++)
+                {
+                    t_g_t += t[i]*inverse[i][j]*t[j];
+                    b_g_b += b[i]*inverse[i][j]*b[j];
+                }
+            }
+            double denominator = 1.0 - t_g_t;
+            if (denominator <= 0.0)
+            {
+                // The time differences along the face are too steep for an interior minimum
+                continue;
+            }
+            double d = sqrt(std::max(y_norm_squared - b_g_b, 0.0)/denominator);
+
+            double mu[2];
+            double mu_sum = 0.0;
+            bool inside = true;
+            for (unsigned i=0; i<num_edges; i++)
+            {
+                mu[i] = 0.0;
+                for (unsigned j=0; j<num_edges; j++)
+                {
+                    mu[i] += inverse[i][j]*(b[j] - d*t[j]);
+                }
+                inside = inside && (mu[i] >= 0.0);
+                mu_sum += mu[i];
+            }
+            if (!inside || mu_sum > 1.0)
+            {
+                continue;
+            }
+
+            time = base_time + d;
+            for (unsigned i=0; i<num_edges; i++)
+            {
+                time += mu[i]*t[i];
+            }
+        }
+        best_time = std::min(best_time, time);
+    }
+    return best_time;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::ExchangeSharedNodes()
+{
+    if (mWorkOnEntireMesh)
+    {
+        return !mActivePriorityNodeIndexQueue.empty();
+    }
+    unsigned num_procs = PetscTools::GetNumProcs();
+
+    // Each improved node is sent once, with its latest time
+    std::sort(mUpdatedSharedNodes.begin(), mUpdatedSharedNodes.end());
+    mUpdatedSharedNodes.erase(std::unique(mUpdatedSharedNodes.begin(), mUpdatedSharedNodes.end()), mUpdatedSharedNodes.end());
+
+    // Halo nodes go to their owner; owned nodes go to every process holding them as a halo node
+    std::vector<std::vector<double> > outgoing(num_procs);
+    for (unsigned i=0; i<mUpdatedSharedNodes.size(); i++)
+    {
+        unsigned node_index = mUpdatedSharedNodes[i];
+        if (mLo<=node_index && node_index<mHi)
+        {
+            const std::vector<unsigned>& r_sharers = mHaloSharers[node_index];
+            for (unsigned j=0; j<r_sharers.size(); j++)
+            {
+                outgoing[r_sharers[j]].push_back(node_index);
+                outgoing[r_sharers[j]].push_back(mActivationTimes[node_index]);
+            }
+        }
+        else
+        {
+            unsigned owner = std::upper_bound(mProcessLows.begin(), mProcessLows.end(), node_index) - mProcessLows.begin() - 1;
+            outgoing[owner].push_back(node_index);
+            outgoing[owner].push_back(mActivationTimes[node_index]);
+        }
+    }
+    mUpdatedSharedNodes.clear();
+
+    // Pack index/time pairs (indices are exact in a double) into one array, grouped by destination
+    std::vector<int> send_counts(num_procs);
+    std::vector<double> send_buffer;
+    for (unsigned process=0; process<num_procs; process++)
+    {
+        send_counts[process] = outgoing[process].size();
+        send_buffer.insert(send_buffer.end(), outgoing[process].begin(), outgoing[process].end());
+    }
+
+    std::vector<int> receive_counts(num_procs);
+    MPI_Alltoall(&send_counts[0], 1, MPI_INT, &receive_counts[0], 1, MPI_INT, PETSC_COMM_WORLD);
+
+    std::vector<int> send_displacements(num_procs, 0);
+    std::vector<int> receive_displacements(num_procs, 0);
+    for (unsigned process=1; process<num_procs; process++)
+    {
+        send_displacements[process] = send_displacements[process-1] + send_counts[process-1];
+        receive_displacements[process] = receive_displacements[process-1] + receive_counts[process-1];
+    }
+    std::vector<double> receive_buffer(receive_displacements[num_procs-1] + receive_counts[num_procs-1]);
+
+    MPI_Alltoallv(send_buffer.data(), &send_counts[0], &send_displacements[0], MPI_DOUBLE,
+                  receive_buffer.data(), &receive_counts[0], &receive_displacements[0], MPI_DOUBLE,
+                  PETSC_COMM_WORLD);
+
+    for (unsigned i=0; i<receive_buffer.size(); i+=2)
+    {
+        unsigned node_index = static_cast<unsigned>(receive_buffer[i]);
+        double time = receive_buffer[i+1];
+        assert(IsNodeKnownLocally(node_index));
+
+        // Owners pass improvements on to the other processes holding the node (see UpdateNode())
+        if (time < mActivationTimes[node_index] - 2*DBL_EPSILON*fabs(time))
+        {
+            if (mLo<=node_index && node_index<mHi)
+            {
+                UpdateNode(node_index, time);
+            }
+            else
+            {
+                // An update from the owner: no need to send it back
+                mActivationTimes[node_index] = time;
+                mActivePriorityNodeIndexQueue.push(std::pair<double, unsigned>(-time, node_index));
+            }
+        }
+    }
+
+    return PetscTools::ReplicateBool(!mActivePriorityNodeIndexQueue.empty() || !mUpdatedSharedNodes.empty());
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+const std::vector<double>& EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::rGetActivationTimes() const
+{
+    return mActivationTimes;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void EikonalActivationSolver<ELEMENT_DIM, SPACE_DIM>::WriteActivationMap(const std::string& rFilename)
+{
+    if (mActivationTimes.empty())
+    {
+        EXCEPTION("Solve() must be called before writing the activation map.");
+    }
+
+    OutputFileHandler output_handler(HeartConfig::Instance()->GetOutputDirectory(), false);
+    unsigned lo = mrMesh.GetDistributedVectorFactory()->GetLow();
+    unsigned hi = mrMesh.GetDistributedVectorFactory()->GetHigh();
+
+    // Belt and braces
+    std::stringstream filepath_process_specific;
+    filepath_process_specific << rFilename << "." << PetscTools::GetMyRank();
+    out_stream file_stream_process_specific = output_handler.OpenOutputFile(filepath_process_specific.str().c_str());
+    for (unsigned i=lo; i<hi; i++)
+    {
+        double activation_time = (mActivationTimes[i] < DBL_MAX) ? mActivationTimes[i] : -1.0;
+        (*file_stream_process_specific) << activation_time << ",\t" << -1.0 << ",\t" << -1.0 << ",\t" << -1.0 << "\n";
+    }
+    file_stream_process_specific->close();
+
+    PetscTools::BeginRoundRobin();
+    {
+        out_stream file_stream = out_stream(NULL);
+        // Open the file as new or append
+        if (PetscTools::AmMaster())
+        {
+            file_stream = output_handler.OpenOutputFile(rFilename);
+        }
+        else
+        {
+            file_stream = output_handler.OpenOutputFile(rFilename, std::ios::app);
+        }
+        for (unsigned i=lo; i<hi; i++)
+        {
+            double activation_time = (mActivationTimes[i] < DBL_MAX) ? mActivationTimes[i] : -1.0;
+            (*file_stream) << activation_time << ",\t" << -1.0 << ",\t" << -1.0 << ",\t" << -1.0 << "\n";
+        }
+        file_stream->close();
+    }
+    PetscTools::EndRoundRobin();
+}
+
+// Explicit instantiation
+template class EikonalActivationSolver<1,1>;
+template class EikonalActivationSolver<1,2>;
+template class EikonalActivationSolver<1,3>;
+template class EikonalActivationSolver<2,2>;
+template class EikonalActivationSolver<3,3>;
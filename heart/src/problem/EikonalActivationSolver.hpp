@@ -0,0 +1,261 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef EIKONALACTIVATIONSOLVER_HPP_
+#define EIKONALACTIVATIONSOLVER_HPP_
+
+#include <climits>
+#include <vector>
+#include <map>
+#include <queue>
+#include <string>
+
+#include "UblasIncludes.hpp"
+#include "AbstractTetrahedralMesh.hpp"
+#include "AbstractConductivityTensors.hpp"
+#include "AbstractCardiacTissue.hpp"
+
+/**
+ * Computes activation times by solving the anisotropic eikonal equation
+ *
+ *   sqrt( grad(T)' V grad(T) ) = 1,  with V = theta^2 sigma,
+ *
+ * on a mesh, as a cheap surrogate for a monodomain simulation when only the activation sequence
+ * is wanted. sigma is the conductivity tensor of each element, so a wave travelling along a principal
+ * direction with conductivity g has speed theta*sqrt(g), which is how conduction velocity scales with
+ * conductivity in the monodomain equation. theta (the conduction velocity scale) is calibrated by
+ * the user, e.g. from one monodomain run: theta = fibre conduction velocity / sqrt(sigma_fibre).
+ *
+ * The solver is label-correcting, like DistanceMapCalculator: nodes are taken from a priority queue
+ * in order of activation time, and the other nodes of each element around them are updated with the
+ * exact solution on that element (the least interpolated arrival time plus anisotropic travel time over
+ * the faces formed by nodes with known times). Since anisotropy can break causality, a node is put
+ * back in the queue whenever a better time is found for it.
+ *
+ * On a DistributedTetrahedralMesh each process works on its own elements. Between rounds, improved
+ * times at nodes shared between processes are exchanged in one batch per neighbouring process, until
+ * no process has work left.
+ *
+ * Activation maps can be written in the layout used by ActivationOutputModifier.
+ */
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+class EikonalActivationSolver
+{
+private:
+    friend class TestEikonalActivationSolver;
+
+    /** The mesh */
+    AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>& mrMesh;
+
+    /** The conductivity tensors (if given to the constructor) */
+    AbstractConductivityTensors<ELEMENT_DIM, SPACE_DIM>* mpConductivityTensors;
+
+    /** The tissue providing the (intracellular) conductivity tensors (if given to the constructor) */
+    AbstractCardiacTissue<ELEMENT_DIM, SPACE_DIM>* mpTissue;
+
+    /** The conduction velocity scale theta (see class documentation) */
+    double mConductionVelocityScale;
+
+    /** Stimulus sites: global node index and activation time */
+    std::vector<std::pair<unsigned, double> > mStimulusSites;
+
+    /** Activation time of every node (DBL_MAX if not activated), valid on all processes after Solve() */
+    std::vector<double> mActivationTimes;
+
+    /** First node owned by this process */
+    unsigned mLo;
+
+    /** One past the last node owned by this process */
+    unsigned mHi;
+
+    /** Whether we work on the entire mesh (true if sequential or the mesh is not distributed) */
+    bool mWorkOnEntireMesh;
+
+    /** (Only used when mWorkOnEntireMesh == false).  The first node index owned by each process. */
+    std::vector<unsigned> mProcessLows;
+
+    /** (Only used when mWorkOnEntireMesh == false).  Sorted indices of this process's halo nodes. */
+    std::vector<unsigned> mHaloNodeIndices;
+
+    /** (Only used when mWorkOnEntireMesh == false).  For owned nodes that are halo nodes elsewhere, the processes holding them. */
+    std::map<unsigned, std::vector<unsigned> > mHaloSharers;
+
+    /** Shared (owned or halo) nodes whose time has improved since the last exchange, possibly with repeats */
+    std::vector<unsigned> mUpdatedSharedNodes;
+
+    /**
+     * The travel time metric of each local element, indexed by local element index (the order
+     * of the mesh's element iterator).  This is the inverse of the squared velocity tensor,
+     * Inverse(sigma)/theta^2, and is zero for elements which don't conduct.  Set up by Solve().
+     */
+    std::vector<c_matrix<double, SPACE_DIM, SPACE_DIM> > mElementMetrics;
+
+    /**
+     * The local index into #mElementMetrics of each element, indexed by global element index,
+     * or UINT_MAX if the element isn't local or doesn't conduct (i.e. is bath or doesn't have a
+     * positive definite conductivity tensor).  Set up by Solve().
+     */
+    std::vector<unsigned> mLocalElementIndices;
+
+    /** Queue of nodes to be processed, with priority -time so that the earliest is popped first */
+    std::priority_queue<std::pair<double, unsigned> > mActivePriorityNodeIndexQueue;
+
+    /** Number of exchange rounds taken by the last Solve() */
+    unsigned mRoundCounter;
+
+    /**
+     * Set up the parallel information; called by both constructors.
+     */
+    void CommonConstructor();
+
+    /**
+     * @return the conductivity tensor of an element
+     *
+     * @param elementIndex  global index of the element
+     */
+    const c_matrix<double, SPACE_DIM, SPACE_DIM>& rGetConductivityTensor(unsigned elementIndex);
+
+    /**
+     * Fill in #mElementMetrics and #mLocalElementIndices from the conductivity tensors.
+     */
+    void ComputeElementMetrics();
+
+    /**
+     * @return whether this process holds a node (owns it, or has it as a halo node)
+     *
+     * @param nodeIndex  global node index
+     */
+    bool IsNodeKnownLocally(unsigned nodeIndex) const;
+
+    /**
+     * Set a better activation time for a node known locally, queue it, and note it for the next
+     * exchange if it is shared with other processes.
+     *
+     * @param nodeIndex  global node index
+     * @param time  the new activation time
+     */
+    void UpdateNode(unsigned nodeIndex, double time);
+
+    /**
+     * Process the local queue until it is empty.
+     */
+    void WorkOnLocalQueue();
+
+    /**
+     * Send the improved times of shared nodes to the other processes holding them, and take the
+     * improvements sent by others.
+     *
+     * @return whether any process has work left
+     */
+    bool ExchangeSharedNodes();
+
+    /**
+     * @return the activation time of a node of an element computed from the times at the element's
+     * other nodes (DBL_MAX if none is known)
+     *
+     * @param pElement  the element
+     * @param localIndex  local index (in the element) of the node to update
+     * @param rMetric  the inverse of the squared velocity tensor on the element
+     */
+    double ComputeLocalUpdate(Element<ELEMENT_DIM, SPACE_DIM>* pElement,
+                              unsigned localIndex,
+                              const c_matrix<double, SPACE_DIM, SPACE_DIM>& rMetric) const;
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param rMesh  the mesh
+     * @param rConductivityTensors  conductivity tensors, already initialised on the mesh
+     * @param conductionVelocityScale  the scale theta, so that the speed along a principal direction
+     *     with conductivity g is theta*sqrt(g)
+     */
+    EikonalActivationSolver(AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>& rMesh,
+                            AbstractConductivityTensors<ELEMENT_DIM, SPACE_DIM>& rConductivityTensors,
+                            double conductionVelocityScale);
+
+    /**
+     * Constructor using the intracellular conductivity tensors of a tissue, as built from HeartConfig
+     * (fibre file, conductivities and heterogeneities) by a cardiac problem's Initialise().
+     *
+     * @param rMesh  the mesh of the tissue
+     * @param rTissue  the tissue
+     * @param conductionVelocityScale  the scale theta, so that the speed along a principal direction
+     *     with conductivity g is theta*sqrt(g)
+     */
+    EikonalActivationSolver(AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>& rMesh,
+                            AbstractCardiacTissue<ELEMENT_DIM, SPACE_DIM>& rTissue,
+                            double conductionVelocityScale);
+
+    /**
+     * Activate a node at a given time. Should be called with the same arguments on every
+     * process, or at least on one holding the node.
+     *
+     * @param nodeIndex  global node index
+     * @param time  activation time (defaults to 0)
+     */
+    void AddStimulusSite(unsigned nodeIndex, double time=0.0);
+
+    /**
+     * Activate the nodes inside the stimulated regions defined in HeartConfig, at the start time
+     * of their (SimpleStimulus or RegularStimulus) stimulus.
+     */
+    void AddStimulusSitesFromHeartConfig();
+
+    /**
+     * Compute the activation times.
+     */
+    void Solve();
+
+    /**
+     * @return the activation time of every node (DBL_MAX for nodes which are not reached), indexed
+     * by global node index and valid on every process
+     */
+    const std::vector<double>& rGetActivationTimes() const;
+
+    /**
+     * Write the activation map to a file in the HeartConfig output directory, with the layout used by
+     * ActivationOutputModifier: one line per node in the order of the mesh's DistributedVectorFactory,
+     * giving first activation, first recovery, second activation and second recovery times. Only the
+     * first column is computed; the others, and the activation time of nodes not reached, are -1.
+     * Each process also writes its own lines to <filename>.<rank>.
+     *
+     * @param rFilename  the file name
+     */
+    void WriteActivationMap(const std::string& rFilename);
+};
+
+#endif /*EIKONALACTIVATIONSOLVER_HPP_*/
@@ -240,6 +240,7 @@ HeartConfig::HeartConfig()
     mIndexEndo = UINT_MAX - 3u;
 
     mUseReactionDiffusionOperatorSplitting = false;
+    mUseCompactConductivityTensors = false;
 
     /// \todo #1703 This defaults should be set in HeartConfigDefaults.hpp
     mTissueIdentifiers.insert(0);
@@ -2881,6 +2882,16 @@ bool HeartConfig::GetUseReactionDiffusionOperatorSplitting()
     return mUseReactionDiffusionOperatorSplitting;
 }
 
+void HeartConfig::SetUseCompactConductivityTensors(bool useCompactTensors)
+{
+    mUseCompactConductivityTensors = useCompactTensors;
+}
+
+bool HeartConfig::GetUseCompactConductivityTensors()
+{
+    return mUseCompactConductivityTensors;
+}
+
 void HeartConfig::SetUseFixedNumberIterationsLinearSolver(bool useFixedNumberIterations, unsigned evaluateNumItsEveryNSolves)
 {
     mUseFixedNumberIterations = useFixedNumberIterations;
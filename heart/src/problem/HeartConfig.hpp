@@ -125,6 +125,10 @@ private:
             archive & mUseFixedNumberIterations;
             archive & mEvaluateNumItsEveryNSolves;
         }
+        if (version > 2)
+        {
+            archive & mUseCompactConductivityTensors;
+        }
 
         PetscTools::Barrier("HeartConfig::save");
     }
@@ -159,6 +163,10 @@ private:
             archive & mUseFixedNumberIterations;
             archive & mEvaluateNumItsEveryNSolves;
         }
+        if (version > 2)
+        {
+            archive & mUseCompactConductivityTensors;
+        }
     }
     BOOST_SERIALIZATION_SPLIT_MEMBER()
 
@@ -749,6 +757,11 @@ public:
      */
     bool GetUseReactionDiffusionOperatorSplitting();
 
+    /**
+     *  @return whether conductivity tensors are stored compactly (see SetUseCompactConductivityTensors()).
+     */
+    bool GetUseCompactConductivityTensors();
+
     /**
      *  @return whether to use a fixed number of iterations in the linear solver
      */
@@ -1181,6 +1194,16 @@ public:
      */
     void SetUseReactionDiffusionOperatorSplitting(bool useOperatorSplitting = true);
 
+    /**
+     * Store conductivity tensors compactly: a single-precision fibre orientation and an index into a
+     * table of distinct conductivities per element, rather than a full tensor per element. Tensors are
+     * rebuilt during assembly. This saves memory on large meshes with fibre orientation, at the cost
+     * of rounding the fibre directions to single precision.
+     *
+     * @param useCompactTensors Whether to use compact conductivity tensors (defaults to true).
+     */
+    void SetUseCompactConductivityTensors(bool useCompactTensors = true);
+
     /**
      * Set the use of fixed number of iterations in the linear solver
      *
@@ -1337,6 +1360,11 @@ private:
      */
     bool mUseReactionDiffusionOperatorSplitting;
 
+    /**
+     *  Flag telling whether to store conductivity tensors compactly.
+     */
+    bool mUseCompactConductivityTensors;
+
     /**
      *  Map defining bath conductivity for multiple bath regions
      */
@@ -1388,7 +1416,7 @@ private:
 };
 
 
-BOOST_CLASS_VERSION(HeartConfig, 2)
+BOOST_CLASS_VERSION(HeartConfig, 3)
 #include "SerializationExportWrapper.hpp"
 // Declare identifier for the serializer
 CHASTE_CLASS_EXPORT(HeartConfig)
@@ -0,0 +1,253 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "PseudoEcgOutputModifier.hpp"
+
+#include <cfloat>
+#include "GaussianQuadratureRule.hpp"
+#include "HeartConfig.hpp"
+#include "HeartRegionCodes.hpp"
+#include "LinearBasisFunction.hpp"
+#include "MathsCustomFunctions.hpp"
+#include "PetscTools.hpp"
+#include "PetscVecTools.hpp"
+#include "UblasCustomFunctions.hpp"
+
+template<unsigned DIM>
+PseudoEcgOutputModifier<DIM>::PseudoEcgOutputModifier(const std::string& rFilename,
+                                                       AbstractTetrahedralMesh<DIM,DIM>& rMesh,
+                                                       const std::vector<ChastePoint<DIM> >& rElectrodes,
+                                                       double diffusionCoefficient,
+                                                       double flushTime)
+    : AbstractOutputModifier(rFilename, flushTime),
+      mpMesh(&rMesh),
+      mElectrodes(rElectrodes),
+      mDiffusionCoefficient(diffusionCoefficient),
+      mFileStream(NULL)
+{
+    if (mElectrodes.empty())
+    {
+        EXCEPTION("At least one electrode is needed to compute a pseudo-ECG.");
+    }
+    assert(diffusionCoefficient >= 0.0);
+}
+
+template<unsigned DIM>
+void PseudoEcgOutputModifier<DIM>::ComputeWeights(DistributedVectorFactory* pVectorFactory)
+{
+    const unsigned num_electrodes = mElectrodes.size();
+    std::vector<Vec> weights(num_electrodes);
+    for (unsigned electrode=0; electrode<num_electrodes; electrode++)
+    {
+        weights[electrode] = pVectorFactory->CreateVec();
+        PetscVecTools::Zero(weights[electrode]);
+    }
+
+    // Third order quadrature, as used by PseudoEcgCalculator
+    GaussianQuadratureRule<DIM> quad_rule(3);
+
+    try
+    {
+        for (typename AbstractTetrahedralMesh<DIM,DIM>::ElementIterator iter = mpMesh->GetElementIteratorBegin();
+             iter != mpMesh->GetElementIteratorEnd();
+             ++iter)
+        {
+            if (!mpMesh->CalculateDesignatedOwnershipOfElement(iter->GetIndex())
+                || HeartRegionCode::IsRegionBath(iter->GetUnsignedAttribute()))
+            {
+                continue;
+            }
+
+            double jacobian_determinant;
+            c_matrix<double, DIM, DIM> jacobian;
+            c_matrix<double, DIM, DIM> inverse_jacobian;
+            iter->CalculateInverseJacobian(jacobian, jacobian_determinant, inverse_jacobian);
+
+            std::vector<c_vector<double, DIM+1> > element_weights(num_electrodes, zero_vector<double>(DIM+1));
+
+            for (unsigned quad_index=0; quad_index<quad_rule.GetNumQuadPoints(); quad_index++)
+            {
+                const ChastePoint<DIM>& quad_point = quad_rule.rGetQuadPoint(quad_index);
+
+                c_vector<double, DIM+1> phi;
+                LinearBasisFunction<DIM>::ComputeBasisFunctions(quad_point, phi);
+                c_matrix<double, DIM, DIM+1> grad_phi;
+                LinearBasisFunction<DIM>::ComputeTransformedBasisFunctionDerivatives(quad_point, inverse_jacobian, grad_phi);
+
+                c_vector<double, DIM> x = zero_vector<double>(DIM);
+                for (unsigned i=0; i<DIM+1; i++)
+                {
+                    x += phi(i)*iter->GetNode(i)->rGetLocation();
+                }
+
+                double wJ = jacobian_determinant * quad_rule.GetWeight(quad_index);
+
+                for (unsigned electrode=0; electrode<num_electrodes; electrode++)
+                {
+                    c_vector<double, DIM> r_vector = x - mElectrodes[electrode].rGetLocation();
+                    double norm_r = norm_2(r_vector);
+                    if (norm_r <= DBL_EPSILON)
+                    {
+                        EXCEPTION("Probe is on a mesh Gauss point.");
+                    }
+                    c_vector<double, DIM> grad_one_over_r = -r_vector*SmallPow(1.0/norm_r, 3);
+
+                    for (unsigned i=0; i<DIM+1; i++)
+                    {
+                        element_weights[electrode](i) -= mDiffusionCoefficient * inner_prod(column(grad_phi, i), grad_one_over_r) * wJ;
+                    }
+                }
+            }
+
+            for (unsigned electrode=0; electrode<num_electrodes; electrode++)
+            {
+                for (unsigned i=0; i<DIM+1; i++)
+                {
+                    PetscVecTools::AddToElement(weights[electrode], iter->GetNodeGlobalIndex(i), element_weights[electrode](i));
+                }
+            }
+        }
+    }
+    catch (Exception& e)
+    {
+        PetscTools::ReplicateException(true);
+        for (unsigned electrode=0; electrode<num_electrodes; electrode++)
+        {
+            PetscTools::Destroy(weights[electrode]);
+        }
+        throw e;
+    }
+    PetscTools::ReplicateException(false);
+
+    // Keep a plain copy of the locally owned weights
+    unsigned local_size = pVectorFactory->GetLocalOwnership();
+    mWeights.assign(num_electrodes, std::vector<double>(local_size));
+    for (unsigned electrode=0; electrode<num_electrodes; electrode++)
+    {
+        PetscVecTools::Finalise(weights[electrode]);
+        double* p_weights;
+        VecGetArray(weights[electrode], &p_weights);
+        for (unsigned local_index=0; local_index<local_size; local_index++)
+        {
+            mWeights[electrode][local_index] = p_weights[local_index];
+        }
+        VecRestoreArray(weights[electrode], &p_weights);
+        PetscTools::Destroy(weights[electrode]);
+    }
+}
+
+template<unsigned DIM>
+void PseudoEcgOutputModifier<DIM>::InitialiseAtStart(DistributedVectorFactory* pVectorFactory, const std::vector<unsigned>& rNodePermutation)
+{
+    assert(mpMesh != NULL);
+    assert(pVectorFactory->GetProblemSize() == mpMesh->GetNumNodes());
+    ComputeWeights(pVectorFactory);
+    mPseudoEcgs.assign(mElectrodes.size(), 0.0);
+
+    // Collectively open the output directory - this might already be in place from creating the HDF5 file
+    OutputFileHandler output_handler(HeartConfig::Instance()->GetOutputDirectory(), false);
+    if (PetscTools::AmMaster())
+    {
+        mFileStream = output_handler.OpenOutputFile(mFilename);
+        (*mFileStream) << "#Time(ms)";
+        for (unsigned electrode=0; electrode<mElectrodes.size(); electrode++)
+        {
+            (*mFileStream) << "\tPseudo-ECG(" << mElectrodes[electrode].GetWithDefault(0)
+                           << "," << mElectrodes[electrode].GetWithDefault(1)
+                           << "," << mElectrodes[electrode].GetWithDefault(2) << ")";
+        }
+        (*mFileStream) << "\n";
+    }
+}
+
+template<unsigned DIM>
+void PseudoEcgOutputModifier<DIM>::FinaliseAtEnd()
+{
+    if (PetscTools::AmMaster())
+    {
+        mFileStream->close();
+    }
+}
+
+template<unsigned DIM>
+void PseudoEcgOutputModifier<DIM>::ProcessSolutionAtTimeStep(double time, Vec solution, unsigned problemDim)
+{
+    const unsigned num_electrodes = mElectrodes.size();
+    std::vector<double> local_ecgs(num_electrodes, 0.0);
+
+    double* p_solution;
+    VecGetArray(solution, &p_solution);
+    for (unsigned electrode=0; electrode<num_electrodes; electrode++)
+    {
+        const std::vector<double>& r_weights = mWeights[electrode];
+        for (unsigned local_index=0; local_index<r_weights.size(); local_index++)
+        {
+            local_ecgs[electrode] += r_weights[local_index]*p_solution[local_index*problemDim];
+        }
+    }
+    VecRestoreArray(solution, &p_solution);
+
+    MPI_Allreduce(&local_ecgs[0], &mPseudoEcgs[0], num_electrodes, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+
+    if (PetscTools::AmMaster())
+    {
+        (*mFileStream) << time;
+        for (unsigned electrode=0; electrode<num_electrodes; electrode++)
+        {
+            (*mFileStream) << "\t" << mPseudoEcgs[electrode];
+        }
+        (*mFileStream) << "\n";
+
+        if (mFlushTime > 0.0 && Divides(mFlushTime, time))
+        {
+            mFileStream->flush();
+        }
+    }
+}
+
+template<unsigned DIM>
+const std::vector<double>& PseudoEcgOutputModifier<DIM>::rGetPseudoEcgs() const
+{
+    return mPseudoEcgs;
+}
+
+// Explicit instantiation
+template class PseudoEcgOutputModifier<1>;
+template class PseudoEcgOutputModifier<2>;
+template class PseudoEcgOutputModifier<3>;
+
+// Serialization for Boost >= 1.36
+#include "SerializationExportWrapperForCpp.hpp"
+EXPORT_TEMPLATE_CLASS_SAME_DIMS(PseudoEcgOutputModifier)
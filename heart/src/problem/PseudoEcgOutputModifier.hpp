@@ -0,0 +1,189 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef PSEUDOECGOUTPUTMODIFIER_HPP_
+#define PSEUDOECGOUTPUTMODIFIER_HPP_
+
+#include "ChasteSerialization.hpp"
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <vector>
+#include "AbstractOutputModifier.hpp"
+#include "AbstractTetrahedralMesh.hpp"
+#include "ChastePoint.hpp"
+#include "OutputFileHandler.hpp"
+
+/**
+ * Computes pseudo-ECGs at a set of electrode positions during the solve, rather than
+ * afterwards from the HDF5 output as PseudoEcgCalculator does.
+ *
+ * The pseudo-ECG at an electrode is the integral over the tissue of
+ *
+ * - D * grad (V) dot grad (1/r)
+ *
+ * (see PseudoEcgCalculator). With linear basis functions this is a linear function of the
+ * nodal voltages, sum_a V_a w_a, where the lead-field weight of node a is
+ *
+ * w_a = - D * integral of grad(N_a) dot grad (1/r).
+ *
+ * The weights of the locally owned nodes are computed once, in InitialiseAtStart(), using the
+ * same quadrature as PseudoEcgCalculator, so each output step costs one dot product per
+ * electrode over the local nodes plus a single reduction. Bath elements are skipped.
+ *
+ * As nothing is read back from disk, the voltage output can be switched off altogether with
+ * AbstractCardiacProblem::SetPrintOutput(false).
+ *
+ * The output file (written by the master process in the HeartConfig output directory) has a
+ * time column followed by one column per electrode.
+ *
+ * WARNING:  As with SingleTraceOutputModifier, the output file is not saved in a checkpoint and
+ *           will be overwritten by a restarted simulation.
+ */
+template<unsigned DIM>
+class PseudoEcgOutputModifier : public AbstractOutputModifier
+{
+private:
+    /** For testing */
+    friend class TestPseudoEcgCalculator;
+    /** Needed for serialization. */
+    friend class boost::serialization::access;
+
+    /**
+     * Archive the output modifier, never used directly - boost uses this.
+     * The lead-field weights are not archived since they are recalculated in InitialiseAtStart().
+     *
+     * @param archive the archive
+     * @param version the current version of this class
+     */
+    template<class Archive>
+    void serialize(Archive & archive, const unsigned int version)
+    {
+        // This calls serialize on the base class.
+        archive & boost::serialization::base_object<AbstractOutputModifier>(*this);
+        archive & mpMesh;
+        archive & mElectrodes;
+        archive & mDiffusionCoefficient;
+    }
+
+    /** Private constructor, for archiving */
+    PseudoEcgOutputModifier()
+        : mpMesh(NULL),
+          mDiffusionCoefficient(1.0),
+          mFileStream(NULL)
+    {}
+
+    /** The mesh on which the problem is solved (not owned by this class). */
+    AbstractTetrahedralMesh<DIM,DIM>* mpMesh;
+
+    /** The locations of the recording electrodes. */
+    std::vector<ChastePoint<DIM> > mElectrodes;
+
+    /** The diffusion coefficient D. */
+    double mDiffusionCoefficient;
+
+    /**
+     * The lead-field weights, mWeights[e][i] being the weight of the i-th locally owned
+     * node for electrode e.
+     */
+    std::vector<std::vector<double> > mWeights;
+
+    /** The pseudo-ECGs at the last time step processed, one per electrode. */
+    std::vector<double> mPseudoEcgs;
+
+    /** Output file stream (remains open during solve, master process only). */
+    out_stream mFileStream;
+
+    /**
+     * Compute #mWeights by integrating over the elements this process is designated owner of,
+     * and summing the contributions across processes.
+     *
+     * @param pVectorFactory  the vector factory of the mesh
+     */
+    void ComputeWeights(DistributedVectorFactory* pVectorFactory);
+
+public:
+    /**
+     * Constructor.
+     *
+     * The mesh must be the one the problem is solved on (for example from AbstractCardiacProblem::rGetMesh()
+     * after Initialise()), so that node indices match those of the solution vector.
+     *
+     * @param rFilename  The file which is eventually produced by this modifier
+     * @param rMesh  The mesh on which the problem is solved
+     * @param rElectrodes  The locations of the recording electrodes
+     * @param diffusionCoefficient  The diffusion coefficient D (defaults to 1, as in PseudoEcgCalculator)
+     * @param flushTime  The simulation time between manual file flushes (if required)
+     */
+    PseudoEcgOutputModifier(const std::string& rFilename,
+                            AbstractTetrahedralMesh<DIM,DIM>& rMesh,
+                            const std::vector<ChastePoint<DIM> >& rElectrodes,
+                            double diffusionCoefficient=1.0,
+                            double flushTime=0.0);
+
+    /**
+     * Compute the lead-field weights and open the output file.
+     *
+     * @param pVectorFactory  The vector factory which is associated with the calling problem's mesh
+     * @param rNodePermutation The permutation associated with the calling problem's mesh (unused, since
+     *     the mesh given to the constructor is already in runtime order)
+     */
+    virtual void InitialiseAtStart(DistributedVectorFactory* pVectorFactory, const std::vector<unsigned>& rNodePermutation);
+
+    /**
+     * Finalise the modifier (close the file)
+     */
+    virtual void FinaliseAtEnd();
+
+    /**
+     * Compute the pseudo-ECGs at this time step and write a line to file.
+     * This is collective.
+     *
+     * @param time  The current simulation time
+     * @param solution  A working copy of the solution at the current time-step.  This is the PETSc vector which is distributed across the processes.
+     * @param problemDim  The calling problem dimension. The voltage is the first of each node's problemDim entries.
+     */
+    virtual void ProcessSolutionAtTimeStep(double time, Vec solution, unsigned problemDim);
+
+    /**
+     * @return the pseudo-ECGs at the last time step processed, one per electrode (on all processes).
+     */
+    const std::vector<double>& rGetPseudoEcgs() const;
+};
+
+#include "SerializationExportWrapper.hpp"
+EXPORT_TEMPLATE_CLASS_SAME_DIMS(PseudoEcgOutputModifier)
+
+#endif // PSEUDOECGOUTPUTMODIFIER_HPP_
@@ -36,13 +36,16 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractConductivityTensors.hpp"
 #include "Exception.hpp"
 #include <sstream>
+#include <map>
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::AbstractConductivityTensors()
     : mpMesh(NULL),
       mUseNonConstantConductivities(false),
       mUseFibreOrientation(false),
-      mInitialised(false)
+      mInitialised(false),
+      mUseCompactStorage(false),
+      mCachedElementIndex(UNSIGNED_UNSET)
 {
     double init_data[]={DBL_MAX, DBL_MAX, DBL_MAX};
 
@@ -107,6 +110,68 @@ void AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::SetNonConstantConductiv
     mpNonConstantConductivities = pNonConstantConductivities;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::SetUseCompactStorage(bool useCompactStorage)
+{
+    mUseCompactStorage = useCompactStorage;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::BuildConductivityTable()
+{
+    mConductivityTable.clear();
+    mConductivityTableIndices.clear();
+
+    if (!mUseNonConstantConductivities)
+    {
+        for (unsigned dim=0; dim<SPACE_DIM; dim++)
+        {
+            assert(mConstantConductivities(dim) != DBL_MAX);
+        }
+        mConductivityTable.push_back(mConstantConductivities);
+        return;
+    }
+
+    // Heterogeneities are usually defined by a handful of regions, so look each set up in a map
+    std::map<std::vector<double>, unsigned> table_entries;
+    mConductivityTableIndices.reserve(mpNonConstantConductivities->size());
+    for (unsigned local_index=0; local_index<mpNonConstantConductivities->size(); local_index++)
+    {
+        const c_vector<double, SPACE_DIM>& r_conductivities = (*mpNonConstantConductivities)[local_index];
+        std::vector<double> key(r_conductivities.begin(), r_conductivities.end());
+
+        std::map<std::vector<double>, unsigned>::iterator it = table_entries.find(key);
+        if (it == table_entries.end())
+        {
+            it = table_entries.insert(std::make_pair(key, (unsigned)mConductivityTable.size())).first;
+            mConductivityTable.push_back(r_conductivities);
+        }
+        mConductivityTableIndices.push_back(it->second);
+    }
+
+    if (mConductivityTable.size() == 1u)
+    {
+        mConductivityTableIndices.clear();
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+const c_vector<double,SPACE_DIM>& AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::rGetCompactConductivities(unsigned localIndex) const
+{
+    if (mConductivityTableIndices.empty())
+    {
+        return mConductivityTable[0];
+    }
+    return mConductivityTable[mConductivityTableIndices[localIndex]];
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::ReconstructTensor(unsigned localIndex, c_matrix<double,SPACE_DIM,SPACE_DIM>& rTensor) const
+{
+    // Subclasses supporting compact storage override this method
+    NEVER_REACHED;
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 c_matrix<double,SPACE_DIM,SPACE_DIM>& AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::operator[](const unsigned global_index)
 {
@@ -123,6 +188,16 @@ c_matrix<double,SPACE_DIM,SPACE_DIM>& AbstractConductivityTensors<ELEMENT_DIM,SP
     else
     {
         unsigned local_index = mpMesh->SolveElementMapping(global_index); //This will throw if we don't own the element
+        if (mUseCompactStorage)
+        {
+            // Assemblers ask for the same element's tensor at every quadrature point, so keep the last one
+            if (global_index != mCachedElementIndex)
+            {
+                ReconstructTensor(local_index, mCachedTensor);
+                mCachedElementIndex = global_index;
+            }
+            return mCachedTensor;
+        }
         return mTensors[local_index];
     }
 }
@@ -77,6 +77,52 @@ protected:
     /** Fibre file reader */
     std::shared_ptr<FibreReader<SPACE_DIM> > mFileReader;
 
+    /** Whether Init() should build the compact representation (see SetUseCompactStorage()) */
+    bool mUseCompactStorage;
+
+    /**
+     * Compact representation: the fibre orientation of each local element, stored as a fixed number
+     * of floats per element chosen by the subclass. Empty if no fibre orientation file is used.
+     */
+    std::vector<float> mCompactOrientations;
+
+    /** Compact representation: the distinct sets of conductivities used by the local elements */
+    std::vector<c_vector<double, SPACE_DIM> > mConductivityTable;
+
+    /**
+     * Compact representation: the entry of mConductivityTable used by each local element.
+     * Empty if the table has a single entry.
+     */
+    std::vector<unsigned> mConductivityTableIndices;
+
+    /** Global index of the element whose tensor is held in mCachedTensor (UNSIGNED_UNSET if none) */
+    unsigned mCachedElementIndex;
+
+    /** The most recently reconstructed tensor when using the compact representation */
+    c_matrix<double,SPACE_DIM,SPACE_DIM> mCachedTensor;
+
+    /**
+     * Fill mConductivityTable and mConductivityTableIndices from the constant or non-constant
+     * conductivities. Called by Init() in the subclasses when building the compact representation.
+     */
+    void BuildConductivityTable();
+
+    /**
+     * @return the conductivities of a local element in the compact representation
+     *
+     * @param localIndex  local index of the element
+     */
+    const c_vector<double,SPACE_DIM>& rGetCompactConductivities(unsigned localIndex) const;
+
+    /**
+     * Reconstruct the tensor of a local element from the compact representation.
+     * Subclasses that build a compact representation in Init() must override this method.
+     *
+     * @param localIndex  local index of the element
+     * @param rTensor  filled in with the tensor
+     */
+    virtual void ReconstructTensor(unsigned localIndex, c_matrix<double,SPACE_DIM,SPACE_DIM>& rTensor) const;
+
 public:
 
     AbstractConductivityTensors();
@@ -124,6 +170,16 @@ public:
      */
     void SetNonConstantConductivities(std::vector<c_vector<double, SPACE_DIM> >* pNonConstantConductivities);
 
+    /**
+     *  Store a compact representation of the tensors rather than a full matrix per element:
+     *  the fibre orientation in single precision (a quaternion, or fewer angles where that suffices)
+     *  and an index into a table of the distinct conductivities. Tensors are then reconstructed
+     *  when requested through operator[]. Must be called before Init().
+     *
+     *  @param useCompactStorage  whether to use the compact representation
+     */
+    void SetUseCompactStorage(bool useCompactStorage=true);
+
     /**
      *  Computes the tensors based in all the info set
      * @param pMesh a pointer to the mesh on which these tensors are to be used
@@ -133,6 +189,9 @@ public:
     /**
      *  @return the diffussion tensor of the element number "index"
      *
+     *  With compact storage the returned reference is to a single cached tensor, which is
+     *  overwritten when a different element is requested.
+     *
      *  @param global_index Global index of the element of the mesh
      */
     c_matrix<double,SPACE_DIM,SPACE_DIM>& operator[](const unsigned global_index);
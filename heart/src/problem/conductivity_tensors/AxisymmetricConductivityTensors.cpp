@@ -34,6 +34,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <vector>
+#include <algorithm>
 #include "UblasIncludes.hpp"
 #include "AxisymmetricConductivityTensors.hpp"
 #include "Exception.hpp"
@@ -61,6 +62,26 @@ void AxisymmetricConductivityTensors<ELEMENT_DIM, SPACE_DIM>::SetConstantConduct
     this->mConstantConductivities = constantConductivities;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AxisymmetricConductivityTensors<ELEMENT_DIM, SPACE_DIM>::ReconstructTensor(unsigned localIndex, c_matrix<double,SPACE_DIM,SPACE_DIM>& rTensor) const
+{
+    const c_vector<double,SPACE_DIM>& r_conductivities = this->rGetCompactConductivities(localIndex);
+    c_vector<double,SPACE_DIM> fibre_vector((zero_vector<double>(SPACE_DIM)));
+    fibre_vector[0] = 1.0;
+
+    if (SPACE_DIM == 3 && !this->mCompactOrientations.empty())
+    {
+        double polar = this->mCompactOrientations[2*localIndex];
+        double azimuth = this->mCompactOrientations[2*localIndex+1];
+        fibre_vector[0] = sin(polar)*cos(azimuth);
+        fibre_vector[1] = sin(polar)*sin(azimuth);
+        fibre_vector[2] = cos(polar);
+    }
+
+    noalias(rTensor) = r_conductivities[1] * identity_matrix<double>(SPACE_DIM) +
+                       (r_conductivities[0] - r_conductivities[1]) * outer_prod(fibre_vector,fibre_vector);
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void AxisymmetricConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM> *pMesh)
 {
@@ -101,9 +122,20 @@ void AxisymmetricConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetra
             }
         }
 
-        // reserve() allocates all the memory at once, more efficient than relying
-        // on the automatic reallocation scheme.
-        this->mTensors.reserve(this->mpMesh->GetNumLocalElements());
+        if (this->mUseCompactStorage)
+        {
+            this->BuildConductivityTable();
+            if (this->mUseFibreOrientation)
+            {
+                this->mCompactOrientations.reserve(2*this->mpMesh->GetNumLocalElements());
+            }
+        }
+        else
+        {
+            // reserve() allocates all the memory at once, more efficient than relying
+            // on the automatic reallocation scheme.
+            this->mTensors.reserve(this->mpMesh->GetNumLocalElements());
+        }
 
         c_matrix<double, SPACE_DIM, SPACE_DIM> conductivity_matrix(zero_matrix<double>(SPACE_DIM,SPACE_DIM));
 
@@ -160,14 +192,28 @@ void AxisymmetricConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetra
                 this->mFileReader->GetFibreVector(current_fibre_global_index, fibre_vector);
             }
 
-            this->mTensors.push_back( conductivity_matrix(1,1) * identity_matrix<double>(SPACE_DIM) +
-                                      (conductivity_matrix(0,0) - conductivity_matrix(1,1)) * outer_prod(fibre_vector,fibre_vector));
+            if (this->mUseCompactStorage)
+            {
+                // The conductivities are already in the table; store the fibre direction as two angles
+                if (SPACE_DIM == 3 && this->mUseFibreOrientation)
+                {
+                    double polar = acos(std::max(-1.0, std::min(1.0, fibre_vector[2])));
+                    double azimuth = atan2(fibre_vector[1], fibre_vector[0]);
+                    this->mCompactOrientations.push_back(static_cast<float>(polar));
+                    this->mCompactOrientations.push_back(static_cast<float>(azimuth));
+                }
+            }
+            else
+            {
+                this->mTensors.push_back( conductivity_matrix(1,1) * identity_matrix<double>(SPACE_DIM) +
+                                          (conductivity_matrix(0,0) - conductivity_matrix(1,1)) * outer_prod(fibre_vector,fibre_vector));
+            }
 
             local_element_index++;
         }
 
-        assert(this->mTensors.size() == this->mpMesh->GetNumLocalElements());
-        assert(this->mTensors.size() == local_element_index);
+        assert(local_element_index == this->mpMesh->GetNumLocalElements());
+        assert(this->mUseCompactStorage || this->mTensors.size() == local_element_index);
 
         if (this->mUseFibreOrientation)
         {
@@ -45,6 +45,17 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 class AxisymmetricConductivityTensors : public AbstractConductivityTensors<ELEMENT_DIM, SPACE_DIM>
 {
+private:
+
+    /**
+     * Reconstruct the tensor of a local element from the compact representation, in which
+     * the fibre direction is stored as a pair of angles (polar and azimuthal).
+     *
+     * @param localIndex  local index of the element
+     * @param rTensor  filled in with the tensor
+     */
+    void ReconstructTensor(unsigned localIndex, c_matrix<double,SPACE_DIM,SPACE_DIM>& rTensor) const;
+
 public:
     /** Constructor */
     AxisymmetricConductivityTensors();
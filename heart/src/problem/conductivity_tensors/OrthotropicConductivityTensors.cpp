@@ -36,6 +36,129 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "OrthotropicConductivityTensors.hpp"
 #include "Exception.hpp"
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void OrthotropicConductivityTensors<ELEMENT_DIM, SPACE_DIM>::AppendCompactOrientation(const c_matrix<double,SPACE_DIM,SPACE_DIM>& rOrientation)
+{
+    if (SPACE_DIM == 2)
+    {
+        // The sheet direction is perpendicular to the fibre, and its sign does not affect the tensor
+        this->mCompactOrientations.push_back(static_cast<float>(atan2(rOrientation(1,0), rOrientation(0,0))));
+    }
+    else if (SPACE_DIM == 3)
+    {
+        // The sign of the normal does not affect the tensor, so make the frame a proper rotation
+        c_matrix<double,SPACE_DIM,SPACE_DIM> r = rOrientation;
+        double det = r(0,0)*(r(1,1)*r(2,2) - r(2,1)*r(1,2))
+                   - r(0,1)*(r(1,0)*r(2,2) - r(2,0)*r(1,2))
+                   + r(0,2)*(r(1,0)*r(2,1) - r(2,0)*r(1,1));
+        if (det < 0.0)
+        {
+            for (unsigned i=0; i<SPACE_DIM; i++)
+            {
+                r(i,2) = -r(i,2);
+            }
+        }
+
+        // Rotation matrix to unit quaternion (w,x,y,z), choosing the best-conditioned formula
+        double w, x, y, z;
+        double trace = r(0,0) + r(1,1) + r(2,2);
+        if (trace > 0.0)
+        {
+            double s = 2.0*sqrt(trace + 1.0);
+            w = 0.25*s;
+            x = (r(2,1) - r(1,2))/s;
+            y = (r(0,2) - r(2,0))/s;
+            z = (r(1,0) - r(0,1))/s;
+        }
+        else if (r(0,0) > r(1,1) && r(0,0) > r(2,2))
+        {
+            double s = 2.0*sqrt(1.0 + r(0,0) - r(1,1) - r(2,2));
+            w = (r(2,1) - r(1,2))/s;
+            x = 0.25*s;
+            y = (r(0,1) + r(1,0))/s;
+            z = (r(0,2) + r(2,0))/s;
+        }
+        else if (r(1,1) > r(2,2))
+        {
+            double s = 2.0*sqrt(1.0 + r(1,1) - r(0,0) - r(2,2));
+            w = (r(0,2) - r(2,0))/s;
+            x = (r(0,1) + r(1,0))/s;
+            y = 0.25*s;
+            z = (r(1,2) + r(2,1))/s;
+        }
+        else
+        {
+            double s = 2.0*sqrt(1.0 + r(2,2) - r(0,0) - r(1,1));
+            w = (r(1,0) - r(0,1))/s;
+            x = (r(0,2) + r(2,0))/s;
+            y = (r(1,2) + r(2,1))/s;
+            z = 0.25*s;
+        }
+        this->mCompactOrientations.push_back(static_cast<float>(w));
+        this->mCompactOrientations.push_back(static_cast<float>(x));
+        this->mCompactOrientations.push_back(static_cast<float>(y));
+        this->mCompactOrientations.push_back(static_cast<float>(z));
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void OrthotropicConductivityTensors<ELEMENT_DIM, SPACE_DIM>::ReconstructTensor(unsigned localIndex, c_matrix<double,SPACE_DIM,SPACE_DIM>& rTensor) const
+{
+    const c_vector<double,SPACE_DIM>& r_conductivities = this->rGetCompactConductivities(localIndex);
+    c_matrix<double,SPACE_DIM,SPACE_DIM> orientation_matrix((identity_matrix<double>(SPACE_DIM)));
+
+    if (!this->mCompactOrientations.empty())
+    {
+        if (SPACE_DIM == 2)
+        {
+            double angle = this->mCompactOrientations[localIndex];
+            orientation_matrix(0,0) = cos(angle);
+            orientation_matrix(1,0) = sin(angle);
+            orientation_matrix(0,1) = -sin(angle);
+            orientation_matrix(1,1) = cos(angle);
+        }
+        else if (SPACE_DIM == 3)
+        {
+            const float* p_quaternion = &(this->mCompactOrientations[4*localIndex]);
+            double w = p_quaternion[0];
+            double x = p_quaternion[1];
+            double y = p_quaternion[2];
+            double z = p_quaternion[3];
+
+            // Renormalise, since the components were rounded to single precision
+            double norm = sqrt(w*w + x*x + y*y + z*z);
+            w /= norm;
+            x /= norm;
+            y /= norm;
+            z /= norm;
+
+            orientation_matrix(0,0) = 1.0 - 2.0*(y*y + z*z);
+            orientation_matrix(0,1) = 2.0*(x*y - z*w);
+            orientation_matrix(0,2) = 2.0*(x*z + y*w);
+            orientation_matrix(1,0) = 2.0*(x*y + z*w);
+            orientation_matrix(1,1) = 1.0 - 2.0*(x*x + z*z);
+            orientation_matrix(1,2) = 2.0*(y*z - x*w);
+            orientation_matrix(2,0) = 2.0*(x*z - y*w);
+            orientation_matrix(2,1) = 2.0*(y*z + x*w);
+            orientation_matrix(2,2) = 1.0 - 2.0*(x*x + y*y);
+        }
+    }
+
+    // tensor = sum_k g_k a_k a_k', where a_k is column k of the orientation matrix
+    for (unsigned i=0; i<SPACE_DIM; i++)
+    {
+        for (unsigned j=0; j<SPACE_DIM; j++)
+        {
+            double entry = 0.0;
+            for (unsigned k=0; k<SPACE_DIM; k++)
+            {
+                entry += orientation_matrix(i,k)*r_conductivities[k]*orientation_matrix(j,k);
+            }
+            rTensor(i,j) = entry;
+        }
+    }
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void OrthotropicConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM> *pMesh)
 {
@@ -76,9 +199,21 @@ void OrthotropicConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetrah
             }
         }
 
-        // reserve() allocates all the memory at once, more efficient than relying
-        // on the automatic reallocation scheme.
-        this->mTensors.reserve(this->mpMesh->GetNumLocalElements());
+        if (this->mUseCompactStorage)
+        {
+            this->BuildConductivityTable();
+            if (this->mUseFibreOrientation)
+            {
+                unsigned values_per_element = (SPACE_DIM == 1) ? 0u : ((SPACE_DIM == 2) ? 1u : 4u);
+                this->mCompactOrientations.reserve(values_per_element*this->mpMesh->GetNumLocalElements());
+            }
+        }
+        else
+        {
+            // reserve() allocates all the memory at once, more efficient than relying
+            // on the automatic reallocation scheme.
+            this->mTensors.reserve(this->mpMesh->GetNumLocalElements());
+        }
 
         c_matrix<double, SPACE_DIM, SPACE_DIM> conductivity_matrix(zero_matrix<double>(SPACE_DIM,SPACE_DIM));
 
@@ -129,14 +264,25 @@ void OrthotropicConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetrah
                 this->mFileReader->GetFibreSheetAndNormalMatrix(current_fibre_global_index, orientation_matrix);
             }
 
-            c_matrix<double,SPACE_DIM,SPACE_DIM> temp;
-            noalias(temp) = prod(orientation_matrix, conductivity_matrix);
-            this->mTensors.push_back( prod(temp, trans(orientation_matrix) ) );
+            if (this->mUseCompactStorage)
+            {
+                // The conductivities are already in the table; only the orientation is stored here
+                if (this->mUseFibreOrientation)
+                {
+                    AppendCompactOrientation(orientation_matrix);
+                }
+            }
+            else
+            {
+                c_matrix<double,SPACE_DIM,SPACE_DIM> temp;
+                noalias(temp) = prod(orientation_matrix, conductivity_matrix);
+                this->mTensors.push_back( prod(temp, trans(orientation_matrix) ) );
+            }
 
             local_element_index++;
         }
-        assert(this->mTensors.size() == this->mpMesh->GetNumLocalElements());
-        assert(this->mTensors.size() == local_element_index);
+        assert(local_element_index == this->mpMesh->GetNumLocalElements());
+        assert(this->mUseCompactStorage || this->mTensors.size() == local_element_index);
 
         if (this->mUseFibreOrientation)
         {
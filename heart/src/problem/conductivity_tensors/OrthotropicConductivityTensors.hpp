@@ -59,6 +59,25 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 class OrthotropicConductivityTensors : public AbstractConductivityTensors<ELEMENT_DIM, SPACE_DIM>
 {
+private:
+
+    /**
+     * Append the compact form of an element's fibre orientation to mCompactOrientations:
+     * nothing in 1D (the tensor does not depend on the direction's sign), the fibre angle
+     * in 2D and a unit quaternion in 3D.
+     *
+     * @param rOrientation  the orientation matrix, whose columns are the fibre, sheet and normal directions
+     */
+    void AppendCompactOrientation(const c_matrix<double,SPACE_DIM,SPACE_DIM>& rOrientation);
+
+    /**
+     * Reconstruct the tensor of a local element from the compact representation.
+     *
+     * @param localIndex  local index of the element
+     * @param rTensor  filled in with the tensor
+     */
+    void ReconstructTensor(unsigned localIndex, c_matrix<double,SPACE_DIM,SPACE_DIM>& rTensor) const;
+
 public:
 
     /**
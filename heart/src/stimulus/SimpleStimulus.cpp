@@ -80,6 +80,11 @@ void SimpleStimulus::SetStartTime(double startTime)
     mTimeOfStimulus = startTime;
 }
 
+double SimpleStimulus::GetStartTime()
+{
+    return mTimeOfStimulus;
+}
+
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
 CHASTE_CLASS_EXPORT(SimpleStimulus)
@@ -108,6 +108,11 @@ public:
      * @param startTime
      */
     void SetStartTime(double startTime);
+
+    /**
+     * @return the time at which the stimulus starts.
+     */
+    double GetStartTime();
 };
 
 
@@ -189,7 +189,7 @@ AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::AbstractCardiacTissue(AbstractTetr
     mIionicCacheReplicated.Resize(mpDistributedVectorFactory->GetProblemSize());
     mIntracellularStimulusCacheReplicated.Resize(mpDistributedVectorFactory->GetProblemSize());
 
-    mFibreFilePathNoExtension = ArchiveLocationInfo::GetArchiveDirectory() + ArchiveLocationInfo::GetMeshFilename();
+    mFibreFilePathNoExtension = ArchiveLocationInfo::GetMeshDirectory() + ArchiveLocationInfo::GetMeshFilename();
     CreateIntracellularConductivityTensor();
 }
 
@@ -344,6 +344,7 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::CreateIntracellularConductivi
         mpIntracellularConductivityTensors->SetConstantConductivities(intra_conductivities);
     }
 
+    mpIntracellularConductivityTensors->SetUseCompactStorage(mpConfig->GetUseCompactConductivityTensors());
     mpIntracellularConductivityTensors->Init(this->mpMesh);
     HeartEventHandler::EndEvent(HeartEventHandler::READ_MESH);
 }
@@ -562,10 +563,17 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SolveCellSystems(Vec existing
 
                 throw e;
             }
-            // update the Iionic and stimulus caches
-            UpdateCaches(index.Global, index.Local, nextTime);
+            // update the Iionic cache (the stimulus cache is updated below, for stimulated cells only)
+            mIionicCacheReplicated[index.Global] = mCellsDistributed[index.Local]->GetIIonic();
         }
 
+        if (!mIntracellularStimulusScheduler.IsUpToDate())
+        {
+            mIntracellularStimulusScheduler.Build(mCellsDistributed, mpDistributedVectorFactory->GetLow(),
+                                                  mIntracellularStimulusCacheReplicated);
+        }
+        mIntracellularStimulusScheduler.UpdateCache(nextTime, mIntracellularStimulusCacheReplicated);
+
         if (updateVoltage)
         {
             dist_solution.Restore();
@@ -719,6 +727,12 @@ ReplicatableVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetPurkinjeIi
     return mPurkinjeIionicCacheReplicated;
 }
 
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+const IntracellularStimulusScheduler& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetIntracellularStimulusScheduler() const
+{
+    return mIntracellularStimulusScheduler;
+}
+
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
 ReplicatableVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetPurkinjeIntracellularStimulusCacheReplicated()
 {
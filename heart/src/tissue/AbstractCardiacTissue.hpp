@@ -56,6 +56,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractConductivityTensors.hpp"
 #include "AbstractPurkinjeCellFactory.hpp"
 #include "ReplicatableVector.hpp"
+#include "IntracellularStimulusScheduler.hpp"
 #include "HeartConfig.hpp"
 #include "ArchiveLocationInfo.hpp"
 #include "AbstractDynamicallyLoadableEntity.hpp"
@@ -114,9 +115,12 @@ private:
                 {
                     FileFinder source_file(mFibreFilePathNoExtension + ".ortho", RelativeTo::AbsoluteOrCwd);
                     assert(source_file.Exists());
-                    FileFinder dest_file(ArchiveLocationInfo::GetArchiveRelativePath() + ArchiveLocationInfo::GetMeshFilename() + ".ortho", RelativeTo::ChasteTestOutput);
+                    FileFinder dest_file(ArchiveLocationInfo::GetMeshRelativePath() + ArchiveLocationInfo::GetMeshFilename() + ".ortho", RelativeTo::ChasteTestOutput);
 
-                    TRY_IF_MASTER(source_file.CopyTo(dest_file));
+                    if (!ArchiveLocationInfo::IsSharedMeshWritten())
+                    {
+                        TRY_IF_MASTER(source_file.CopyTo(dest_file));
+                    }
                     break;
                 }
 
@@ -124,10 +128,13 @@ private:
                 {
                     FileFinder source_file(mFibreFilePathNoExtension + ".axi", RelativeTo::AbsoluteOrCwd);
                     assert(source_file.Exists());
-                    FileFinder dest_file(ArchiveLocationInfo::GetArchiveRelativePath()
+                    FileFinder dest_file(ArchiveLocationInfo::GetMeshRelativePath()
                                        + ArchiveLocationInfo::GetMeshFilename() + ".axi", RelativeTo::ChasteTestOutput);
 
-                    TRY_IF_MASTER(source_file.CopyTo(dest_file));
+                    if (!ArchiveLocationInfo::IsSharedMeshWritten())
+                    {
+                        TRY_IF_MASTER(source_file.CopyTo(dest_file));
+                    }
                     break;
                 }
 
@@ -313,6 +320,13 @@ protected:
      */
     bool mExchangeHalos;
 
+    /**
+     * Index of the local cells with a non-zero stimulus, used by SolveCellSystems() to
+     * update #mIntracellularStimulusCacheReplicated. Not archived; it is rebuilt on the
+     * first solve, and whenever a cell has its stimulus function replaced.
+     */
+    IntracellularStimulusScheduler mIntracellularStimulusScheduler;
+
     /** Vector of halo node indices for current process */
     std::vector<unsigned> mHaloNodes;
 
@@ -452,6 +466,12 @@ public:
     /** @return the entire stimulus current cache */
     ReplicatableVector& rGetIntracellularStimulusCacheReplicated();
 
+    /**
+     * @return the index of stimulated cells used to update the stimulus current cache.
+     * It is only built by the first call to SolveCellSystems().
+     */
+    const IntracellularStimulusScheduler& rGetIntracellularStimulusScheduler() const;
+
     /** @return the entire Purkinje ionic current cache */
     ReplicatableVector& rGetPurkinjeIionicCacheReplicated();
 
@@ -160,6 +160,7 @@ void BidomainTissue<SPACE_DIM>::CreateExtracellularConductivityTensors()
         mpExtracellularConductivityTensors->SetConstantConductivities(extra_conductivities);
     }
 
+    mpExtracellularConductivityTensors->SetUseCompactStorage(this->mpConfig->GetUseCompactConductivityTensors());
     mpExtracellularConductivityTensors->Init(this->mpMesh);
 }
 
@@ -295,6 +295,7 @@ void ExtendedBidomainTissue<SPACE_DIM>::CreateIntracellularConductivityTensorSec
         mpIntracellularConductivityTensorsSecondCell->SetConstantConductivities(mIntracellularConductivitiesSecondCell);
     }
 
+    mpIntracellularConductivityTensorsSecondCell->SetUseCompactStorage(this->mpConfig->GetUseCompactConductivityTensors());
     mpIntracellularConductivityTensorsSecondCell->Init(this->mpMesh);
     HeartEventHandler::EndEvent(HeartEventHandler::READ_MESH);
 }
@@ -431,6 +432,7 @@ void ExtendedBidomainTissue<SPACE_DIM>::CreateExtracellularConductivityTensors()
     {
         mpExtracellularConductivityTensors->SetConstantConductivities(extra_conductivities);
     }
+    mpExtracellularConductivityTensors->SetUseCompactStorage(this->mpConfig->GetUseCompactConductivityTensors());
     mpExtracellularConductivityTensors->Init(this->mpMesh);
 }
 
@@ -0,0 +1,134 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "IntracellularStimulusScheduler.hpp"
+
+#include <map>
+#include <typeinfo>
+
+#include "Exception.hpp"
+#include "ZeroStimulus.hpp"
+
+IntracellularStimulusScheduler::IntracellularStimulusScheduler()
+    : mIsBuilt(false),
+      mStimulusChangeCounter(0u),
+      mNumStimulatedCells(0u),
+      mNumEntriesUpdated(0u)
+{
+}
+
+void IntracellularStimulusScheduler::Build(const std::vector<AbstractCardiacCellInterface*>& rCells,
+                                           unsigned lo,
+                                           ReplicatableVector& rCache)
+{
+    mGroups.clear();
+    mNumStimulatedCells = 0u;
+    mNumEntriesUpdated = 0u;
+
+    std::map<AbstractStimulusFunction*, unsigned> group_of_stimulus;
+    for (unsigned local_index=0; local_index<rCells.size(); local_index++)
+    {
+        unsigned global_index = lo + local_index;
+        boost::shared_ptr<AbstractStimulusFunction> p_stimulus = rCells[local_index]->GetStimulusFunction();
+        assert(p_stimulus);
+
+        // Subclasses of ZeroStimulus may override GetStimulus(), so only the exact type is skipped
+        if (typeid(*p_stimulus) == typeid(ZeroStimulus))
+        {
+            rCache[global_index] = 0.0;
+            continue;
+        }
+
+        std::map<AbstractStimulusFunction*, unsigned>::iterator it = group_of_stimulus.find(p_stimulus.get());
+        if (it == group_of_stimulus.end())
+        {
+            it = group_of_stimulus.insert(std::make_pair(p_stimulus.get(), mGroups.size())).first;
+            mGroups.push_back(StimulusGroup());
+            mGroups.back().mpStimulus = p_stimulus;
+        }
+        mGroups[it->second].mGlobalIndices.push_back(global_index);
+        mNumStimulatedCells++;
+    }
+
+    // Force every group to be written at the next update
+    for (unsigned group=0; group<mGroups.size(); group++)
+    {
+        mGroups[group].mLastValue = DOUBLE_UNSET;
+    }
+
+    mStimulusChangeCounter = AbstractCardiacCellInterface::GetStimulusChangeCounter();
+    mIsBuilt = true;
+}
+
+bool IntracellularStimulusScheduler::IsUpToDate() const
+{
+    return mIsBuilt && mStimulusChangeCounter == AbstractCardiacCellInterface::GetStimulusChangeCounter();
+}
+
+void IntracellularStimulusScheduler::UpdateCache(double time, ReplicatableVector& rCache)
+{
+    assert(mIsBuilt);
+    mNumEntriesUpdated = 0u;
+    for (std::vector<StimulusGroup>::iterator it = mGroups.begin(); it != mGroups.end(); ++it)
+    {
+        double value = it->mpStimulus->GetStimulus(time);
+        if (value != it->mLastValue)
+        {
+            for (std::vector<unsigned>::const_iterator index = it->mGlobalIndices.begin();
+                 index != it->mGlobalIndices.end();
+                 ++index)
+            {
+                rCache[*index] = value;
+            }
+            it->mLastValue = value;
+            mNumEntriesUpdated += it->mGlobalIndices.size();
+        }
+    }
+}
+
+unsigned IntracellularStimulusScheduler::GetNumStimulusGroups() const
+{
+    return mGroups.size();
+}
+
+unsigned IntracellularStimulusScheduler::GetNumStimulatedCells() const
+{
+    return mNumStimulatedCells;
+}
+
+unsigned IntracellularStimulusScheduler::GetNumEntriesUpdated() const
+{
+    return mNumEntriesUpdated;
+}
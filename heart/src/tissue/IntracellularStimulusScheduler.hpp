@@ -0,0 +1,145 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef INTRACELLULARSTIMULUSSCHEDULER_HPP_
+#define INTRACELLULARSTIMULUSSCHEDULER_HPP_
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+
+#include "AbstractCardiacCellInterface.hpp"
+#include "AbstractStimulusFunction.hpp"
+#include "ReplicatableVector.hpp"
+
+/**
+ * Keeps the intracellular stimulus cache of a cardiac tissue up to date without
+ * evaluating the stimulus of every cell at every time step.
+ *
+ * The local cells are indexed once, by the stimulus function they hold. Cells with a
+ * ZeroStimulus are dropped from the index (their cache entries are set to zero when
+ * the index is built), and cells sharing a stimulus function are put in a single group,
+ * so that each distinct function is evaluated only once per step. A group's cache
+ * entries are only written when the value of its stimulus changes, which for pulse-like
+ * stimuli (RegularStimulus, S1S2Stimulus, MultiStimulus, ...) only happens at the edges
+ * of each stimulus window.
+ *
+ * The cost of a step is therefore proportional to the number of distinct non-zero
+ * stimulus functions plus the number of cells whose stimulus switches on or off,
+ * rather than to the number of nodes.
+ *
+ * The index is invalidated whenever the stimulus function of any cardiac cell is
+ * replaced (see AbstractCardiacCellInterface::GetStimulusChangeCounter()), and must
+ * then be rebuilt. Changing the parameters of a stimulus function in place does not
+ * invalidate it, since every group is evaluated at every step.
+ */
+class IntracellularStimulusScheduler
+{
+private:
+
+    /** A set of cells sharing a single non-zero stimulus function. */
+    struct StimulusGroup
+    {
+        /** The stimulus function held by all the cells in the group. */
+        boost::shared_ptr<AbstractStimulusFunction> mpStimulus;
+
+        /** Global indices of the cells in the group. */
+        std::vector<unsigned> mGlobalIndices;
+
+        /** The value of the stimulus last written to the cache. */
+        double mLastValue;
+    };
+
+    /** The groups of stimulated cells. */
+    std::vector<StimulusGroup> mGroups;
+
+    /** Whether the index has been built. */
+    bool mIsBuilt;
+
+    /** Value of AbstractCardiacCellInterface::GetStimulusChangeCounter() when the index was built. */
+    unsigned mStimulusChangeCounter;
+
+    /** The number of local cells whose stimulus is not a ZeroStimulus. */
+    unsigned mNumStimulatedCells;
+
+    /** The number of cache entries written by the last call to UpdateCache(). */
+    unsigned mNumEntriesUpdated;
+
+public:
+
+    /**
+     * Constructor. The index must be built with Build() before use.
+     */
+    IntracellularStimulusScheduler();
+
+    /**
+     * Index the local cells by stimulus function, and set the cache entries of the
+     * cells with a ZeroStimulus to zero.
+     *
+     * The other cache entries are written by the next call to UpdateCache().
+     *
+     * @param rCells  the local cells of the tissue
+     * @param lo  global index of the first local cell
+     * @param rCache  the stimulus cache, indexed by global node index
+     */
+    void Build(const std::vector<AbstractCardiacCellInterface*>& rCells,
+               unsigned lo,
+               ReplicatableVector& rCache);
+
+    /**
+     * @return whether the index has been built, and no cell has had its stimulus
+     * function replaced since.
+     */
+    bool IsUpToDate() const;
+
+    /**
+     * Evaluate the stimulus of each group and write it to the cache entries of the
+     * group, if it differs from the value written at the previous call.
+     *
+     * @param time  the time at which to evaluate the stimuli
+     * @param rCache  the stimulus cache passed to Build()
+     */
+    void UpdateCache(double time, ReplicatableVector& rCache);
+
+    /** @return the number of distinct non-zero stimulus functions held by the local cells. */
+    unsigned GetNumStimulusGroups() const;
+
+    /** @return the number of local cells whose stimulus is not a ZeroStimulus. */
+    unsigned GetNumStimulatedCells() const;
+
+    /** @return the number of cache entries written by the last call to UpdateCache(). */
+    unsigned GetNumEntriesUpdated() const;
+};
+
+#endif /*INTRACELLULARSTIMULUSSCHEDULER_HPP_*/
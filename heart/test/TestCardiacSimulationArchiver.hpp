@@ -40,6 +40,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "CheckpointArchiveTypes.hpp" // Needs to be before other Chaste code
 #include "CardiacSimulationArchiver.hpp"
+#include "ArchiveLocationInfo.hpp"
 
 #include "Exception.hpp"
 #include "DistributedVector.hpp"
@@ -263,6 +264,152 @@ public:
         }
     }
 
+    void TestArchivingWithHelperClassBinary()
+    {
+        std::string archive_dir("bidomain_problem_archive_helper_binary");
+
+        // Save using binary archives
+        {
+            HeartConfig::Instance()->SetIntracellularConductivities(Create_c_vector(0.0005));
+            HeartConfig::Instance()->SetExtracellularConductivities(Create_c_vector(0.0005));
+            HeartConfig::Instance()->SetMeshFileName("mesh/test/data/1D_0_to_1mm_10_elements");
+            HeartConfig::Instance()->SetOutputDirectory("BiProblemArchiveHelperBinary");
+            HeartConfig::Instance()->SetOutputFilenamePrefix("BidomainLR91_1d");
+            HeartConfig::Instance()->SetSurfaceAreaToVolumeRatio(1.0);
+            HeartConfig::Instance()->SetCapacitance(1.0);
+            HeartConfig::Instance()->SetOdePdeAndPrintingTimeSteps(0.01, 0.01, 0.1);
+
+            PlaneStimulusCellFactory<CellLuoRudy1991FromCellML, 1> cell_factory;
+            BidomainProblem<1> bidomain_problem( &cell_factory );
+
+            bidomain_problem.Initialise();
+            HeartConfig::Instance()->SetSimulationDuration(1.0); //ms
+            bidomain_problem.Solve();
+
+            CardiacSimulationArchiver<BidomainProblem<1> >::Save(bidomain_problem, archive_dir, true, true);
+        }
+
+        // The format is recorded in the info file and the archives really are binary
+        FileFinder info_file(archive_dir + "/archive.info", RelativeTo::ChasteTestOutput);
+        std::ifstream info_stream(info_file.GetAbsolutePath().c_str());
+        unsigned num_procs, archive_version;
+        std::string archive_format;
+        info_stream >> num_procs >> archive_version >> archive_format;
+        TS_ASSERT_EQUALS(num_procs, PetscTools::GetNumProcs());
+        TS_ASSERT_EQUALS(archive_format, "binary");
+        FileFinder main_archive(archive_dir + "/archive.arch", RelativeTo::ChasteTestOutput);
+        TS_ASSERT(ArchiveLocationInfo::IsBinaryArchiveFile(main_archive));
+
+        // Load and run; the results should match the text archive round trip exactly
+        {
+            BidomainProblem<1>* p_bidomain_problem = CardiacSimulationArchiver<BidomainProblem<1> >::Load(archive_dir);
+
+            HeartConfig::Instance()->SetSimulationDuration(2.0); //ms
+            p_bidomain_problem->Solve();
+
+            ReplicatableVector solution_replicated(p_bidomain_problem->GetSolution());
+            TS_ASSERT_EQUALS(solution_replicated.GetSize(), mSolutionReplicated1d2ms.size());
+            for (unsigned index=0; index<solution_replicated.GetSize(); index++)
+            {
+                TS_ASSERT_DELTA(solution_replicated[index], mSolutionReplicated1d2ms[index], 5e-11);
+            }
+
+            delete p_bidomain_problem;
+        }
+    }
+
+    void TestIncrementalCheckpoints()
+    {
+        std::string series_dir("bidomain_problem_incremental_checkpoints");
+
+        // Save a series of checkpoints, keeping only the last two
+        {
+            HeartConfig::Instance()->SetIntracellularConductivities(Create_c_vector(0.0005));
+            HeartConfig::Instance()->SetExtracellularConductivities(Create_c_vector(0.0005));
+            HeartConfig::Instance()->SetMeshFileName("mesh/test/data/1D_0_to_1mm_10_elements");
+            HeartConfig::Instance()->SetOutputDirectory("BiProblemIncrementalCheckpoints");
+            HeartConfig::Instance()->SetOutputFilenamePrefix("BidomainLR91_1d");
+            HeartConfig::Instance()->SetSurfaceAreaToVolumeRatio(1.0);
+            HeartConfig::Instance()->SetCapacitance(1.0);
+            HeartConfig::Instance()->SetOdePdeAndPrintingTimeSteps(0.01, 0.01, 0.1);
+
+            PlaneStimulusCellFactory<CellLuoRudy1991FromCellML, 1> cell_factory;
+            BidomainProblem<1> bidomain_problem( &cell_factory );
+            bidomain_problem.Initialise();
+
+            // Clear out any series left by a previous run of this test
+            OutputFileHandler series_handler(series_dir);
+
+            double end_times[3] = {1.0, 1.5, 2.0};
+            for (unsigned i=0; i<3; i++)
+            {
+                HeartConfig::Instance()->SetSimulationDuration(end_times[i]); //ms
+                bidomain_problem.Solve();
+                CardiacSimulationArchiver<BidomainProblem<1> >::SaveIncremental(bidomain_problem, series_dir, 2u);
+            }
+            TS_ASSERT_THROWS_THIS(CardiacSimulationArchiver<BidomainProblem<1> >::SaveIncremental(bidomain_problem, series_dir, 0u),
+                                  "At least one incremental checkpoint must be kept on disk");
+        }
+
+        std::vector<double> times = CardiacSimulationArchiver<BidomainProblem<1> >::GetIncrementalCheckpointTimes(series_dir);
+        TS_ASSERT_EQUALS(times.size(), 2u);
+        TS_ASSERT_DELTA(times[0], 1.5, 1e-12);
+        TS_ASSERT_DELTA(times[1], 2.0, 1e-12);
+
+        // The mesh is stored once, and not with each checkpoint
+        TS_ASSERT(FileFinder(series_dir + "/mesh/mesh.node", RelativeTo::ChasteTestOutput).Exists());
+        TS_ASSERT(!FileFinder(series_dir + "/checkpoint_2ms/mesh.node", RelativeTo::ChasteTestOutput).Exists());
+        TS_ASSERT(!FileFinder(series_dir + "/checkpoint_1ms", RelativeTo::ChasteTestOutput).Exists());
+        TS_ASSERT(FileFinder(series_dir + "/checkpoint_2ms/archive.arch", RelativeTo::ChasteTestOutput).Exists());
+
+        // Resume from the earlier checkpoint, and check we get the same answer as an uninterrupted run
+        {
+            OutputFileHandler handler("BiProblemIncrementalCheckpoints_resumed");
+            BidomainProblem<1>* p_bidomain_problem = CardiacSimulationArchiver<BidomainProblem<1> >::LoadIncremental(series_dir, 1.5);
+            TS_ASSERT_DELTA(p_bidomain_problem->GetCurrentTime(), 1.5, 1e-12);
+
+            HeartConfig::Instance()->SetSimulationDuration(2.0); //ms
+            HeartConfig::Instance()->SetOutputDirectory("BiProblemIncrementalCheckpoints_resumed");
+            p_bidomain_problem->Solve();
+
+            ReplicatableVector solution_replicated(p_bidomain_problem->GetSolution());
+            TS_ASSERT_EQUALS(solution_replicated.GetSize(), mSolutionReplicated1d2ms.size());
+            for (unsigned index=0; index<solution_replicated.GetSize(); index++)
+            {
+                TS_ASSERT_DELTA(solution_replicated[index], mSolutionReplicated1d2ms[index], 5e-11);
+            }
+
+            // Overwrite the 2ms checkpoint from the resumed run.  The shared mesh is already there, so no
+            // process writes it again (this test is in the parallel test pack, so all processes must agree).
+            std::string checkpoint_dir = CardiacSimulationArchiver<BidomainProblem<1> >::SaveIncremental(*p_bidomain_problem, series_dir, 2u);
+            TS_ASSERT_EQUALS(checkpoint_dir, series_dir + "/checkpoint_2ms");
+            delete p_bidomain_problem;
+
+            std::vector<double> resumed_times = CardiacSimulationArchiver<BidomainProblem<1> >::GetIncrementalCheckpointTimes(series_dir);
+            TS_ASSERT_EQUALS(resumed_times.size(), 2u);
+            TS_ASSERT_DELTA(resumed_times[0], 1.5, 1e-12);
+            TS_ASSERT_DELTA(resumed_times[1], 2.0, 1e-12);
+            TS_ASSERT(FileFinder(series_dir + "/mesh/mesh.node", RelativeTo::ChasteTestOutput).Exists());
+            TS_ASSERT(!FileFinder(series_dir + "/checkpoint_2ms/mesh.node", RelativeTo::ChasteTestOutput).Exists());
+        }
+
+        // The latest checkpoint is loaded by default, and can also be loaded directly by folder
+        {
+            BidomainProblem<1>* p_bidomain_problem = CardiacSimulationArchiver<BidomainProblem<1> >::LoadIncremental(series_dir);
+            TS_ASSERT_DELTA(p_bidomain_problem->GetCurrentTime(), 2.0, 1e-12);
+            delete p_bidomain_problem;
+
+            p_bidomain_problem = CardiacSimulationArchiver<BidomainProblem<1> >::Load(series_dir + "/checkpoint_2ms");
+            TS_ASSERT_DELTA(p_bidomain_problem->GetCurrentTime(), 2.0, 1e-12);
+            delete p_bidomain_problem;
+        }
+
+        TS_ASSERT_THROWS_THIS(CardiacSimulationArchiver<BidomainProblem<1> >::LoadIncremental(series_dir, 1.0),
+                              "No incremental checkpoint checkpoint_1ms in " + series_dir);
+        TS_ASSERT_THROWS_THIS(CardiacSimulationArchiver<BidomainProblem<1> >::LoadIncremental("absent_series"),
+                              "No incremental checkpoints found in absent_series");
+    }
+
     /**
      *  Test used to generate data for the acceptance test resume_bidomain. We run the same simulation as in save_bidomain
      *  and archive it. resume_bidomain will load it and resume the simulation.
@@ -435,6 +435,155 @@ public:
         }
     }
 
+    void TestCompactStorage()
+    {
+        // Orthotropic and axisymmetric fibres on a real geometry
+        {
+            TetrahedralMesh<3,3> mesh;
+            TrianglesMeshReader<3,3> mesh_reader("heart/test/data/box_shaped_heart/box_heart");
+            mesh.ConstructFromMeshReader(mesh_reader);
+
+            c_vector<double, 3> constant_conductivities(Create_c_vector(7.0,3.5,1.75));
+            FileFinder ortho_file("heart/test/data/box_shaped_heart/box_heart.ortho", RelativeTo::ChasteSourceRoot);
+
+            OrthotropicConductivityTensors<3,3> ortho_tensors;
+            ortho_tensors.SetConstantConductivities(constant_conductivities);
+            ortho_tensors.SetFibreOrientationFile(ortho_file);
+            ortho_tensors.Init(&mesh);
+
+            OrthotropicConductivityTensors<3,3> compact_ortho_tensors;
+            compact_ortho_tensors.SetConstantConductivities(constant_conductivities);
+            compact_ortho_tensors.SetFibreOrientationFile(ortho_file);
+            compact_ortho_tensors.SetUseCompactStorage();
+            compact_ortho_tensors.Init(&mesh);
+
+            c_vector<double, 3> axi_conductivities(Create_c_vector(7.0,3.5,3.5));
+            FileFinder axi_file("heart/test/data/box_shaped_heart/box_heart.axi", RelativeTo::ChasteSourceRoot);
+
+            AxisymmetricConductivityTensors<3,3> axi_tensors;
+            axi_tensors.SetConstantConductivities(axi_conductivities);
+            axi_tensors.SetFibreOrientationFile(axi_file);
+            axi_tensors.Init(&mesh);
+
+            AxisymmetricConductivityTensors<3,3> compact_axi_tensors;
+            compact_axi_tensors.SetConstantConductivities(axi_conductivities);
+            compact_axi_tensors.SetFibreOrientationFile(axi_file);
+            compact_axi_tensors.SetUseCompactStorage();
+            compact_axi_tensors.Init(&mesh);
+
+            // Fibre directions are stored in single precision
+            double tol = 1e-5;
+            for (unsigned element_index=0; element_index<mesh.GetNumElements(); element_index++)
+            {
+                for (unsigned i=0; i<3; i++)
+                {
+                    for (unsigned j=0; j<3; j++)
+                    {
+                        TS_ASSERT_DELTA(compact_ortho_tensors[element_index](i,j), ortho_tensors[element_index](i,j), tol);
+                        TS_ASSERT_DELTA(compact_axi_tensors[element_index](i,j), axi_tensors[element_index](i,j), tol);
+                    }
+                }
+            }
+        }
+
+        // Heterogeneous conductivities (a few distinct sets) with fibres varying element by element
+        {
+            DistributedTetrahedralMesh<3,3> mesh;
+            mesh.ConstructCuboid(1,1,5);
+            std::vector<c_vector<double, 3> > non_constant_conductivities;
+
+            for (AbstractTetrahedralMesh<3,3>::ElementIterator it = mesh.GetElementIteratorBegin();
+                 it != mesh.GetElementIteratorEnd();
+                 ++it)
+            {
+                unsigned element_index = it->GetIndex();
+                non_constant_conductivities.push_back((element_index%3)*Create_c_vector(100,10,1));
+            }
+
+            FileFinder file("heart/test/data/fibre_tests/NonTrivialOrthotropic3D.ortho", RelativeTo::ChasteSourceRoot);
+
+            OrthotropicConductivityTensors<3,3> ortho_tensors;
+            ortho_tensors.SetNonConstantConductivities(&non_constant_conductivities);
+            ortho_tensors.SetFibreOrientationFile(file);
+            ortho_tensors.Init(&mesh);
+
+            OrthotropicConductivityTensors<3,3> compact_ortho_tensors;
+            compact_ortho_tensors.SetNonConstantConductivities(&non_constant_conductivities);
+            compact_ortho_tensors.SetFibreOrientationFile(file);
+            compact_ortho_tensors.SetUseCompactStorage();
+            compact_ortho_tensors.Init(&mesh);
+
+            for (AbstractTetrahedralMesh<3,3>::ElementIterator it = mesh.GetElementIteratorBegin();
+                 it != mesh.GetElementIteratorEnd();
+                 ++it)
+            {
+                unsigned element_index = it->GetIndex();
+                for (unsigned i=0; i<3; i++)
+                {
+                    for (unsigned j=0; j<3; j++)
+                    {
+                        TS_ASSERT_DELTA(compact_ortho_tensors[element_index](i,j), ortho_tensors[element_index](i,j), 1e-3);
+                    }
+                }
+            }
+        }
+
+        // 2D fibres, stored as a single angle
+        {
+            TetrahedralMesh<2,2> mesh;
+            mesh.ConstructRectangularMesh(1,3);
+
+            std::vector<c_vector<double, 2> > non_constant_conductivities;
+            for (unsigned element_index=0; element_index<mesh.GetNumElements(); element_index++)
+            {
+                non_constant_conductivities.push_back(Create_c_vector(100.0*element_index, 10.0*element_index));
+            }
+
+            OrthotropicConductivityTensors<2,2> compact_ortho_tensors;
+            compact_ortho_tensors.SetNonConstantConductivities(&non_constant_conductivities);
+            FileFinder file("heart/test/data/fibre_tests/SimpleOrthotropic2D.ortho", RelativeTo::ChasteSourceRoot);
+            compact_ortho_tensors.SetFibreOrientationFile(file);
+            compact_ortho_tensors.SetUseCompactStorage();
+            compact_ortho_tensors.Init(&mesh);
+
+            for (unsigned tensor_index=0; tensor_index<6; tensor_index++)
+            {
+                TS_ASSERT_DELTA(compact_ortho_tensors[tensor_index](0,0), 100.0*tensor_index, 1e-12);
+                TS_ASSERT_DELTA(compact_ortho_tensors[tensor_index](0,1), 0.0, 1e-12);
+                TS_ASSERT_DELTA(compact_ortho_tensors[tensor_index](1,0), 0.0, 1e-12);
+                TS_ASSERT_DELTA(compact_ortho_tensors[tensor_index](1,1), 10.0*tensor_index, 1e-12);
+            }
+
+            // Fibres at a different angle in each element (one with a left-handed frame) match full storage
+            FileFinder rotated_file("heart/test/data/fibre_tests/RotatedOrthotropic2D.ortho", RelativeTo::ChasteSourceRoot);
+
+            OrthotropicConductivityTensors<2,2> rotated_tensors;
+            rotated_tensors.SetNonConstantConductivities(&non_constant_conductivities);
+            rotated_tensors.SetFibreOrientationFile(rotated_file);
+            rotated_tensors.Init(&mesh);
+
+            OrthotropicConductivityTensors<2,2> compact_rotated_tensors;
+            compact_rotated_tensors.SetNonConstantConductivities(&non_constant_conductivities);
+            compact_rotated_tensors.SetFibreOrientationFile(rotated_file);
+            compact_rotated_tensors.SetUseCompactStorage();
+            compact_rotated_tensors.Init(&mesh);
+
+            for (unsigned tensor_index=0; tensor_index<6; tensor_index++)
+            {
+                for (unsigned i=0; i<2; i++)
+                {
+                    for (unsigned j=0; j<2; j++)
+                    {
+                        TS_ASSERT_DELTA(compact_rotated_tensors[tensor_index](i,j), rotated_tensors[tensor_index](i,j), 1e-3);
+                    }
+                }
+            }
+
+            // The tensors really are rotated, i.e. this is not just the axis-aligned case again
+            TS_ASSERT_LESS_THAN(1.0, fabs(rotated_tensors[1](0,1)));
+        }
+    }
+
     void TestHeterogeneousCondPlusFibreOrientationTensor3DDistributedTetrahedralMesh()
     {
         DistributedTetrahedralMesh<3,3> mesh;
@@ -0,0 +1,308 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTEIKONALACTIVATIONSOLVER_HPP_
+#define TESTEIKONALACTIVATIONSOLVER_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <fstream>
+#include "UblasCustomFunctions.hpp"
+#include "EikonalActivationSolver.hpp"
+#include "OrthotropicConductivityTensors.hpp"
+#include "MonodomainProblem.hpp"
+#include "HeartConfigRelatedCellFactory.hpp"
+#include "SimpleStimulus.hpp"
+#include "TetrahedralMesh.hpp"
+#include "DistributedTetrahedralMesh.hpp"
+#include "HeartConfig.hpp"
+#include "OutputFileHandler.hpp"
+#include "PetscTools.hpp"
+#include "PetscSetupAndFinalize.hpp"
+
+class TestEikonalActivationSolver : public CxxTest::TestSuite
+{
+public:
+    void TestPlanarWaves2d()
+    {
+        TetrahedralMesh<2,2> mesh;
+        mesh.ConstructRegularSlabMesh(0.1, 1.0, 1.0);
+
+        // Isotropic, speed theta*sqrt(sigma) = 2: the exact solution is linear, so is reproduced exactly
+        {
+            OrthotropicConductivityTensors<2,2> tensors;
+            tensors.SetConstantConductivities(Create_c_vector(1.0, 1.0));
+            tensors.Init(&mesh);
+
+            EikonalActivationSolver<2,2> solver(mesh, tensors, 2.0);
+            for (unsigned node_index=0; node_index<mesh.GetNumNodes(); node_index++)
+            {
+                if (fabs(mesh.GetNode(node_index)->rGetLocation()[0]) < 1e-12)
+                {
+                    solver.AddStimulusSite(node_index, 1.0);
+                }
+            }
+            solver.Solve();
+
+            const std::vector<double>& r_times = solver.rGetActivationTimes();
+            TS_ASSERT_EQUALS(r_times.size(), mesh.GetNumNodes());
+            for (unsigned node_index=0; node_index<mesh.GetNumNodes(); node_index++)
+            {
+                TS_ASSERT_DELTA(r_times[node_index], 1.0 + 0.5*mesh.GetNode(node_index)->rGetLocation()[0], 1e-12);
+            }
+        }
+
+        // Anisotropic: twice as fast along the fibres (x) as across them
+        {
+            OrthotropicConductivityTensors<2,2> tensors;
+            tensors.SetConstantConductivities(Create_c_vector(4.0, 1.0));
+            tensors.Init(&mesh);
+
+            EikonalActivationSolver<2,2> solver_along(mesh, tensors, 1.0);
+            EikonalActivationSolver<2,2> solver_across(mesh, tensors, 1.0);
+            for (unsigned node_index=0; node_index<mesh.GetNumNodes(); node_index++)
+            {
+                const c_vector<double, 2>& r_location = mesh.GetNode(node_index)->rGetLocation();
+                if (fabs(r_location[0]) < 1e-12)
+                {
+                    solver_along.AddStimulusSite(node_index);
+                }
+                if (fabs(r_location[1]) < 1e-12)
+                {
+                    solver_across.AddStimulusSite(node_index);
+                }
+            }
+            solver_along.Solve();
+            solver_across.Solve();
+
+            for (unsigned node_index=0; node_index<mesh.GetNumNodes(); node_index++)
+            {
+                const c_vector<double, 2>& r_location = mesh.GetNode(node_index)->rGetLocation();
+                TS_ASSERT_DELTA(solver_along.rGetActivationTimes()[node_index], 0.5*r_location[0], 1e-12);
+                TS_ASSERT_DELTA(solver_across.rGetActivationTimes()[node_index], r_location[1], 1e-12);
+            }
+        }
+    }
+
+    void TestPointSource3d()
+    {
+        TetrahedralMesh<3,3> mesh;
+        mesh.ConstructRegularSlabMesh(0.1, 1.0, 1.0, 1.0);
+        TS_ASSERT_DELTA(norm_2(mesh.GetNode(0)->rGetLocation()), 0.0, 1e-12);
+
+        OrthotropicConductivityTensors<3,3> tensors;
+        tensors.SetConstantConductivities(Create_c_vector(1.0, 1.0, 1.0));
+        tensors.Init(&mesh);
+
+        EikonalActivationSolver<3,3> solver(mesh, tensors, 1.0);
+        solver.AddStimulusSite(0u);
+        solver.Solve();
+
+        // Interpolating the curved front over faces only ever overestimates the distance from the corner
+        const std::vector<double>& r_times = solver.rGetActivationTimes();
+        for (unsigned node_index=0; node_index<mesh.GetNumNodes(); node_index++)
+        {
+            double distance = norm_2(mesh.GetNode(node_index)->rGetLocation());
+            TS_ASSERT_LESS_THAN_EQUALS(distance - 1e-12, r_times[node_index]);
+            TS_ASSERT_LESS_THAN(r_times[node_index], distance + 0.1);
+
+            // Along the edges of the cube it is exact
+            const c_vector<double, 3>& r_location = mesh.GetNode(node_index)->rGetLocation();
+            if (fabs(r_location[1]) + fabs(r_location[2]) < 1e-12)
+            {
+                TS_ASSERT_DELTA(r_times[node_index], r_location[0], 1e-12);
+            }
+        }
+    }
+
+    void TestDistributedMeshMatchesSequential()
+    {
+        // Unpermuted, so that node indices agree between the meshes
+        DistributedTetrahedralMesh<2,2> distributed_mesh(DistributedTetrahedralMeshPartitionType::DUMB);
+        distributed_mesh.ConstructRegularSlabMesh(0.05, 1.0, 1.0);
+        TetrahedralMesh<2,2> mesh;
+        mesh.ConstructRegularSlabMesh(0.05, 1.0, 1.0);
+
+        OrthotropicConductivityTensors<2,2> tensors;
+        tensors.SetConstantConductivities(Create_c_vector(3.0, 0.5));
+        tensors.Init(&mesh);
+        OrthotropicConductivityTensors<2,2> distributed_tensors;
+        distributed_tensors.SetConstantConductivities(Create_c_vector(3.0, 0.5));
+        distributed_tensors.Init(&distributed_mesh);
+
+        EikonalActivationSolver<2,2> solver(mesh, tensors, 1.0);
+        EikonalActivationSolver<2,2> distributed_solver(distributed_mesh, distributed_tensors, 1.0);
+
+        // Two sources whose fronts collide, so times cross the process boundaries more than once
+        unsigned middle_node = mesh.GetNumNodes()/2;
+        solver.AddStimulusSite(0u, 0.0);
+        solver.AddStimulusSite(middle_node, 0.2);
+        distributed_solver.AddStimulusSite(0u, 0.0);
+        distributed_solver.AddStimulusSite(middle_node, 0.2);
+
+        solver.Solve();
+        distributed_solver.Solve();
+
+        TS_ASSERT_EQUALS(solver.mRoundCounter, 1u);
+        if (PetscTools::IsSequential())
+        {
+            TS_ASSERT_EQUALS(distributed_solver.mRoundCounter, 1u);
+        }
+
+        const std::vector<double>& r_times = solver.rGetActivationTimes();
+        const std::vector<double>& r_distributed_times = distributed_solver.rGetActivationTimes();
+        TS_ASSERT_EQUALS(r_distributed_times.size(), distributed_mesh.GetNumNodes());
+        for (unsigned node_index=0; node_index<mesh.GetNumNodes(); node_index++)
+        {
+            TS_ASSERT_DELTA(r_distributed_times[node_index], r_times[node_index], 1e-10);
+        }
+        TS_ASSERT_DELTA(r_times[0], 0.0, 1e-12);
+        TS_ASSERT_DELTA(r_times[middle_node], 0.2, 1e-12);
+
+        // Along the fibres from the corner the speed is sqrt(3)
+        TS_ASSERT_DELTA(mesh.GetNode(20)->rGetLocation()[0], 1.0, 1e-12);
+        TS_ASSERT_DELTA(r_times[20], 1.0/sqrt(3.0), 0.05);
+    }
+
+    void TestWriteActivationMapAndExceptions()
+    {
+        HeartConfig::Instance()->SetOutputDirectory("TestEikonalActivationSolver");
+
+        DistributedTetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(0.1, 1.0);
+
+        OrthotropicConductivityTensors<1,1> tensors;
+        tensors.SetConstantConductivities(Create_c_vector(1.0));
+        tensors.Init(&mesh);
+
+        TS_ASSERT_THROWS_THIS((EikonalActivationSolver<1,1>(mesh, tensors, 0.0)),
+                              "The conduction velocity scale must be positive.");
+
+        EikonalActivationSolver<1,1> solver(mesh, tensors, 0.5);
+        TS_ASSERT_THROWS_THIS(solver.AddStimulusSite(11u), "Stimulus site 11 is not a node of the mesh.");
+        TS_ASSERT_THROWS_THIS(solver.WriteActivationMap("activation_map.dat"),
+                              "Solve() must be called before writing the activation map.");
+
+        // The middle of the cable activates at t=1 and the wave travels at 0.5 both ways
+        solver.AddStimulusSite(5u, 1.0);
+        solver.Solve();
+        solver.WriteActivationMap("activation_map.dat");
+
+        if (PetscTools::AmMaster())
+        {
+            OutputFileHandler handler("TestEikonalActivationSolver", false);
+            std::ifstream file((handler.GetOutputDirectoryFullPath() + "activation_map.dat").c_str());
+            TS_ASSERT(file.is_open());
+
+            unsigned num_lines = 0;
+            std::string line;
+            while (std::getline(file, line))
+            {
+                // Rows are in global node order, and node i is at x = 0.1*i
+                std::stringstream line_stream(line);
+                double first_activation;
+                char comma;
+                double first_recovery;
+                line_stream >> first_activation >> comma >> first_recovery;
+                TS_ASSERT_DELTA(first_activation, 1.0 + fabs(0.1*num_lines - 0.5)/0.5, 1e-5);
+                TS_ASSERT_DELTA(first_recovery, -1.0, 1e-12);
+                num_lines++;
+            }
+            TS_ASSERT_EQUALS(num_lines, mesh.GetNumNodes());
+        }
+    }
+
+    void TestTissueFromHeartConfig()
+    {
+        // Kinked fibres from the mesh's .ortho file, and a cuboid stimulus along the left-hand edge at t=1.5
+        HeartConfig::Instance()->SetParametersFile("heart/test/data/xml/eikonal2d_kinked_fibres.xml");
+
+        // HeartConfig makes a SimpleStimulus, whose start time is the delay
+        SimpleStimulus stimulus(-80000.0, 0.5, 1.5);
+        TS_ASSERT_DELTA(stimulus.GetStartTime(), 1.5, 1e-12);
+
+        HeartConfigRelatedCellFactory<2> cell_factory;
+        MonodomainProblem<2> monodomain_problem(&cell_factory);
+        monodomain_problem.Initialise();
+        AbstractTetrahedralMesh<2,2>& r_mesh = monodomain_problem.rGetMesh();
+
+        EikonalActivationSolver<2,2> solver(r_mesh, *(monodomain_problem.GetTissue()), 1.0);
+        solver.AddStimulusSitesFromHeartConfig();
+        solver.Solve();
+
+        // The same problem set up by hand, on the same mesh so that node indices agree in parallel
+        c_vector<double, 2> intra_conductivities;
+        HeartConfig::Instance()->GetIntracellularConductivities(intra_conductivities);
+        TS_ASSERT_DELTA(intra_conductivities[1], 0.19, 1e-12);
+
+        OrthotropicConductivityTensors<2,2> tensors;
+        tensors.SetConstantConductivities(intra_conductivities);
+        tensors.SetFibreOrientationFile(FileFinder("mesh/test/data/2D_0_to_1mm_800_elements.ortho", RelativeTo::ChasteSourceRoot));
+        tensors.Init(&r_mesh);
+
+        EikonalActivationSolver<2,2> hand_built_solver(r_mesh, tensors, 1.0);
+        for (AbstractTetrahedralMesh<2,2>::NodeIterator it = r_mesh.GetNodeIteratorBegin();
+             it != r_mesh.GetNodeIteratorEnd();
+             ++it)
+        {
+            if (it->rGetLocation()[0] < 1e-6)
+            {
+                hand_built_solver.AddStimulusSite(it->GetIndex(), 1.5);
+            }
+        }
+        hand_built_solver.Solve();
+
+        const std::vector<double>& r_times = solver.rGetActivationTimes();
+        const std::vector<double>& r_hand_built_times = hand_built_solver.rGetActivationTimes();
+        TS_ASSERT_EQUALS(r_times.size(), r_mesh.GetNumNodes());
+        double latest_time = 0.0;
+        for (unsigned node_index=0; node_index<r_mesh.GetNumNodes(); node_index++)
+        {
+            TS_ASSERT_DELTA(r_times[node_index], r_hand_built_times[node_index], 1e-12);
+            TS_ASSERT_LESS_THAN_EQUALS(1.5, r_times[node_index]);
+            latest_time = std::max(latest_time, r_times[node_index]);
+        }
+
+        // Every node is reached, and the far side of the sheet activates later than the stimulus
+        TS_ASSERT_LESS_THAN(1.5 + 0.1/sqrt(1.75), latest_time);
+        TS_ASSERT_LESS_THAN(latest_time, DBL_MAX);
+
+        HeartConfig::Reset();
+    }
+};
+
+#endif /*TESTEIKONALACTIVATIONSOLVER_HPP_*/
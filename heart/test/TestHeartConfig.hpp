@@ -1241,6 +1241,12 @@ public:
         HeartConfig::Instance()->SetUseReactionDiffusionOperatorSplitting(false);
         TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseReactionDiffusionOperatorSplitting(), false);
 
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseCompactConductivityTensors(), false);
+        HeartConfig::Instance()->SetUseCompactConductivityTensors();
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseCompactConductivityTensors(), true);
+        HeartConfig::Instance()->SetUseCompactConductivityTensors(false);
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseCompactConductivityTensors(), false);
+
         TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseMassLumpingForPrecond(), false);
         HeartConfig::Instance()->SetUseMassLumpingForPrecond();
         TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseMassLumpingForPrecond(), true);
@@ -86,6 +86,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Maleckar2008.hpp"
 
 #include "ArchiveLocationInfo.hpp"
+#include "ColumnDataOdeSolutionSink.hpp"
+#include "NumericFileComparison.hpp"
 
 #include "CellMLLoader.hpp"
 #include "CellMLToSharedLibraryConverter.hpp"
@@ -576,6 +578,47 @@ public:
         HeartConfig::Instance()->SetOdePdeAndPrintingTimeSteps(0.01, 0.01, 0.01);
     }
 
+    void TestBackwardEulerLr91StreamingToSink(void)
+    {
+        HeartConfig::Instance()->SetOdePdeAndPrintingTimeSteps(0.01, 0.01, 0.01);
+        boost::shared_ptr<SimpleStimulus> p_stimulus(new SimpleStimulus(-25.5, 2.0, 1.0));
+        boost::shared_ptr<EulerIvpOdeSolver> p_solver(new EulerIvpOdeSolver);
+        CellLuoRudy1991FromCellMLBackwardEulerOpt lr91(p_solver, p_stimulus);
+
+        // With a sink, nothing is stored but every sample is written to file
+        boost::shared_ptr<ColumnDataOdeSolutionSink> p_sink(
+            new ColumnDataOdeSolutionSink("Lr91BackwardEulerSink", "streamed", lr91.GetSystemInformation(), "ms"));
+        lr91.SetSolutionSink(p_sink);
+        TS_ASSERT_EQUALS(lr91.GetSolutionSink(), p_sink);
+        OdeSolution streamed = lr91.Compute(0.0, 10.0, 0.1);
+        TS_ASSERT_EQUALS(streamed.rGetTimes().size(), 0u);
+        TS_ASSERT_EQUALS(p_sink->GetNumberOfSamples(), 101u);
+        p_sink->Close();
+        double streamed_final_voltage = lr91.GetVoltage();
+
+        // Without one, the same samples are stored as normal
+        lr91.SetSolutionSink(boost::shared_ptr<AbstractOdeSolutionSink>());
+        lr91.ResetToInitialConditions();
+        OdeSolution stored = lr91.Compute(0.0, 10.0, 0.1);
+        TS_ASSERT_EQUALS(stored.rGetTimes().size(), 101u);
+        TS_ASSERT_EQUALS(lr91.GetVoltage(), streamed_final_voltage);
+        stored.WriteToFile("Lr91BackwardEulerSink", "stored", "ms", 1, false);
+
+        NumericFileComparison comparer(OutputFileHandler::GetChasteTestOutputDirectory() + "Lr91BackwardEulerSink/streamed.dat",
+                                       OutputFileHandler::GetChasteTestOutputDirectory() + "Lr91BackwardEulerSink/stored.dat");
+        TS_ASSERT(comparer.CompareFiles(1e-12));
+
+        // A cell with an ODE solver streams through it, leaving the solver's own sink untouched
+        CellLuoRudy1991FromCellML lr91_forward(p_solver, p_stimulus);
+        boost::shared_ptr<ColumnDataOdeSolutionSink> p_forward_sink(
+            new ColumnDataOdeSolutionSink("Lr91BackwardEulerSink", "forward", lr91_forward.GetSystemInformation(), "ms", 1, false));
+        lr91_forward.SetSolutionSink(p_forward_sink);
+        OdeSolution forward = lr91_forward.Compute(0.0, 10.0, 0.1);
+        TS_ASSERT_EQUALS(forward.rGetTimes().size(), 0u);
+        TS_ASSERT_EQUALS(p_forward_sink->GetNumberOfSamples(), 101u);
+        TS_ASSERT(!p_solver->GetSolutionSink());
+    }
+
     void TestSolverForFR2000WithDelayedSimpleStimulus(void)
     {
         clock_t ck_start, ck_end;
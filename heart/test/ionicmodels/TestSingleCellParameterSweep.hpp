@@ -0,0 +1,232 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTSINGLECELLPARAMETERSWEEP_HPP_
+#define TESTSINGLECELLPARAMETERSWEEP_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include <cfloat>
+#include <cmath>
+#include <fstream>
+
+#include "CellProperties.hpp"
+#include "FileFinder.hpp"
+#include "LuoRudy1991.hpp"
+#include "SingleCellFactory.hpp"
+#include "SingleCellParameterSweep.hpp"
+
+#include "PetscSetupAndFinalize.hpp"
+
+/**
+ * A Luo-Rudy 1991 cell which fails to solve if its IKr conductance is more than
+ * 1 mS/uF (the default is 0.282), to check that the sweep copes with failures.
+ */
+class FailingLuoRudy1991 : public CellLuoRudy1991FromCellML
+{
+public:
+    FailingLuoRudy1991(boost::shared_ptr<AbstractIvpOdeSolver> pSolver,
+                       boost::shared_ptr<AbstractStimulusFunction> pStimulus)
+        : CellLuoRudy1991FromCellML(pSolver, pStimulus)
+    {
+    }
+
+    void SolveAndUpdateState(double tStart, double tEnd)
+    {
+        if (GetParameter("membrane_rapid_delayed_rectifier_potassium_current_conductance") > 1.0)
+        {
+            EXCEPTION("Unstable parameters");
+        }
+        CellLuoRudy1991FromCellML::SolveAndUpdateState(tStart, tEnd);
+    }
+};
+
+class TestSingleCellParameterSweep : public CxxTest::TestSuite
+{
+public:
+    void TestParameterSets()
+    {
+        boost::shared_ptr<RegularStimulus> p_stimulus(new RegularStimulus(-25.5, 2.0, 500.0, 10.0));
+        boost::shared_ptr<AbstractSingleCellFactory> p_factory(new SingleCellFactory<CellLuoRudy1991FromCellML>(0.01));
+        std::vector<std::string> names;
+        names.push_back("membrane_fast_sodium_current_conductance");
+        names.push_back("membrane_rapid_delayed_rectifier_potassium_current_conductance");
+        SingleCellParameterSweep sweep(p_factory, p_stimulus, names);
+
+        std::vector<std::vector<double> > grid(2);
+        grid[0].push_back(1.0);
+        grid[0].push_back(2.0);
+        grid[1].push_back(0.5);
+        grid[1].push_back(1.0);
+        grid[1].push_back(2.0);
+        sweep.AddParameterGrid(grid);
+        sweep.AddParameterSet(std::vector<double>(2, 3.0));
+
+        const std::vector<std::vector<double> >& r_sets = sweep.rGetParameterSets();
+        TS_ASSERT_EQUALS(r_sets.size(), 7u);
+        TS_ASSERT_EQUALS(r_sets[0][0], 1.0);
+        TS_ASSERT_EQUALS(r_sets[0][1], 0.5);
+        TS_ASSERT_EQUALS(r_sets[2][0], 1.0);
+        TS_ASSERT_EQUALS(r_sets[2][1], 2.0);
+        TS_ASSERT_EQUALS(r_sets[3][0], 2.0);
+        TS_ASSERT_EQUALS(r_sets[3][1], 0.5);
+        TS_ASSERT_EQUALS(r_sets[6][0], 3.0);
+        TS_ASSERT_EQUALS(r_sets[6][1], 3.0);
+
+        TS_ASSERT_THROWS_THIS(sweep.AddParameterSet(std::vector<double>(1, 1.0)),
+                              "A parameter set must have one scaling factor per parameter name (2), not 1.");
+        TS_ASSERT_THROWS_THIS(sweep.AddParameterGrid(std::vector<std::vector<double> >(3)),
+                              "A parameter grid must have one list of scaling factors per parameter name (2), not 3.");
+        TS_ASSERT_THROWS_THIS(sweep.SetMaxNumPaces(0u),
+                              "Please set a maximum number of paces that is positive");
+        TS_ASSERT_THROWS_THIS(sweep.WriteResults("TestSingleCellParameterSweep", "results.dat"),
+                              "Run() must be called before the results can be written.");
+
+        SingleCellParameterSweep empty_sweep(p_factory, p_stimulus, names);
+        TS_ASSERT_THROWS_THIS(empty_sweep.Run(), "No parameter sets have been added to the sweep.");
+    }
+
+    void TestSweepLuoRudy()
+    {
+        boost::shared_ptr<RegularStimulus> p_stimulus(new RegularStimulus(-25.5, 2.0, 500.0, 10.0));
+        boost::shared_ptr<AbstractSingleCellFactory> p_factory(new SingleCellFactory<CellLuoRudy1991FromCellML>(0.01));
+        std::vector<std::string> names(1, "membrane_rapid_delayed_rectifier_potassium_current_conductance");
+        SingleCellParameterSweep sweep(p_factory, p_stimulus, names);
+
+        std::vector<std::vector<double> > grid(1);
+        grid[0].push_back(0.5);
+        grid[0].push_back(1.0);
+        grid[0].push_back(2.0);
+        sweep.AddParameterGrid(grid);
+        sweep.SetMaxNumPaces(3u);
+        sweep.Run();
+
+        const std::vector<std::string>& r_metrics = sweep.rGetMetricNames();
+        TS_ASSERT_EQUALS(r_metrics.size(), (unsigned)SingleCellParameterSweep::NUM_METRICS);
+        TS_ASSERT_EQUALS(r_metrics[SingleCellParameterSweep::APD90], "APD90");
+        TS_ASSERT_EQUALS(r_metrics[SingleCellParameterSweep::NUM_PACES], "NumPaces");
+
+        std::vector<std::vector<double> > results = sweep.rGetResults();
+        TS_ASSERT_EQUALS(results.size(), 3u);
+        for (unsigned set=0; set<3u; set++)
+        {
+            TS_ASSERT_EQUALS(results[set].size(), 10u);
+            TS_ASSERT_DELTA(results[set][8], 3.0, 1e-12);
+            TS_ASSERT_LESS_THAN(results[set][1], results[set][0]); // APD50 < APD90
+            TS_ASSERT_LESS_THAN(0.0, results[set][7]); // The model has a calcium transient
+        }
+
+        // Blocking IKr prolongs the action potential
+        TS_ASSERT_LESS_THAN(results[1][0], results[0][0]);
+        TS_ASSERT_LESS_THAN(results[2][0], results[1][0]);
+
+        // The default parameter set matches simulating the cell directly
+        {
+            boost::shared_ptr<AbstractCardiacCellInterface> p_cell = p_factory->CreateCell(p_stimulus);
+            p_cell->SolveAndUpdateState(0.0, 500.0);
+            p_cell->SolveAndUpdateState(500.0, 1000.0);
+            OdeSolution solution = p_cell->Compute(1000.0, 1500.0, 0.1);
+            std::vector<double> voltages = solution.GetVariableAtIndex(p_cell->GetVoltageIndex());
+            CellProperties properties(voltages, solution.rGetTimes());
+            TS_ASSERT_DELTA(results[1][0], properties.GetLastActionPotentialDuration(90.0), 1e-9);
+            TS_ASSERT_DELTA(results[1][2], properties.GetLastPeakPotential(), 1e-9);
+        }
+
+        // Creating a new cell for each parameter set gives the same answers as reusing one
+        sweep.SetReuseCells(false);
+        sweep.Run();
+        for (unsigned set=0; set<3u; set++)
+        {
+            for (unsigned i=0; i<10u; i++)
+            {
+                TS_ASSERT_DELTA(sweep.rGetResults()[set][i], results[set][i], 1e-12);
+            }
+        }
+
+        // A very loose steady state tolerance stops pacing after the first pace
+        sweep.SetSteadyStateTolerance(DBL_MAX);
+        sweep.Run();
+        TS_ASSERT_DELTA(sweep.rGetResults()[0][8], 2.0, 1e-12);
+
+        // Metrics which cannot be computed are NaN
+        sweep.SetThreshold(1000.0);
+        sweep.Run();
+        TS_ASSERT(std::isnan(sweep.rGetResults()[0][0]));
+        TS_ASSERT(!std::isnan(sweep.rGetResults()[0][7]));
+
+        sweep.WriteResults("TestSingleCellParameterSweep", "results.dat");
+        PetscTools::Barrier("TestSweepLuoRudy");
+        FileFinder results_file("TestSingleCellParameterSweep/results.dat", RelativeTo::ChasteTestOutput);
+        TS_ASSERT(results_file.IsFile());
+        std::ifstream file(results_file.GetAbsolutePath().c_str());
+        std::string header;
+        std::getline(file, header);
+        TS_ASSERT_EQUALS(header.substr(0, 68), "membrane_rapid_delayed_rectifier_potassium_current_conductance\tAPD90");
+    }
+
+    void TestSweepWithFailingParameterSet()
+    {
+        boost::shared_ptr<RegularStimulus> p_stimulus(new RegularStimulus(-25.5, 2.0, 500.0, 10.0));
+        boost::shared_ptr<AbstractSingleCellFactory> p_factory(new SingleCellFactory<FailingLuoRudy1991>(0.01));
+        std::vector<std::string> names(1, "membrane_rapid_delayed_rectifier_potassium_current_conductance");
+        SingleCellParameterSweep sweep(p_factory, p_stimulus, names);
+        sweep.AddParameterSet(std::vector<double>(1, 1.0));
+        sweep.AddParameterSet(std::vector<double>(1, 10.0));
+        sweep.AddParameterSet(std::vector<double>(1, 1.0));
+        sweep.SetMaxNumPaces(2u);
+
+        // The failing set doesn't stop the sweep (whichever process it is on), and has no metrics
+        sweep.Run();
+        const std::vector<std::vector<double> >& r_results = sweep.rGetResults();
+        TS_ASSERT_EQUALS(r_results.size(), 3u);
+        for (unsigned i=0; i<SingleCellParameterSweep::NUM_METRICS; i++)
+        {
+            TS_ASSERT(std::isnan(r_results[1][i]));
+        }
+
+        // The set after the failure starts from a fresh cell, so matches the first
+        TS_ASSERT_DELTA(r_results[0][SingleCellParameterSweep::NUM_PACES], 2.0, 1e-12);
+        TS_ASSERT_DELTA(r_results[2][SingleCellParameterSweep::APD90], r_results[0][SingleCellParameterSweep::APD90], 1e-12);
+        TS_ASSERT_DELTA(r_results[2][SingleCellParameterSweep::PEAK_CALCIUM], r_results[0][SingleCellParameterSweep::PEAK_CALCIUM], 1e-12);
+
+        // Errors setting up a cell are not specific to a parameter set, so are thrown on every process
+        std::vector<std::string> bad_names(1, "no_such_parameter");
+        SingleCellParameterSweep bad_sweep(p_factory, p_stimulus, bad_names);
+        bad_sweep.AddParameterSet(std::vector<double>(1, 1.0));
+        TS_ASSERT_THROWS_ANYTHING(bad_sweep.Run());
+    }
+};
+
+#endif // TESTSINGLECELLPARAMETERSWEEP_HPP_
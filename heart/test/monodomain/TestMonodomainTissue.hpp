@@ -45,6 +45,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <vector>
 
 #include "SimpleStimulus.hpp"
+#include "RegularStimulus.hpp"
 #include "EulerIvpOdeSolver.hpp"
 #include "LuoRudy1991.hpp"
 #include "MonodomainTissue.hpp"
@@ -127,6 +128,39 @@ public:
     }
 };
 
+class SparselyStimulatedCellFactory : public AbstractCardiacCellFactory<1>
+{
+private:
+    boost::shared_ptr<RegularStimulus> mpRegularStimulus;
+    boost::shared_ptr<SimpleStimulus> mpSimpleStimulus;
+
+public:
+
+    SparselyStimulatedCellFactory()
+        : AbstractCardiacCellFactory<1>(),
+          mpRegularStimulus(new RegularStimulus(-1000.0, 0.5, 1.0, 0.25)),
+          mpSimpleStimulus(new SimpleStimulus(-500.0, 0.5))
+    {
+    }
+
+    AbstractCardiacCell* CreateCardiacCellForTissueNode(Node<1>* pNode)
+    {
+        unsigned node_index = pNode->GetIndex();
+        if (node_index <= 2u)
+        {
+            return new CellLuoRudy1991FromCellML(mpSolver, mpRegularStimulus);
+        }
+        else if (node_index == 5u)
+        {
+            return new CellLuoRudy1991FromCellML(mpSolver, mpSimpleStimulus);
+        }
+        else
+        {
+            return new CellLuoRudy1991FromCellML(mpSolver, mpZeroStimulus);
+        }
+    }
+};
+
 class TestMonodomainTissue : public CxxTest::TestSuite
 {
 public:
@@ -236,6 +270,89 @@ public:
         PetscTools::Destroy(voltage);
     }
 
+    void TestSparseStimulusEvaluation()
+    {
+        HeartConfig::Instance()->Reset();
+        DistributedTetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(0.1, 1.0); // 11 nodes
+
+        SparselyStimulatedCellFactory cell_factory;
+        cell_factory.SetMesh(&mesh);
+        MonodomainTissue<1> monodomain_tissue(&cell_factory);
+
+        DistributedVectorFactory* p_factory = mesh.GetDistributedVectorFactory();
+        unsigned expected_num_groups = 0u;
+        unsigned expected_num_stimulated = 0u;
+        bool has_regular = false;
+        for (unsigned node_index=0; node_index<mesh.GetNumNodes(); node_index++)
+        {
+            if (p_factory->IsGlobalIndexLocal(node_index) && (node_index <= 2u || node_index == 5u))
+            {
+                expected_num_stimulated++;
+                if (node_index == 5u || !has_regular)
+                {
+                    expected_num_groups++;
+                }
+                has_regular = has_regular || (node_index <= 2u);
+            }
+        }
+
+        Vec voltage = PetscTools::CreateAndSetVec(mesh.GetNumNodes(), -83.853);
+        const IntracellularStimulusScheduler& r_scheduler = monodomain_tissue.rGetIntracellularStimulusScheduler();
+        TS_ASSERT(!r_scheduler.IsUpToDate());
+
+        // The stimulus cache agrees with evaluating every cell's stimulus, in and out of the stimulus windows
+        double dt = 0.25;
+        for (double time=0.0; time<2.0; time+=dt)
+        {
+            monodomain_tissue.SolveCellSystems(voltage, time, time+dt);
+            TS_ASSERT(r_scheduler.IsUpToDate());
+            TS_ASSERT_EQUALS(r_scheduler.GetNumStimulusGroups(), expected_num_groups);
+            TS_ASSERT_EQUALS(r_scheduler.GetNumStimulatedCells(), expected_num_stimulated);
+            TS_ASSERT_LESS_THAN_EQUALS(r_scheduler.GetNumEntriesUpdated(), expected_num_stimulated);
+
+            for (unsigned node_index=p_factory->GetLow(); node_index<p_factory->GetHigh(); node_index++)
+            {
+                TS_ASSERT_EQUALS(monodomain_tissue.rGetIntracellularStimulusCacheReplicated()[node_index],
+                                 monodomain_tissue.GetCardiacCell(node_index)->GetIntracellularStimulus(time+dt));
+            }
+        }
+
+        // Both stimuli are off at 2.1 and 2.2, so nothing is written at the second step
+        monodomain_tissue.SolveCellSystems(voltage, 2.0, 2.1);
+        monodomain_tissue.SolveCellSystems(voltage, 2.1, 2.2);
+        TS_ASSERT_EQUALS(r_scheduler.GetNumEntriesUpdated(), 0u);
+
+        // Replacing a cell's stimulus rebuilds the index
+        boost::shared_ptr<RegularStimulus> p_new_stimulus(new RegularStimulus(-200.0, 1.0, 10.0, 2.0));
+        if (p_factory->IsGlobalIndexLocal(8u))
+        {
+            monodomain_tissue.GetCardiacCell(8u)->SetIntracellularStimulusFunction(p_new_stimulus);
+            TS_ASSERT(!r_scheduler.IsUpToDate());
+            expected_num_groups++;
+            expected_num_stimulated++;
+        }
+        monodomain_tissue.SolveCellSystems(voltage, 2.2, 2.3);
+        TS_ASSERT(r_scheduler.IsUpToDate());
+        TS_ASSERT_EQUALS(r_scheduler.GetNumStimulusGroups(), expected_num_groups);
+        TS_ASSERT_EQUALS(r_scheduler.GetNumStimulatedCells(), expected_num_stimulated);
+        if (p_factory->IsGlobalIndexLocal(8u))
+        {
+            TS_ASSERT_DELTA(monodomain_tissue.rGetIntracellularStimulusCacheReplicated()[8], -200.0, 1e-12);
+        }
+
+        // Changing a stimulus in place does not need a rebuild, as every group is evaluated at each step
+        p_new_stimulus->SetMagnitude(-300.0);
+        monodomain_tissue.SolveCellSystems(voltage, 2.3, 2.4);
+        TS_ASSERT(r_scheduler.IsUpToDate());
+        if (p_factory->IsGlobalIndexLocal(8u))
+        {
+            TS_ASSERT_DELTA(monodomain_tissue.rGetIntracellularStimulusCacheReplicated()[8], -300.0, 1e-12);
+        }
+
+        PetscTools::Destroy(voltage);
+    }
+
     void TestMonodomainTissueGetCardiacCell()
     {
         if (PetscTools::GetNumProcs() > 2u)
@@ -0,0 +1,147 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTCARDIACBENCHMARKS_HPP_
+#define TESTCARDIACBENCHMARKS_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include "BenchmarkRecorder.hpp"
+#include "BidomainProblem.hpp"
+#include "CardiacElectroMechProbRegularGeom.hpp"
+#include "HeartEventHandler.hpp"
+#include "LuoRudy1991.hpp"
+#include "LuoRudy1991BackwardEulerOpt.hpp"
+#include "MonodomainProblem.hpp"
+#include "PlaneStimulusCellFactory.hpp"
+
+// Includes PetscSetupAndFinalize.hpp
+#include "PerformanceTester.hpp"
+
+/**
+ * Benchmarks of the cardiac solvers, for tracking performance and scaling.
+ *
+ * Problem sizes are taken from the command line:
+ *   -benchmark_size N      mesh refinement level (default 1; each level doubles the elements in each direction)
+ *   -benchmark_sim_time T  simulated time in ms (default 4)
+ *
+ * Results are written to $CHASTE_TEST_OUTPUT/Benchmarks/heart.json
+ * (see BenchmarkRecorder for how to change this).
+ */
+class TestCardiacBenchmarks : public CxxTest::TestSuite
+{
+private:
+    /** Records the timings of all the benchmarks in this suite. */
+    BenchmarkRecorder mRecorder;
+
+    /**
+     * Run a tissue electrophysiology benchmark on a cuboid mesh.
+     *
+     * @param rName  the benchmark name
+     */
+    template<class CARDIAC_PROBLEM>
+    void RunTissueBenchmark(const std::string& rName)
+    {
+        HeartConfig::Reset();
+        HeartConfig::Instance()->SetKSPSolver("symmlq");
+        HeartConfig::Instance()->SetKSPPreconditioner("bjacobi");
+
+        PerformanceTester<CellLuoRudy1991FromCellMLBackwardEulerOpt, CARDIAC_PROBLEM, 3> tester("Benchmark" + rName);
+        tester.MeshNum = BenchmarkRecorder::GetUnsignedOption("-benchmark_size", 1u);
+        tester.SimTime = BenchmarkRecorder::GetUnsignedOption("-benchmark_sim_time", 4u);
+
+        HeartEventHandler::Reset();
+        mRecorder.StartBenchmark(rName);
+        tester.Run();
+        mRecorder.StopBenchmark();
+        HeartEventHandler::Headings();
+        HeartEventHandler::Report();
+
+        mRecorder.AddParameter("size", tester.MeshNum);
+        mRecorder.AddParameter("num_nodes", tester.GetNumNodes());
+        mRecorder.AddParameter("num_elements", tester.GetNumElements());
+        mRecorder.AddParameter("sim_time", tester.SimTime);
+        mRecorder.WriteJson();
+    }
+
+public:
+    TestCardiacBenchmarks()
+        : mRecorder("heart")
+    {
+    }
+
+    void TestMonodomainBenchmark()
+    {
+        RunTissueBenchmark<MonodomainProblem<3> >("Monodomain3d");
+    }
+
+    void TestBidomainBenchmark()
+    {
+        RunTissueBenchmark<BidomainProblem<3> >("Bidomain3d");
+    }
+
+    void TestElectroMechanicsBenchmark()
+    {
+        HeartConfig::Reset();
+        const unsigned size = BenchmarkRecorder::GetUnsignedOption("-benchmark_size", 1u);
+        const unsigned sim_time = BenchmarkRecorder::GetUnsignedOption("-benchmark_sim_time", 4u);
+        const unsigned num_mechanics_elements = 5u << size;
+        const unsigned num_electrics_elements = 10u << size;
+        HeartConfig::Instance()->SetSimulationDuration(sim_time);
+
+        PlaneStimulusCellFactory<CellLuoRudy1991FromCellML, 2> cell_factory(-5000*1000);
+
+        mRecorder.StartBenchmark("ElectroMechanics2d");
+        CardiacElectroMechProbRegularGeom<2> problem(INCOMPRESSIBLE,
+                                                     0.1,
+                                                     num_mechanics_elements,
+                                                     num_electrics_elements,
+                                                     &cell_factory,
+                                                     KERCHOFFS2003,
+                                                     1.0,
+                                                     0.01,
+                                                     "BenchmarkElectroMechanics");
+        problem.Solve();
+        mRecorder.StopBenchmark();
+
+        mRecorder.AddParameter("size", size);
+        mRecorder.AddParameter("num_mechanics_elements_each_dir", num_mechanics_elements);
+        mRecorder.AddParameter("num_electrics_elements_each_dir", num_electrics_elements);
+        mRecorder.AddParameter("sim_time", sim_time);
+        mRecorder.WriteJson();
+    }
+};
+
+#endif /*TESTCARDIACBENCHMARKS_HPP_*/
@@ -39,6 +39,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cxxtest/TestSuite.h>
 #include <iostream>
+#include <fstream>
 
 #include "TetrahedralMesh.hpp" //must be first, it gets UblasIncludes from the mesh classes (ChastePoint.hpp)
 #include "DistributedTetrahedralMesh.hpp"
@@ -55,6 +56,10 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FileComparison.hpp"
 #include "SimpleBathProblemSetup.hpp"
 #include "BidomainWithBathProblem.hpp"
+#include "BidomainProblem.hpp"
+#include "LuoRudy1991.hpp"
+#include "PlaneStimulusCellFactory.hpp"
+#include "PseudoEcgOutputModifier.hpp"
 
 /* HOW_TO_TAG Cardiac/Post-processing
  * Compute pseudo-ECGs
@@ -336,6 +341,68 @@ public:
         ecg_calculator2.WritePseudoEcg();
     }
 
+    void TestPseudoEcgOutputModifier()
+    {
+        HeartConfig::Instance()->Reset();
+        HeartConfig::Instance()->SetSimulationDuration(2.0); //ms
+        HeartConfig::Instance()->SetOdePdeAndPrintingTimeSteps(0.01, 0.01, 0.1);
+        HeartConfig::Instance()->SetOutputDirectory("BidomainPseudoEcgOnTheFly");
+        HeartConfig::Instance()->SetOutputFilenamePrefix("bidomain_1d");
+
+        TrianglesMeshReader<1,1> reader("mesh/test/data/1D_0_to_1mm_10_elements");
+        TetrahedralMesh<1,1> mesh;
+        mesh.ConstructFromMeshReader(reader);
+
+        PlaneStimulusCellFactory<CellLuoRudy1991FromCellML, 1> cell_factory;
+        BidomainProblem<1> bidomain_problem(&cell_factory);
+        bidomain_problem.SetMesh(&mesh);
+        bidomain_problem.Initialise();
+
+        std::vector<ChastePoint<1> > electrodes;
+        electrodes.push_back(ChastePoint<1>(0.15));
+        electrodes.push_back(ChastePoint<1>(-0.05));
+
+        std::vector<ChastePoint<1> > no_electrodes;
+        TS_ASSERT_THROWS_THIS(PseudoEcgOutputModifier<1>("ecg.dat", mesh, no_electrodes),
+                              "At least one electrode is needed to compute a pseudo-ECG.");
+
+        boost::shared_ptr<PseudoEcgOutputModifier<1> > p_ecg(new PseudoEcgOutputModifier<1>("ecg.dat", mesh, electrodes));
+        bidomain_problem.AddOutputModifier(p_ecg);
+        bidomain_problem.Solve();
+
+        // Compare with the post-processing calculator, which reads V back from the HDF5 file
+        FileFinder output_dir("BidomainPseudoEcgOnTheFly", RelativeTo::ChasteTestOutput);
+        PseudoEcgCalculator<1,1,1> calculator0(mesh, electrodes[0], output_dir, "bidomain_1d");
+        PseudoEcgCalculator<1,1,1> calculator1(mesh, electrodes[1], output_dir, "bidomain_1d");
+        unsigned num_steps = calculator0.mNumTimeSteps;
+        TS_ASSERT_EQUALS(num_steps, 21u);
+
+        double ecg0 = calculator0.ComputePseudoEcgAtOneTimeStep(num_steps-1);
+        double ecg1 = calculator1.ComputePseudoEcgAtOneTimeStep(num_steps-1);
+        TS_ASSERT_DELTA(p_ecg->rGetPseudoEcgs()[0], ecg0, 1e-9*(1.0 + fabs(ecg0)));
+        TS_ASSERT_DELTA(p_ecg->rGetPseudoEcgs()[1], ecg1, 1e-9*(1.0 + fabs(ecg1)));
+
+        // Every output step is in the file written by the modifier
+        PetscTools::Barrier("TestPseudoEcgOutputModifier");
+        std::ifstream ecg_file(FileFinder("ecg.dat", output_dir).GetAbsolutePath().c_str());
+        TS_ASSERT(ecg_file.is_open());
+        std::string header;
+        std::getline(ecg_file, header);
+        TS_ASSERT_EQUALS(header, "#Time(ms)\tPseudo-ECG(0.15,0,0)\tPseudo-ECG(-0.05,0,0)");
+        for (unsigned step=0; step<num_steps; step++)
+        {
+            double time, value0, value1;
+            ecg_file >> time >> value0 >> value1;
+            TS_ASSERT_DELTA(time, 0.1*step, 1e-9);
+
+            double expected0 = calculator0.ComputePseudoEcgAtOneTimeStep(step);
+            double expected1 = calculator1.ComputePseudoEcgAtOneTimeStep(step);
+            // The file is written with the default stream precision
+            TS_ASSERT_DELTA(value0, expected0, 1e-4*(1.0 + fabs(expected0)));
+            TS_ASSERT_DELTA(value1, expected1, 1e-4*(1.0 + fabs(expected1)));
+        }
+    }
+
  };
 
 
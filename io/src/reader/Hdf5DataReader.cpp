@@ -47,7 +47,11 @@ Hdf5DataReader::Hdf5DataReader(const std::string& rDirectory,
                                std::string datasetName)
     : AbstractHdf5Access(rDirectory, rBaseName, datasetName, makeAbsolute),
       mNumberTimesteps(1),
-      mClosed(false)
+      mClosed(false),
+      mTimeSeriesCacheMaxBytes(64u*1024u*1024u),
+      mChunkWidthInNodes(0u),
+      mTimeSeriesCacheLow(0u),
+      mTimeSeriesCacheHigh(0u)
 {
     CommonConstructor();
 }
@@ -57,7 +61,11 @@ Hdf5DataReader::Hdf5DataReader(const FileFinder& rDirectory,
                                std::string datasetName)
     : AbstractHdf5Access(rDirectory, rBaseName, datasetName),
       mNumberTimesteps(1),
-      mClosed(false)
+      mClosed(false),
+      mTimeSeriesCacheMaxBytes(64u*1024u*1024u),
+      mChunkWidthInNodes(0u),
+      mTimeSeriesCacheLow(0u),
+      mTimeSeriesCacheHigh(0u)
 {
     CommonConstructor();
 }
@@ -108,6 +116,16 @@ void Hdf5DataReader::CommonConstructor()
         assert(mDatasetDims[i] == dataset_max_sizes[i]);
     }
 
+    // Record the chunk width in the node dimension, used to size time series reads
+    hid_t dcpl = H5Dget_create_plist(mVariablesDatasetId);
+    if (H5Pget_layout(dcpl) == H5D_CHUNKED)
+    {
+        hsize_t chunk_dims[AbstractHdf5Access::DATASET_DIMS];
+        H5Pget_chunk(dcpl, AbstractHdf5Access::DATASET_DIMS, chunk_dims);
+        mChunkWidthInNodes = chunk_dims[1];
+    }
+    H5Pclose(dcpl);
+
     // Check if an unlimited dimension has been defined
     if (dataset_max_sizes[0] == H5S_UNLIMITED)
     {
@@ -253,6 +271,21 @@ std::vector<double> Hdf5DataReader::GetVariableOverTime(const std::string& rVari
     }
     unsigned column_index = (*col_iter).second;
 
+    // Serve the request from the cached block of time series if possible
+    const hsize_t num_timesteps = mDatasetDims[0];
+    const hsize_t num_columns = mDatasetDims[2];
+    if (num_timesteps > 0 && num_columns*num_timesteps*sizeof(double) <= mTimeSeriesCacheMaxBytes)
+    {
+        if (actual_node_index < mTimeSeriesCacheLow
+            || actual_node_index >= mTimeSeriesCacheHigh)
+        {
+            FillTimeSeriesCache(actual_node_index);
+        }
+        std::vector<double>::const_iterator first = mTimeSeriesCache.begin()
+            + ((actual_node_index - mTimeSeriesCacheLow)*num_columns + column_index)*num_timesteps;
+        return std::vector<double>(first, first + num_timesteps);
+    }
+
     // Define hyperslab in the dataset.
     hsize_t offset[3] = {0, actual_node_index, column_index};
     hsize_t count[3]  = {mDatasetDims[0], 1, 1};
@@ -340,6 +373,74 @@ std::vector<std::vector<double> > Hdf5DataReader::GetVariableOverTimeOverMultipl
     return ret;
 }
 
+void Hdf5DataReader::FillTimeSeriesCache(unsigned rowIndex)
+{
+    const hsize_t num_timesteps = mDatasetDims[0];
+    const hsize_t num_rows = mDatasetDims[1];
+    const hsize_t num_columns = mDatasetDims[2];
+
+    // Width of the block: a whole chunk if the memory limit allows, otherwise as many rows as fit
+    hsize_t max_rows = std::max(hsize_t(1), mTimeSeriesCacheMaxBytes/(num_columns*num_timesteps*sizeof(double)));
+    hsize_t block_width = (mChunkWidthInNodes > 0) ? std::min(mChunkWidthInNodes, max_rows) : max_rows;
+
+    hsize_t low = (rowIndex/block_width)*block_width;
+    hsize_t high = std::min(low + block_width, num_rows);
+    hsize_t width = high - low;
+
+    // Read every variable over the block, which is time-major in the file
+    hsize_t offset[3] = {0, low, 0};
+    hsize_t count[3]  = {num_timesteps, width, num_columns};
+    hid_t variables_dataspace = H5Dget_space(mVariablesDatasetId);
+    H5Sselect_hyperslab(variables_dataspace, H5S_SELECT_SET, offset, nullptr, count, nullptr);
+
+    hid_t memspace = H5Screate_simple(3, count, nullptr);
+
+    std::vector<double> data_read(num_timesteps*width*num_columns);
+    herr_t err = H5Dread(mVariablesDatasetId, H5T_NATIVE_DOUBLE, memspace, variables_dataspace, H5P_DEFAULT, &data_read[0]);
+
+    H5Sclose(variables_dataspace);
+    H5Sclose(memspace);
+
+    // The cache is only updated below, so it is still consistent if we bail out here
+    if (err < 0)
+    {
+        EXCEPTION("Hdf5DataReader could not read nodes " << low << " to " << high-1 << " of the dataset '"
+                  << mDatasetName << "' in " << mDirectory.GetAbsolutePath() << mBaseName << ".h5");
+    }
+
+    // Transpose into node-major order, keeping each variable's time series contiguous
+    mTimeSeriesCache.resize(num_timesteps*width*num_columns);
+    for (hsize_t time_num=0; time_num<num_timesteps; time_num++)
+    {
+        for (hsize_t node_num=0; node_num<width; node_num++)
+        {
+            for (hsize_t column=0; column<num_columns; column++)
+            {
+                mTimeSeriesCache[(node_num*num_columns + column)*num_timesteps + time_num]
+                    = data_read[(time_num*width + node_num)*num_columns + column];
+            }
+        }
+    }
+
+    mTimeSeriesCacheLow = low;
+    mTimeSeriesCacheHigh = high;
+}
+
+void Hdf5DataReader::SetTimeSeriesCacheLimit(unsigned maxBytes)
+{
+    mTimeSeriesCacheMaxBytes = maxBytes;
+
+    // Drop the current block, which may be larger than the new limit
+    mTimeSeriesCache.clear();
+    mTimeSeriesCacheLow = 0u;
+    mTimeSeriesCacheHigh = 0u;
+}
+
+unsigned Hdf5DataReader::GetNumberOfCachedTimeSeries() const
+{
+    return mTimeSeriesCacheHigh - mTimeSeriesCacheLow;
+}
+
 void Hdf5DataReader::GetVariableOverNodes(Vec data,
                                           const std::string& rVariableName,
                                           unsigned timestep)
@@ -38,6 +38,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <petscvec.h>
 #include <vector>
+#include <climits>
 #include <map>
 
 #include "AbstractHdf5Access.hpp"
@@ -61,11 +62,43 @@ private:
 
     bool mClosed;                                           /**< Whether we've already closed the file. */
 
+    /** Maximum size in bytes of #mTimeSeriesCache (zero disables the cache). */
+    unsigned mTimeSeriesCacheMaxBytes;
+
+    /** Width in the node dimension of the chunks of the main dataset (zero if it is not chunked). */
+    hsize_t mChunkWidthInNodes;
+
+    /** The first dataset row (node) held in #mTimeSeriesCache. */
+    unsigned mTimeSeriesCacheLow;
+
+    /** One past the last dataset row (node) held in #mTimeSeriesCache. */
+    unsigned mTimeSeriesCacheHigh;
+
+    /**
+     * Time series of every variable over a block of nodes, stored node-major: the value of
+     * column c at row mTimeSeriesCacheLow+i and time step t is entry
+     * (i*(number of variables) + c)*(number of time steps) + t.
+     */
+    std::vector<double> mTimeSeriesCache;
+
     /**
      * Contains functionality common to both constructors.
      */
     void CommonConstructor();
 
+    /**
+     * Fill #mTimeSeriesCache with the time series of all variables over the block of rows
+     * containing a given row, in a single read.
+     *
+     * The block is as wide as a chunk of the main dataset in the node dimension (so it is read
+     * from the same chunks as the single row would be), limited by #mTimeSeriesCacheMaxBytes,
+     * and aligned to a multiple of its width. All variables are read since chunks span every
+     * variable, so that interleaved queries for different variables don't re-read the block.
+     *
+     * @param rowIndex  the row (node index within the dataset) that must be in the block
+     */
+    void FillTimeSeriesCache(unsigned rowIndex);
+
 public:
 
     /**
@@ -96,6 +129,14 @@ public:
     /**
      * @return the values of a given variable at each time step at a given node.
      *
+     * With the default chunking, which suits writing one time step at a time, reading one
+     * node over all time steps touches as many chunks as reading every node in those chunks.
+     * So the time series of every variable over the whole chunk-wide block of nodes are read
+     * at once, transposed and cached, and queries for the other nodes and variables of the
+     * block (for example when looping over nodes, as PropagationPropertiesCalculator does)
+     * are served from memory. See
+     * SetTimeSeriesCacheLimit().
+     *
      * @param rVariableName  name of a variable in the data file
      * @param nodeIndex the index of the node for which the data is obtained
      */
@@ -122,6 +163,20 @@ public:
      */
     void GetVariableOverNodes(Vec data, const std::string& rVariableName, unsigned timestep=0);
 
+    /**
+     * Set the maximum memory used to cache time series read by GetVariableOverTime().
+     * The default is 64 MB. A limit too small to hold the time series of every variable at
+     * one node disables the cache.
+     *
+     * @param maxBytes  the maximum size of the cache, in bytes
+     */
+    void SetTimeSeriesCacheLimit(unsigned maxBytes);
+
+    /**
+     * @return the number of nodes whose time series are currently cached.
+     */
+    unsigned GetNumberOfCachedTimeSeries() const;
+
     /**
      * @return the unlimited dimension values.
      */
@@ -0,0 +1,136 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTHDF5BENCHMARKS_HPP_
+#define TESTHDF5BENCHMARKS_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include <sstream>
+
+#include "BenchmarkRecorder.hpp"
+#include "DistributedVectorFactory.hpp"
+#include "Hdf5DataWriter.hpp"
+#include "PetscTools.hpp"
+
+#include "PetscSetupAndFinalize.hpp"
+
+/**
+ * Benchmarks of writing simulation output to HDF5, for tracking performance and scaling.
+ *
+ * Problem sizes are taken from the command line:
+ *   -benchmark_size N   number of nodes, in thousands (default 100)
+ *   -benchmark_steps T  number of output time steps (default 100)
+ *
+ * Results are written to $CHASTE_TEST_OUTPUT/Benchmarks/io.json
+ * (see BenchmarkRecorder for how to change this).
+ */
+class TestHdf5Benchmarks : public CxxTest::TestSuite
+{
+private:
+    /** Records the timings of all the benchmarks in this suite. */
+    BenchmarkRecorder mRecorder;
+
+    /**
+     * Time writing a number of variables per node over many time steps.
+     *
+     * @param rName  the benchmark name
+     * @param numVariables  the number of variables to write per node
+     */
+    void RunWriteBenchmark(const std::string& rName, unsigned numVariables)
+    {
+        const unsigned num_nodes = 1000u*BenchmarkRecorder::GetUnsignedOption("-benchmark_size", 100u);
+        const unsigned num_steps = BenchmarkRecorder::GetUnsignedOption("-benchmark_steps", 100u);
+
+        DistributedVectorFactory factory(num_nodes);
+        Vec data = factory.CreateVec(numVariables);
+        VecSet(data, 1.0);
+
+        mRecorder.StartBenchmark(rName);
+        {
+            Hdf5DataWriter writer(factory, "BenchmarkHdf5Output", "results");
+            writer.DefineFixedDimension(num_nodes);
+            std::vector<int> var_ids;
+            for (unsigned i=0; i<numVariables; i++)
+            {
+                std::stringstream name;
+                name << "Var" << i;
+                var_ids.push_back(writer.DefineVariable(name.str(), "mV"));
+            }
+            writer.DefineUnlimitedDimension("Time", "msecs", num_steps);
+            writer.EndDefineMode();
+
+            for (unsigned step=0; step<num_steps; step++)
+            {
+                if (numVariables == 1u)
+                {
+                    writer.PutVector(var_ids[0], data);
+                }
+                else
+                {
+                    writer.PutStripedVector(var_ids, data);
+                }
+                writer.PutUnlimitedVariable(step);
+                writer.AdvanceAlongUnlimitedDimension();
+            }
+            writer.Close();
+        }
+        mRecorder.StopBenchmark();
+        PetscTools::Destroy(data);
+
+        mRecorder.AddParameter("num_nodes", num_nodes);
+        mRecorder.AddParameter("num_steps", num_steps);
+        mRecorder.AddParameter("num_variables", numVariables);
+        mRecorder.WriteJson();
+    }
+
+public:
+    TestHdf5Benchmarks()
+        : mRecorder("io")
+    {
+    }
+
+    void TestWriteOneVariable()
+    {
+        RunWriteBenchmark("Hdf5WriteMonodomain", 1u);
+    }
+
+    void TestWriteStripedVariables()
+    {
+        RunWriteBenchmark("Hdf5WriteBidomain", 2u);
+    }
+};
+
+#endif /*TESTHDF5BENCHMARKS_HPP_*/
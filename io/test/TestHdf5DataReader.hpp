@@ -430,6 +430,71 @@ public:
         reader.Close();
     }
 
+    void TestTimeSeriesCache()
+    {
+        WriteMultiStepData();
+
+        Hdf5DataReader reader("hdf5_reader", "hdf5_test_complete_format");
+        Hdf5DataReader uncached_reader("hdf5_reader", "hdf5_test_complete_format");
+        uncached_reader.SetTimeSeriesCacheLimit(0u);
+
+        TS_ASSERT_EQUALS(reader.GetNumberOfCachedTimeSeries(), 0u);
+
+        // One query caches a block of nodes around the requested one
+        std::vector<double> i_k_values = reader.GetVariableOverTime("I_K", 42);
+        TS_ASSERT_LESS_THAN(1u, reader.GetNumberOfCachedTimeSeries());
+        TS_ASSERT_EQUALS(uncached_reader.GetNumberOfCachedTimeSeries(), 0u);
+
+        // Cached and direct reads agree, whatever order nodes and variables are requested in
+        for (unsigned i=0; i<NUMBER_NODES; i++)
+        {
+            unsigned node_index = (i*37)%NUMBER_NODES;
+            for (unsigned var=0; var<3; var++)
+            {
+                std::string name = (var==0) ? "Node" : ((var==1) ? "I_K" : "I_Na");
+                std::vector<double> cached = reader.GetVariableOverTime(name, node_index);
+                std::vector<double> direct = uncached_reader.GetVariableOverTime(name, node_index);
+                TS_ASSERT_EQUALS(cached.size(), 10u);
+                TS_ASSERT_EQUALS(cached.size(), direct.size());
+                for (unsigned t=0; t<cached.size(); t++)
+                {
+                    TS_ASSERT_EQUALS(cached[t], direct[t]);
+                }
+            }
+        }
+
+        // A limit holding every variable at three nodes caches at most three nodes
+        reader.SetTimeSeriesCacheLimit(3u*3u*10u*sizeof(double));
+        TS_ASSERT_EQUALS(reader.GetNumberOfCachedTimeSeries(), 0u);
+        i_k_values = reader.GetVariableOverTime("I_K", NUMBER_NODES-1);
+        unsigned num_cached = reader.GetNumberOfCachedTimeSeries();
+        TS_ASSERT_LESS_THAN(0u, num_cached);
+        TS_ASSERT_LESS_THAN_EQUALS(num_cached, 3u);
+        for (unsigned t=0; t<i_k_values.size(); t++)
+        {
+            TS_ASSERT_DELTA(i_k_values[t], t*1000 + 100 + NUMBER_NODES-1, 1e-9);
+        }
+
+        // All variables are cached together, so switching variable is served from the same block
+        std::vector<double> i_na_values = reader.GetVariableOverTime("I_Na", NUMBER_NODES-1);
+        TS_ASSERT_EQUALS(reader.GetNumberOfCachedTimeSeries(), num_cached);
+        std::vector<double> i_na_direct = uncached_reader.GetVariableOverTime("I_Na", NUMBER_NODES-1);
+        TS_ASSERT_EQUALS(i_na_values.size(), i_na_direct.size());
+        for (unsigned t=0; t<i_na_values.size(); t++)
+        {
+            TS_ASSERT_EQUALS(i_na_values[t], i_na_direct[t]);
+        }
+
+        // A limit too small for every variable at one node disables the cache
+        reader.SetTimeSeriesCacheLimit(2u*10u*sizeof(double));
+        i_k_values = reader.GetVariableOverTime("I_K", NUMBER_NODES-1);
+        TS_ASSERT_EQUALS(reader.GetNumberOfCachedTimeSeries(), 0u);
+        for (unsigned t=0; t<i_k_values.size(); t++)
+        {
+            TS_ASSERT_DELTA(i_k_values[t], t*1000 + 100 + NUMBER_NODES-1, 1e-9);
+        }
+    }
+
     void TestNonMultiStepExceptions()
     {
         DistributedVectorFactory factory(NUMBER_NODES);
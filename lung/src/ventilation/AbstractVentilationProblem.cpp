@@ -34,6 +34,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "AbstractVentilationProblem.hpp"
+#include <algorithm>
 #include "MathsCustomFunctions.hpp"
 #include "Warnings.hpp"
 #include "AirwayTreeWalker.hpp"
@@ -47,7 +48,8 @@ AbstractVentilationProblem::AbstractVentilationProblem(const std::string& rMeshD
       mDynamicResistance(false),
       mPerGenerationDynamicResistance(false),
       mRadiusOnEdge(false),
-      mNodesInGraphOrder(true)
+      mNodesInGraphOrder(true),
+      mUseTreeSolver(false)
 {
     TrianglesMeshReader<1,3> mesh_reader(rMeshDirFilePath);
     mMesh.ConstructFromMeshReader(mesh_reader);
@@ -201,6 +203,184 @@ double AbstractVentilationProblem::CalculateResistance(Element<1,3>& rElement, b
     }
     return resistance;
 }
+void AbstractVentilationProblem::SetupTreeSolver()
+{
+    unsigned num_elements = mMesh.GetNumElements();
+    unsigned num_nodes = mMesh.GetNumNodes();
+
+    AirwayTreeWalker walker(mMesh, mOutletNodeIndex);
+
+    mTreeProximalNode.resize(num_elements);
+    mTreeDistalNode.resize(num_elements);
+    mTreeEdgeOrientation.resize(num_elements);
+    mTreeEdgeOrder.clear();
+    mTreeEdgeOrder.reserve(num_elements);
+
+    // Breadth-first from the outlet, so that every edge is listed after its parent
+    mTreeEdgeOrder.push_back(walker.GetOutletElementIndex());
+    for (unsigned i=0; i<mTreeEdgeOrder.size(); i++)
+    {
+        unsigned edge_index = mTreeEdgeOrder[i];
+        Element<1,3>* p_element = mMesh.GetElement(edge_index);
+
+        unsigned distal_index = walker.GetDistalNodeIndex(p_element);
+        mTreeDistalNode[edge_index] = distal_index;
+        mTreeProximalNode[edge_index] = p_element->GetNodeGlobalIndex(0) + p_element->GetNodeGlobalIndex(1) - distal_index;
+        mTreeEdgeOrientation[edge_index] = (p_element->GetNodeGlobalIndex(1) == distal_index) ? 1.0 : -1.0;
+
+        std::vector<unsigned> child_indices = walker.GetChildElementIndices(p_element);
+        mTreeEdgeOrder.insert(mTreeEdgeOrder.end(), child_indices.begin(), child_indices.end());
+    }
+
+    if (mTreeEdgeOrder.size() != num_elements)
+    {
+        EXCEPTION("The tree solver requires every edge of the mesh to be reachable from the outlet");
+    }
+
+    mTreeEdgeSlope.resize(num_elements);
+    mTreeEdgeOffset.resize(num_elements);
+    mTreeEdgeFluxIntercept.resize(num_elements);
+    mTreeEdgeFluxGradient.resize(num_elements);
+    mTreeNodeFluxIntercept.resize(num_nodes);
+    mTreeNodeFluxGradient.resize(num_nodes);
+    mTreeNodeHasPressureCondition.resize(num_nodes);
+    mTreeNodePressureCondition.resize(num_nodes);
+}
+
+void AbstractVentilationProblem::SolveTree(std::vector<double>& rFlux, std::vector<double>& rPressure,
+                                           const std::map<unsigned, double>& rPressureConditions)
+{
+    if (mTreeEdgeOrder.empty())
+    {
+        SetupTreeSolver();
+    }
+    unsigned num_nodes = mMesh.GetNumNodes();
+    assert(rFlux.size() == mMesh.GetNumElements());
+    rPressure.resize(num_nodes);
+
+    std::fill(mTreeNodeHasPressureCondition.begin(), mTreeNodeHasPressureCondition.end(), false);
+    for (std::map<unsigned, double>::const_iterator iter = rPressureConditions.begin();
+         iter != rPressureConditions.end();
+         ++iter)
+    {
+        mTreeNodeHasPressureCondition[iter->first] = true;
+        mTreeNodePressureCondition[iter->first] = iter->second;
+    }
+
+    unsigned root_edge = mTreeEdgeOrder[0];
+    bool pressure_given_at_outlet = mTreeNodeHasPressureCondition[mOutletNodeIndex];
+
+    /*
+     * Poiseuille resistance is independent of flux, so a single sweep is exact.  Pedley resistance
+     * grows with sqrt(|flux|), so the pressure drop R*Q has derivative 1.5*R wherever the Pedley
+     * correction is active.  Newton's method converges in a handful of sweeps.
+     */
+    const unsigned max_iterations = mDynamicResistance ? 100u : 1u;
+    bool converged = false;
+    for (unsigned iteration=0; iteration<max_iterations && !converged; iteration++)
+    {
+        // Linearise the pressure drop along each edge about the current flux (measured from proximal to distal)
+        for (unsigned edge_index=0; edge_index<mTreeEdgeOrder.size(); edge_index++)
+        {
+            Element<1,3>& r_element = *(mMesh.GetElement(edge_index));
+            double flux = mTreeEdgeOrientation[edge_index]*rFlux[edge_index];
+            double resistance = CalculateResistance(r_element, mDynamicResistance, flux);
+            double slope = resistance;
+            if (mDynamicResistance && resistance > CalculateResistance(r_element))
+            {
+                slope = 1.5*resistance;
+            }
+            mTreeEdgeSlope[edge_index] = slope;
+            mTreeEdgeOffset[edge_index] = (resistance - slope)*flux;
+        }
+
+        // Sweep from the leaves to the root, writing each flux as a function of the proximal pressure
+        std::fill(mTreeNodeFluxIntercept.begin(), mTreeNodeFluxIntercept.end(), 0.0);
+        std::fill(mTreeNodeFluxGradient.begin(), mTreeNodeFluxGradient.end(), 0.0);
+        for (std::vector<unsigned>::reverse_iterator iter = mTreeEdgeOrder.rbegin();
+             iter != mTreeEdgeOrder.rend();
+             ++iter)
+        {
+            unsigned edge_index = *iter;
+            unsigned distal_index = mTreeDistalNode[edge_index];
+            double slope = mTreeEdgeSlope[edge_index];
+            double offset = mTreeEdgeOffset[edge_index];
+
+            double intercept;
+            double gradient;
+            if (!mMesh.GetNode(distal_index)->IsBoundaryNode())
+            {
+                // Flux balance at the distal node, with its pressure eliminated
+                double denominator = 1.0 + mTreeNodeFluxGradient[distal_index]*slope;
+                intercept = (mTreeNodeFluxIntercept[distal_index] - mTreeNodeFluxGradient[distal_index]*offset)/denominator;
+                gradient = mTreeNodeFluxGradient[distal_index]/denominator;
+            }
+            else if (mTreeNodeHasPressureCondition[distal_index])
+            {
+                intercept = -(mTreeNodePressureCondition[distal_index] + offset)/slope;
+                gradient = 1.0/slope;
+            }
+            else
+            {
+                intercept = mTreeEdgeOrientation[edge_index]*rFlux[edge_index];
+                gradient = 0.0;
+            }
+            mTreeEdgeFluxIntercept[edge_index] = intercept;
+            mTreeEdgeFluxGradient[edge_index] = gradient;
+            mTreeNodeFluxIntercept[mTreeProximalNode[edge_index]] += intercept;
+            mTreeNodeFluxGradient[mTreeProximalNode[edge_index]] += gradient;
+        }
+
+        if (pressure_given_at_outlet)
+        {
+            rPressure[mOutletNodeIndex] = mTreeNodePressureCondition[mOutletNodeIndex];
+        }
+        else
+        {
+            if (mTreeEdgeFluxGradient[root_edge] == 0.0)
+            {
+                EXCEPTION("The tree solver needs a pressure condition at the outlet or at one or more terminals");
+            }
+            double outlet_flux = mTreeEdgeOrientation[root_edge]*rFlux[root_edge];
+            rPressure[mOutletNodeIndex] = (outlet_flux - mTreeEdgeFluxIntercept[root_edge])/mTreeEdgeFluxGradient[root_edge];
+        }
+
+        // Sweep from the root to the leaves, recovering fluxes and pressures
+        double max_flux = 0.0;
+        double max_flux_change = 0.0;
+        for (std::vector<unsigned>::iterator iter = mTreeEdgeOrder.begin();
+             iter != mTreeEdgeOrder.end();
+             ++iter)
+        {
+            unsigned edge_index = *iter;
+            unsigned distal_index = mTreeDistalNode[edge_index];
+            double proximal_pressure = rPressure[mTreeProximalNode[edge_index]];
+            double flux = mTreeEdgeFluxIntercept[edge_index] + mTreeEdgeFluxGradient[edge_index]*proximal_pressure;
+
+            if (mTreeNodeHasPressureCondition[distal_index])
+            {
+                rPressure[distal_index] = mTreeNodePressureCondition[distal_index];
+            }
+            else
+            {
+                rPressure[distal_index] = proximal_pressure - mTreeEdgeOffset[edge_index] - mTreeEdgeSlope[edge_index]*flux;
+            }
+
+            double oriented_flux = mTreeEdgeOrientation[edge_index]*flux;
+            max_flux = std::max(max_flux, fabs(oriented_flux));
+            max_flux_change = std::max(max_flux_change, fabs(oriented_flux - rFlux[edge_index]));
+            rFlux[edge_index] = oriented_flux;
+        }
+
+        converged = !mDynamicResistance || max_flux_change <= 1e-10*max_flux;
+    }
+
+    if (!converged)
+    {
+        EXCEPTION("The tree solver did not converge with dynamic resistance");
+    }
+}
+
 void AbstractVentilationProblem::SetConstantInflowPressures(double pressure)
 {
     for (AbstractTetrahedralMesh<1,3>::BoundaryNodeIterator iter =mMesh.GetBoundaryNodeIteratorBegin();
@@ -35,6 +35,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ABSTRACTVENTILATIONPROBLEM_HPP_
 #define ABSTRACTVENTILATIONPROBLEM_HPP_
 
+#include <map>
 #include "TetrahedralMesh.hpp"
 #include "TimeStepper.hpp"
 #include "VtkMeshWriter.hpp"
@@ -115,6 +116,51 @@ protected:
      */
     bool mNodesInGraphOrder;
 
+    /**
+     * Use the direct tree solver (see SolveTree()) for pressure-driven and mixed boundary conditions.
+     * The default is set by each concrete class.
+     */
+    bool mUseTreeSolver;
+
+    /**
+     * The edges of the tree, ordered so that each edge appears after its parent edge.
+     * Filled on the first call to SolveTree() and reused by all later solves.
+     */
+    std::vector<unsigned> mTreeEdgeOrder;
+
+    /** The node at the proximal (outlet) end of each edge, in edge index ordering. */
+    std::vector<unsigned> mTreeProximalNode;
+
+    /** The node at the distal end of each edge, in edge index ordering. */
+    std::vector<unsigned> mTreeDistalNode;
+
+    /** +1 if node 0 of the edge is its proximal node and -1 otherwise, so that fluxes follow the edge ordering of the mesh. */
+    std::vector<double> mTreeEdgeOrientation;
+
+    /** Work space for SolveTree(): the linearised pressure drop along each edge is mTreeEdgeOffset + mTreeEdgeSlope * flux. */
+    std::vector<double> mTreeEdgeSlope;
+
+    /** Work space for SolveTree(): see #mTreeEdgeSlope. */
+    std::vector<double> mTreeEdgeOffset;
+
+    /** Work space for SolveTree(): the distal flux of each edge is mTreeEdgeFluxIntercept + mTreeEdgeFluxGradient * proximal pressure. */
+    std::vector<double> mTreeEdgeFluxIntercept;
+
+    /** Work space for SolveTree(): see #mTreeEdgeFluxIntercept. */
+    std::vector<double> mTreeEdgeFluxGradient;
+
+    /** Work space for SolveTree(): the sum of #mTreeEdgeFluxIntercept over the child edges of each node. */
+    std::vector<double> mTreeNodeFluxIntercept;
+
+    /** Work space for SolveTree(): the sum of #mTreeEdgeFluxGradient over the child edges of each node. */
+    std::vector<double> mTreeNodeFluxGradient;
+
+    /** Work space for SolveTree(): whether each node has a pressure condition. */
+    std::vector<bool> mTreeNodeHasPressureCondition;
+
+    /** Work space for SolveTree(): the pressure condition at each node (where there is one). */
+    std::vector<double> mTreeNodePressureCondition;
+
     /**
      * Get the resistance of an edge.  This defaults to Poiseuille resistance (in which only the geometry is used.
      * Otherwise, Pedley's correction is calculated, which requires a flux to be given.
@@ -126,6 +172,31 @@ protected:
      * @return the resistance of this element/edge
      */
     double CalculateResistance(Element<1,3>& rElement, bool usePedley=false, double flux=DBL_MAX);
+    /**
+     * Set up the ordering of edges used by SolveTree().  This is called once, on the first solve.
+     */
+    void SetupTreeSolver();
+
+    /**
+     * Solve directly for flux on every edge and pressure at every node, in time proportional to the number of edges.
+     *
+     * Each edge is linearised so that its pressure drop is an affine function of its flux.  A sweep from the
+     * leaves to the root then writes the flux into every edge as an affine function of the pressure at its
+     * proximal node, and a sweep from the root to the leaves recovers the pressures and fluxes.  This is exact
+     * for Poiseuille resistance.  With dynamic (Pedley) resistance the linearisation is Newton's method on the
+     * whole tree, started from the fluxes passed in (typically those from the previous time step).
+     *
+     * Each terminal takes a pressure condition if it has one in rPressureConditions and otherwise takes a flux
+     * condition from rFlux.  The outlet takes a pressure condition if it has one, otherwise its flux condition
+     * is read from rFlux.
+     *
+     * @param rFlux  The flux on each edge in edge index ordering.  On entry this holds flux conditions and an
+     * initial guess, on exit the solution.
+     * @param rPressure  The pressure at each node in node index ordering (the solution on exit)
+     * @param rPressureConditions  Pressure conditions at boundary nodes, keyed by node index
+     */
+    void SolveTree(std::vector<double>& rFlux, std::vector<double>& rPressure, const std::map<unsigned, double>& rPressureConditions);
+
     /**
      * Common code used in all constructors.  Over-ridden in direct solver
      *
@@ -210,6 +281,25 @@ public:
         mDynamicResistance = dynamicResistance;
     }
 
+    /**
+     * Choose whether pressure-driven and mixed boundary conditions are solved with the direct tree
+     * solver (see SolveTree()).
+     *
+     * @param useTreeSolver  the new value of mUseTreeSolver
+     */
+    void SetUseTreeSolver(bool useTreeSolver = true)
+    {
+        mUseTreeSolver = useTreeSolver;
+    }
+
+    /**
+     * @return mUseTreeSolver
+     */
+    bool GetUseTreeSolver() const
+    {
+        return mUseTreeSolver;
+    }
+
     /**
      * Sets a Dirichlet flux boundary condition for a given node.
      *
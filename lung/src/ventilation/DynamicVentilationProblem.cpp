@@ -45,7 +45,8 @@ DynamicVentilationProblem::DynamicVentilationProblem(AbstractAcinarUnitFactory*
                                                                            mSamplingTimeStepMultiple(1u),
                                                                            mCurrentTime(0.0),
                                                                            mRootIndex(rootIndex),
-                                                                           mWriteVtkOutput(false)
+                                                                           mWriteVtkOutput(false),
+                                                                           mDistributeAcinarUnits(false)
 {
     mVentilationProblem.SetOutflowPressure(0.0);
 
@@ -57,7 +58,11 @@ DynamicVentilationProblem::DynamicVentilationProblem(AbstractAcinarUnitFactory*
     {
         if ((*iter)->GetIndex() != rootIndex)
         {
-            mAcinarMap[(*iter)->GetIndex()] = mpAcinarFactory->CreateAcinarUnitForNode((*iter));
+            AbstractAcinarUnit* p_acinar_unit = mpAcinarFactory->CreateAcinarUnitForNode((*iter));
+            mAcinarMap[(*iter)->GetIndex()] = p_acinar_unit;
+            mAcinarUnits.push_back(p_acinar_unit);
+            mTerminalNodeIndices.push_back((*iter)->GetIndex());
+            mTerminalEdgeIndices.push_back(*(*iter)->rGetContainingElementIndices().begin());
         }
     }
 }
@@ -112,6 +117,69 @@ void DynamicVentilationProblem::SetWriteVtkOutput(bool writeVtkOutput)
     mWriteVtkOutput = writeVtkOutput;
 }
 
+void DynamicVentilationProblem::SetDistributeAcinarUnits(bool distributeAcinarUnits)
+{
+    mDistributeAcinarUnits = distributeAcinarUnits;
+}
+
+void DynamicVentilationProblem::GetAcinarVolumes(std::vector<double>& rVolumes)
+{
+    unsigned num_terminals = mAcinarUnits.size();
+    unsigned lo;
+    unsigned hi;
+    GetOwnedTerminalRange(lo, hi);
+
+    std::vector<double> terminal_values(num_terminals);
+    for (unsigned terminal=lo; terminal<hi; terminal++)
+    {
+        terminal_values[terminal] = mAcinarUnits[terminal]->GetVolume();
+    }
+    ReplicateTerminalValues(terminal_values, lo, hi);
+
+    rVolumes.assign(mrMesh.GetNumNodes(), -1);
+    for (unsigned terminal=0; terminal<num_terminals; terminal++)
+    {
+        rVolumes[mTerminalNodeIndices[terminal]] = terminal_values[terminal];
+    }
+}
+
+void DynamicVentilationProblem::GetOwnedTerminalRange(unsigned& rLo, unsigned& rHi)
+{
+    unsigned num_terminals = mAcinarUnits.size();
+    rLo = 0;
+    rHi = num_terminals;
+    if (mDistributeAcinarUnits)
+    {
+        unsigned num_procs = PetscTools::GetNumProcs();
+        unsigned rank = PetscTools::GetMyRank();
+        rLo = (unsigned)(((unsigned long long)num_terminals*rank)/num_procs);
+        rHi = (unsigned)(((unsigned long long)num_terminals*(rank+1))/num_procs);
+    }
+}
+
+void DynamicVentilationProblem::ReplicateTerminalValues(std::vector<double>& rValues, unsigned lo, unsigned hi)
+{
+    if (!mDistributeAcinarUnits || PetscTools::IsSequential() || rValues.empty())
+    {
+        return;
+    }
+
+    unsigned num_procs = PetscTools::GetNumProcs();
+    unsigned num_terminals = rValues.size();
+    std::vector<int> counts(num_procs);
+    std::vector<int> displacements(num_procs);
+    for (unsigned proc=0; proc<num_procs; proc++)
+    {
+        displacements[proc] = (unsigned)(((unsigned long long)num_terminals*proc)/num_procs);
+        counts[proc] = (unsigned)(((unsigned long long)num_terminals*(proc+1))/num_procs) - displacements[proc];
+    }
+    assert(displacements[PetscTools::GetMyRank()] == (int)lo);
+    assert(counts[PetscTools::GetMyRank()] == (int)(hi - lo));
+
+    MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
+                   &rValues[0], &counts[0], &displacements[0], MPI_DOUBLE, PETSC_COMM_WORLD);
+}
+
 void DynamicVentilationProblem::Solve()
 {
     TimeStepper time_stepper(mCurrentTime, mEndTime, mDt);
@@ -126,44 +194,47 @@ void DynamicVentilationProblem::Solve()
     std::vector<double> fluxes(mrMesh.GetNumNodes() - 1, -1);
     std::vector<double> volumes(mrMesh.GetNumNodes(), -1);
 
+    // The block of terminals whose acinar units are updated on this process
+    unsigned num_terminals = mAcinarUnits.size();
+    unsigned lo;
+    unsigned hi;
+    GetOwnedTerminalRange(lo, hi);
+    std::vector<double> terminal_values(num_terminals);
+
     while (!time_stepper.IsTimeAtEnd())
     {
         //Solve coupled problem
-        for (AbstractTetrahedralMesh<1,3>::BoundaryNodeIterator iter = mrMesh.GetBoundaryNodeIteratorBegin();
-                 iter != mrMesh.GetBoundaryNodeIteratorEnd();
-                 ++iter )
+        for (unsigned terminal=lo; terminal<hi; terminal++)
         {
-            if ((*iter)->GetIndex() != mRootIndex)
-            {
-                double pleural_pressure =  mpAcinarFactory->GetPleuralPressureForNode(time_stepper.GetNextTime(), (*iter));
-                mAcinarMap[(*iter)->GetIndex()]->SetPleuralPressure(pleural_pressure);
-                mAcinarMap[(*iter)->GetIndex()]->ComputeExceptFlow(time_stepper.GetTime(), time_stepper.GetNextTime());
+            AbstractAcinarUnit* p_acinar_unit = mAcinarUnits[terminal];
+            double pleural_pressure =  mpAcinarFactory->GetPleuralPressureForNode(time_stepper.GetNextTime(), mrMesh.GetNode(mTerminalNodeIndices[terminal]));
+            p_acinar_unit->SetPleuralPressure(pleural_pressure);
+            p_acinar_unit->ComputeExceptFlow(time_stepper.GetTime(), time_stepper.GetNextTime());
+            terminal_values[terminal] = p_acinar_unit->GetAirwayPressure();
+        }
+        ReplicateTerminalValues(terminal_values, lo, hi);
 
-                mVentilationProblem.SetPressureAtBoundaryNode(*(*iter), mAcinarMap[(*iter)->GetIndex()]->GetAirwayPressure());
-            }
+        for (unsigned terminal=0; terminal<num_terminals; terminal++)
+        {
+            mVentilationProblem.SetPressureAtBoundaryNode(*(mrMesh.GetNode(mTerminalNodeIndices[terminal])), terminal_values[terminal]);
         }
 
         mVentilationProblem.Solve();
         mVentilationProblem.GetSolutionAsFluxesAndPressures(fluxes, pressures);
 
-        for (AbstractTetrahedralMesh<1,3>::BoundaryNodeIterator iter = mrMesh.GetBoundaryNodeIteratorBegin();
-                            iter != mrMesh.GetBoundaryNodeIteratorEnd();
-                            ++iter )
+        for (unsigned terminal=lo; terminal<hi; terminal++)
         {
-            if ((*iter)->GetIndex() != 0u)
-            {
-                unsigned boundary_element_index = (*(*iter)->rGetContainingElementIndices().begin());
+            AbstractAcinarUnit* p_acinar_unit = mAcinarUnits[terminal];
+            double flux = fluxes[mTerminalEdgeIndices[terminal]];
+            p_acinar_unit->SetFlow(flux);
 
-                mAcinarMap[(*iter)->GetIndex()]->SetFlow(fluxes[boundary_element_index]);
-
-                double resistance = 0.0;
-                if (fluxes[boundary_element_index] != 0.0)
-                {
-                    resistance = std::fabs(pressures[(*iter)->GetIndex()]/fluxes[boundary_element_index]);
-                }
-                mAcinarMap[(*iter)->GetIndex()]->SetTerminalBronchioleResistance(resistance);
-                mAcinarMap[(*iter)->GetIndex()]->UpdateFlow(time_stepper.GetTime(), time_stepper.GetNextTime());
+            double resistance = 0.0;
+            if (flux != 0.0)
+            {
+                resistance = std::fabs(pressures[mTerminalNodeIndices[terminal]]/flux);
             }
+            p_acinar_unit->SetTerminalBronchioleResistance(resistance);
+            p_acinar_unit->UpdateFlow(time_stepper.GetTime(), time_stepper.GetNextTime());
         }
 
         if ((time_stepper.GetTotalTimeStepsTaken() % mSamplingTimeStepMultiple) == 0u)
@@ -179,17 +250,7 @@ void DynamicVentilationProblem::Solve()
                 vtk_writer.AddCellData("Flux"+suffix_name.str(), fluxes);
                 vtk_writer.AddPointData("Pressure"+suffix_name.str(), pressures);
 
-
-                for (AbstractTetrahedralMesh<1,3>::BoundaryNodeIterator iter = mrMesh.GetBoundaryNodeIteratorBegin();
-                                                iter != mrMesh.GetBoundaryNodeIteratorEnd();
-                                                ++iter )
-                {
-                    if ((*iter)->GetIndex() != mRootIndex)
-                    {
-                        volumes[(*iter)->GetIndex()] = mAcinarMap[(*iter)->GetIndex()]->GetVolume();
-                    }
-                }
-
+                GetAcinarVolumes(volumes);
                 vtk_writer.AddPointData("Volume"+suffix_name.str(), volumes);
             }
 #endif //CHASTE_VTK
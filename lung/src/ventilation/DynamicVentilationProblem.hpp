@@ -49,6 +49,15 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /**
  * A class for solving dynamic one-dimensional lung ventilation problems in which each terminal of
  * the conducting airway tree is joined to an acinar "balloon" model.
+ *
+ * The airway problem is solved once per time step.  On large trees, calling SetUseTreeSolver() on
+ * rGetMatrixVentilationProblem() replaces the matrix solve with a direct solve on the tree, whose
+ * set up is done on the first time step and reused on every later one.
+ *
+ * The acinar units are held in arrays ordered by terminal, alongside the terminal node and edge
+ * indices, so each time step is a pass over contiguous arrays.  With SetDistributeAcinarUnits() the
+ * terminals are split into contiguous blocks, one per process, and each process only updates the
+ * acinar units in its own block.
  */
 class DynamicVentilationProblem
 {
@@ -127,7 +136,43 @@ public:
      */
     void SetWriteVtkOutput(bool writeVtkOutput = true);
 
+    /**
+     * Tell the solver whether to share the acinar units between processes.  When true each process only
+     * updates the acinar units in its own block of terminals, and the entries of rGetAcinarUnitMap() are
+     * only up to date on the process which owns them; use GetAcinarVolumes() to see every unit.  Defaults to false (every process updates every unit).
+     *
+     * @param distributeAcinarUnits Whether to share the acinar units between processes
+     */
+    void SetDistributeAcinarUnits(bool distributeAcinarUnits = true);
+
+    /**
+     * Get the current volume of every acinar unit, indexed by the boundary node at its terminal.  Entries
+     * for nodes without an acinar unit are set to -1.  The volumes are shared between processes when the
+     * acinar units are distributed, so this must be called collectively.
+     *
+     * @param rVolumes Filled in with the acinar volumes (resized to the number of nodes)
+     */
+    void GetAcinarVolumes(std::vector<double>& rVolumes);
+
 private:
+    /**
+     * Get the block of terminals whose acinar units are updated on this process.
+     *
+     * @param rLo Filled in with the first terminal owned by this process
+     * @param rHi Filled in with one past the last terminal owned by this process
+     */
+    void GetOwnedTerminalRange(unsigned& rLo, unsigned& rHi);
+
+    /**
+     * Share a vector of values, one per terminal, between processes when the acinar units are distributed.
+     * On entry each process holds valid values in its own block; on exit every process holds all values.
+     *
+     * @param rValues The values, in terminal ordering
+     * @param lo The first terminal owned by this process
+     * @param hi One past the last terminal owned by this process
+     */
+    void ReplicateTerminalValues(std::vector<double>& rValues, unsigned lo, unsigned hi);
+
     /**
      * Acinar factory
      */
@@ -143,6 +188,26 @@ private:
      */
     std::map<unsigned, AbstractAcinarUnit*> mAcinarMap;
 
+    /**
+     * The acinar units in terminal ordering.  These are the same objects as in #mAcinarMap.
+     */
+    std::vector<AbstractAcinarUnit*> mAcinarUnits;
+
+    /**
+     * The index of the boundary node at each terminal.
+     */
+    std::vector<unsigned> mTerminalNodeIndices;
+
+    /**
+     * The index of the edge which ends at each terminal.
+     */
+    std::vector<unsigned> mTerminalEdgeIndices;
+
+    /**
+     * Whether each process only updates its own block of acinar units.
+     */
+    bool mDistributeAcinarUnits;
+
     /**
      * The airway tree mesh
      */
@@ -70,6 +70,9 @@ MatrixVentilationProblem::MatrixVentilationProblem(const std::string& rMeshDirFi
 #endif
 
     mFluxScaling = 1;//mViscosity;
+
+    mTreeFlux.resize(mMesh.GetNumElements(), 0.0);
+    mTreePressure.resize(mMesh.GetNumNodes(), 0.0);
 }
 
 MatrixVentilationProblem::~MatrixVentilationProblem()
@@ -107,6 +110,8 @@ void MatrixVentilationProblem::SetPressureAtBoundaryNode(const Node<3>& rNode, d
     mpLinearSystem->SetMatrixElement(pressure_index, pressure_index,  1.0);
     mpLinearSystem->SetRhsVectorElement(pressure_index, pressure);
     PetscVecTools::SetElement(mSolution, pressure_index, pressure); // Make a good guess
+
+    mPressureCondition[rNode.GetIndex()] = pressure;
 }
 
 void MatrixVentilationProblem::SetFluxAtBoundaryNode(const Node<3>& rNode, double flux)
@@ -127,6 +132,9 @@ void MatrixVentilationProblem::SetFluxAtBoundaryNode(const Node<3>& rNode, doubl
     mpLinearSystem->SetMatrixElement(pressure_index, edge_index,  1.0);
     mpLinearSystem->SetRhsVectorElement(pressure_index, flux*mFluxScaling);
     PetscVecTools::SetElement(mSolution, edge_index, flux*mFluxScaling); // Make a good guess
+
+    mPressureCondition.erase(rNode.GetIndex());
+    mTreeFlux[edge_index] = flux;
 }
 
 double MatrixVentilationProblem::GetFluxAtOutflow()
@@ -221,6 +229,24 @@ void MatrixVentilationProblem::Assemble(bool dynamicReassemble)
 
 void MatrixVentilationProblem::Solve()
 {
+    if (mUseTreeSolver)
+    {
+        // The tree solve is cheap enough to repeat on every process
+        SolveTree(mTreeFlux, mTreePressure, mPressureCondition);
+
+        unsigned num_elem = mMesh.GetNumElements();
+        for (unsigned i=0; i<num_elem; i++)
+        {
+            PetscVecTools::SetElement(mSolution, i, mTreeFlux[i]*mFluxScaling);
+        }
+        for (unsigned i=0; i<mMesh.GetNumNodes(); i++)
+        {
+            PetscVecTools::SetElement(mSolution, num_elem + i, mTreePressure[i]);
+        }
+        PetscVecTools::Finalise(mSolution);
+        return;
+    }
+
     Assemble();
     mpLinearSystem->AssembleFinalLinearSystem();
     PetscVecTools::Finalise(mSolution);
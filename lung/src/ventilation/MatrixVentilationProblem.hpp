@@ -54,6 +54,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * Solves for pressure at internal nodes and flux on edges
  *
  * In this subclass all node pressures and edge fluxes are solved simultaneously using a direct matrix solution.
+ * Alternatively (see SetUseTreeSolver()) the same system is solved by elimination on the tree, in time
+ * proportional to the number of edges.
  */
 class MatrixVentilationProblem : public AbstractVentilationProblem
 {
@@ -63,6 +65,15 @@ private:
     double mFluxScaling;  /**< In order to keep the pressure and flux solution at a comparable magnitude, so solve for mFluxScaling * flux.  This should be the same scale as Poiseuille resistance (comparable to viscosity).*/
     Vec mSolution; /**< Allow access to the solution of the linear system and use as a guess later */
 
+    /** Pressure boundary conditions, keyed by node index.  Only used by the tree solver. */
+    std::map<unsigned, double> mPressureCondition;
+
+    /** Flux boundary conditions and flux solution in edge index ordering.  Only used by the tree solver. */
+    std::vector<double> mTreeFlux;
+
+    /** Pressure solution in node index ordering.  Only used by the tree solver. */
+    std::vector<double> mTreePressure;
+
 
     /** Assemble the linear system by writing in
      *  * flux balance at the nodes
@@ -140,6 +151,9 @@ public:
      *  * Poiseuille flow in the edges
      *
      *  Solve the linear system
+     *
+     *  If the tree solver is in use then the system is instead solved with SolveTree() and the
+     *  result is copied into the solution vector.
      */
     void Solve();
 
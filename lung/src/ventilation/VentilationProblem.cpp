@@ -70,6 +70,7 @@ void VentilationProblem::Initialise()
 {
     mFlux.resize(mMesh.GetNumElements());
     mPressure.resize(mMesh.GetNumNodes());
+    mUseTreeSolver = true;
     if (mNodesInGraphOrder == false)
     {
         WARNING("Nodes in this mesh do not appear in graph order.  Some solvers may be inefficient.");
@@ -511,7 +512,6 @@ void VentilationProblem::SetPressureAtBoundaryNode(const Node<3>& rNode, double
     {
         EXCEPTION("Boundary conditions cannot be set at internal nodes");
     }
-    assert(mFluxGivenAtInflow == false);
 
     // Store the requirement in a map for the direct solver
     mPressureCondition[rNode.GetIndex()] = pressure;
@@ -535,6 +535,9 @@ void VentilationProblem::SetFluxAtBoundaryNode(const Node<3>& rNode, double flux
     }
     mFluxGivenAtInflow = true;
 
+    // A flux condition replaces any pressure condition previously set at this node
+    mPressureCondition.erase(rNode.GetIndex());
+
     // In a <1,3> mesh a boundary node will be associated with exactly one edge.
     unsigned edge_index = *( rNode.ContainingElementsBegin() );
 
@@ -544,12 +547,21 @@ void VentilationProblem::SetFluxAtBoundaryNode(const Node<3>& rNode, double flux
 
 void VentilationProblem::Solve()
 {
-    if (mFluxGivenAtInflow && !mFluxGivenAtOutflow)
+    bool pressure_given_at_terminals = (mPressureCondition.size() > mPressureCondition.count(mOutletNodeIndex));
+    if (mFluxGivenAtInflow && !mFluxGivenAtOutflow && !pressure_given_at_terminals)
     {
         SolveDirectFromFlux();
     }
+    else if (mUseTreeSolver)
+    {
+        SolveTree(mFlux, mPressure, mPressureCondition);
+    }
     else
     {
+        if (mFluxGivenAtInflow)
+        {
+            EXCEPTION("Mixed pressure and flux boundary conditions are only supported by the tree solver");
+        }
         SolveIterativelyFromPressure();
         //SolveFromPressureWithSnes();
     }
@@ -53,8 +53,10 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * Solves for pressure at internal nodes and flux on edges
  *
  * In this subclass fluxes are propagated up the tree and pressures are propagated down the tree.
- * If pressure boundary conditions are given at the bottom of the tree then this is done iteratively
- * (a KSP matrix solution is used to estimate corrections to the fluxes on the terminal edges).
+ * If pressure boundary conditions are given at the bottom of the tree (or a mixture of pressure and
+ * flux conditions) then by default the direct tree solver SolveTree() is used.  Otherwise (see
+ * SetUseTreeSolver()) this is done iteratively (a KSP matrix solution is used to estimate corrections
+ * to the fluxes on the terminal edges).
  */
 class VentilationProblem : public AbstractVentilationProblem
 {
@@ -249,8 +251,9 @@ public:
 
     /**
      *  Solve the system either
-     *   * directly from fluxes
-     *   * iteratively from pressures
+     *   * directly from fluxes, if every terminal has a flux condition
+     *   * directly with the tree solver, for pressure or mixed conditions
+     *   * iteratively from pressures, if the tree solver has been turned off
      */
     void Solve();
 
@@ -96,6 +96,8 @@ public:
 
     void TestColemanDynamicVentilationSingleAirway()
     {
+        EXIT_IF_PARALLEL; // The direct solvers used by this test (UMFPACK or KLU) are sequential
+
 #if defined(LUNG_USE_UMFPACK) || defined(LUNG_USE_KLU)
         FileFinder mesh_finder("lung/test/data/single_branch", RelativeTo::ChasteSourceRoot);
 
@@ -144,6 +146,8 @@ public:
 
     void TestColemanDynamicVentilationThreeBifurcations()
     {
+        EXIT_IF_PARALLEL; // Only the tree solver test below is run in parallel
+
         FileFinder mesh_finder("lung/test/data/three_bifurcations", RelativeTo::ChasteSourceRoot);
 
         //The three bifurcation mesh defines a fully symmetric three bifurcation airway tree.
@@ -207,8 +211,63 @@ public:
     }
 
 
+    void TestColemanDynamicVentilationThreeBifurcationsWithTreeSolver()
+    {
+        FileFinder mesh_finder("lung/test/data/three_bifurcations", RelativeTo::ChasteSourceRoot);
+
+        // As above, but the airway problem is solved on the tree at every time step
+        double total_compliance = 0.1/98.0665/1e3;
+        double acinar_compliance = total_compliance/4.0;
+        SimpleAcinarUnitFactory<> factory(acinar_compliance, 2400.0);
+
+        double viscosity = 1.92e-5;
+        double terminal_airway_radius = 0.00005;
+        double resistance_per_unit_length = 8*viscosity/(M_PI*SmallPow(terminal_airway_radius, 4));
+        double total_airway_resistance = (0.003 + 0.005/2 + 0.005/4)*resistance_per_unit_length;
+
+        double ode_volume = 0.0;
+
+        DynamicVentilationProblem problem(&factory, mesh_finder.GetAbsolutePath(), 0u);
+        problem.rGetMatrixVentilationProblem().SetOutflowPressure(0.0);
+        problem.rGetMatrixVentilationProblem().SetMeshInMilliMetres();
+        problem.rGetMatrixVentilationProblem().SetUseTreeSolver();
+        problem.SetTimeStep(0.01);
+
+        // Each process only updates its own block of acinar units (every unit when run sequentially)
+        problem.SetDistributeAcinarUnits();
+
+        TimeStepper time_stepper(0.0, 1.0, 0.01);
+
+        while (!time_stepper.IsTimeAtEnd())
+        {
+            double pleural_pressure =  factory.GetPleuralPressureForNode(time_stepper.GetNextTime(), NULL);
+
+            double dt = time_stepper.GetNextTimeStep();
+            ode_volume = (ode_volume - dt*pleural_pressure/total_airway_resistance)/(1 + dt/(total_airway_resistance*total_compliance));
+
+            problem.SetEndTime(time_stepper.GetNextTime());
+            problem.Solve();
+
+            // The volumes are shared between processes, so every acinar unit can be checked on every process
+            std::vector<double> volumes;
+            problem.GetAcinarVolumes(volumes);
+            std::map<unsigned, AbstractAcinarUnit*>& r_acinar_map = problem.rGetAcinarUnitMap();
+            TS_ASSERT_EQUALS(r_acinar_map.size(), 4u);
+            for (std::map<unsigned, AbstractAcinarUnit*>::iterator iter = r_acinar_map.begin();
+                 iter != r_acinar_map.end();
+                 ++iter)
+            {
+                TS_ASSERT_DELTA(ode_volume, volumes[iter->first], 1e-6);
+            }
+
+            time_stepper.AdvanceOneTimeStep();
+        }
+    }
+
     void TestColemanDynamicVentilationOtisBifurcations()
     {
+        EXIT_IF_PARALLEL; // The direct solvers used by this test (UMFPACK or KLU) are sequential
+
 #if defined(LUNG_USE_UMFPACK) || defined(LUNG_USE_KLU)
        FileFinder mesh_finder("lung/test/data/otis_bifurcation", RelativeTo::ChasteSourceRoot);
 
@@ -293,6 +352,8 @@ public:
 
     void TestColemanVsExplicitWithPedley()
     {
+        EXIT_IF_PARALLEL; // The direct solvers used by this test (UMFPACK or KLU) are sequential
+
 #if defined(LUNG_USE_UMFPACK) || defined(LUNG_USE_KLU)
         //This test compares an acinar unit using an explicit coupling scheme against an
         //acinar unit using the Coleman coupling scheme. Both use dynamic (Pedley) airway
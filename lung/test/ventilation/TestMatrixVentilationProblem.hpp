@@ -473,6 +473,41 @@ public:
 //        vtk_writer.AddCellData("Radii", radii);
 //        vtk_writer.WriteFilesUsingMesh(problem.rGetMesh());
     }
+    void TestThreeBifurcationsWithTreeSolver()
+    {
+        MatrixVentilationProblem problem("lung/test/data/three_bifurcations", 0u);
+        TS_ASSERT(!problem.GetUseTreeSolver());
+        problem.SetUseTreeSolver();
+        problem.SetMeshInMilliMetres();
+        problem.SetOutflowPressure(0.0);
+        problem.SetConstantInflowPressures(15.0);
+        problem.Solve();
+
+        std::vector<double> flux, pressure;
+        problem.GetSolutionAsFluxesAndPressures(flux, pressure);
+        TS_ASSERT_DELTA(pressure[0], 0.0, 1e-8); //BC
+        TS_ASSERT_DELTA(pressure[1], 6.66666,   1e-4);
+        TS_ASSERT_DELTA(pressure[2], 12.22223, 1e-4);
+        TS_ASSERT_DELTA(pressure[3], 12.22222, 1e-4);
+        TS_ASSERT_DELTA(pressure[4], 15.0, 1e-8); //BC
+        TS_ASSERT_DELTA(pressure[7], 15.0, 1e-8); //BC
+        TS_ASSERT_DELTA(flux[0], -2.8407e-10 , 1e-13); // (Outflow flux)
+        TS_ASSERT_DELTA(flux[3], -7.102e-11, 1e-13); // (Inflow flux)
+        TS_ASSERT_DELTA(flux[6], -7.102e-11, 1e-13); // (Inflow flux)
+        TS_ASSERT_DELTA(problem.GetFluxAtOutflow(), flux[0], 1e-18);
+
+        // Driving the outlet with the flux found above recovers the outlet pressure
+        problem.SetOutflowFlux(flux[0]);
+        problem.Solve();
+        problem.GetSolutionAsFluxesAndPressures(flux, pressure);
+        TS_ASSERT_DELTA(pressure[0], 0.0, 1e-8);
+        TS_ASSERT_DELTA(pressure[1], 6.66666, 1e-4);
+
+        // The outlet flux cannot be matched if every terminal is driven by flux too
+        problem.SetConstantInflowFluxes(-7.102e-11);
+        TS_ASSERT_THROWS_THIS(problem.Solve(), "The tree solver needs a pressure condition at the outlet or at one or more terminals");
+    }
+
     void TestExceptions()
     {
         TS_ASSERT_THROWS_THIS(MatrixVentilationProblem bad_problem("mesh/test/data/y_branch_3d_mesh", 1u),
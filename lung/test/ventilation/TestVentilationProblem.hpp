@@ -43,6 +43,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "TrianglesMeshReader.hpp"
 #include "PetscSetupAndFinalize.hpp"
 #include "VentilationProblem.hpp"
+#include "MatrixVentilationProblem.hpp"
 #include "Warnings.hpp"
 
 void LinearTimeBCs(AbstractVentilationProblem* pProblem, TimeStepper& rTimeStepper, const Node<3>& rNode)
@@ -523,6 +524,112 @@ public:
             std::cout<<pressure<<"\t"<<flux_poiseuille<<"\t"<<flux_pedley<<"\n";
         }
     }
+    void TestThreeBifurcationsTreeSolverMatchesIterative()
+    {
+        // Poiseuille resistance: the tree solver is the default and is exact
+        VentilationProblem problem("lung/test/data/three_bifurcations", 0u);
+        TS_ASSERT(problem.GetUseTreeSolver());
+        problem.SetMeshInMilliMetres();
+        problem.SetOutflowPressure(0.0);
+        problem.SetConstantInflowPressures(15.0);
+        problem.Solve();
+        std::vector<double> flux, pressure;
+        problem.GetSolutionAsFluxesAndPressures(flux, pressure);
+
+        VentilationProblem iterative_problem("lung/test/data/three_bifurcations", 0u);
+        iterative_problem.SetUseTreeSolver(false);
+        TS_ASSERT(!iterative_problem.GetUseTreeSolver());
+        iterative_problem.SetMeshInMilliMetres();
+        iterative_problem.SetOutflowPressure(0.0);
+        iterative_problem.SetConstantInflowPressures(15.0);
+        iterative_problem.Solve();
+        std::vector<double> iterative_flux, iterative_pressure;
+        iterative_problem.GetSolutionAsFluxesAndPressures(iterative_flux, iterative_pressure);
+
+        for (unsigned i=0; i<pressure.size(); i++)
+        {
+            TS_ASSERT_DELTA(pressure[i], iterative_pressure[i], 1e-4);
+        }
+        for (unsigned i=0; i<flux.size(); i++)
+        {
+            TS_ASSERT_DELTA(flux[i], iterative_flux[i], 1e-14);
+        }
+        TS_ASSERT_DELTA(pressure[1], 6.66666, 1e-4);
+        TS_ASSERT_DELTA(flux[0], -2.8407e-10, 1e-13);
+
+        // Pedley resistance: Newton's method on the tree reproduces the iterative solution
+        problem.SetConstantInflowPressures(150000);
+        problem.SetDynamicResistance();
+        problem.Solve();
+        problem.GetSolutionAsFluxesAndPressures(flux, pressure);
+        TS_ASSERT_DELTA(pressure[0], 0.0, 1e-8); //BC
+        TS_ASSERT_DELTA(pressure[1], 91108.7409, 1e-1);
+        TS_ASSERT_DELTA(pressure[2], 132694.0014, 1e-2);
+        TS_ASSERT_DELTA(pressure[3], 132694.0014, 1e-2);
+        TS_ASSERT_DELTA(pressure[7], 1.5e5, 1e-8); //BC
+        TS_ASSERT_DELTA(flux[6], -4.424511e-7, 1e-11);
+
+        // Solving again starts from the previous solution and gives the same answer
+        std::vector<double> previous_flux = flux;
+        problem.Solve();
+        problem.GetSolutionAsFluxesAndPressures(flux, pressure);
+        for (unsigned i=0; i<flux.size(); i++)
+        {
+            TS_ASSERT_DELTA(flux[i], previous_flux[i], 1e-15);
+        }
+    }
+
+    void TestThreeBifurcationsMixedBoundaryConditions()
+    {
+        // Find the terminal fluxes which correspond to a pressure driven problem
+        VentilationProblem problem("lung/test/data/three_bifurcations", 0u);
+        problem.SetMeshInMilliMetres();
+        problem.SetOutflowPressure(0.0);
+        problem.SetConstantInflowPressures(15.0);
+        problem.Solve();
+        std::vector<double> pressure_driven_flux, pressure_driven_pressure;
+        problem.GetSolutionAsFluxesAndPressures(pressure_driven_flux, pressure_driven_pressure);
+
+        // Swap the pressure conditions on two terminals for the fluxes found above
+        VentilationProblem mixed_problem("lung/test/data/three_bifurcations", 0u);
+        mixed_problem.SetMeshInMilliMetres();
+        mixed_problem.SetOutflowPressure(0.0);
+        mixed_problem.SetConstantInflowPressures(15.0);
+        mixed_problem.SetFluxAtBoundaryNode(*(mixed_problem.rGetMesh().GetNode(6u)), pressure_driven_flux[5]);
+        mixed_problem.SetFluxAtBoundaryNode(*(mixed_problem.rGetMesh().GetNode(7u)), pressure_driven_flux[6]);
+        mixed_problem.Solve();
+        std::vector<double> flux, pressure;
+        mixed_problem.GetSolutionAsFluxesAndPressures(flux, pressure);
+
+        for (unsigned i=0; i<pressure.size(); i++)
+        {
+            TS_ASSERT_DELTA(pressure[i], pressure_driven_pressure[i], 1e-8);
+        }
+        for (unsigned i=0; i<flux.size(); i++)
+        {
+            TS_ASSERT_DELTA(flux[i], pressure_driven_flux[i], 1e-18);
+        }
+
+        // The same conditions solved with the matrix solver
+        MatrixVentilationProblem matrix_problem("lung/test/data/three_bifurcations", 0u);
+        matrix_problem.SetMeshInMilliMetres();
+        matrix_problem.SetOutflowPressure(0.0);
+        matrix_problem.SetConstantInflowPressures(15.0);
+        matrix_problem.SetFluxAtBoundaryNode(*(matrix_problem.rGetMesh().GetNode(6u)), pressure_driven_flux[5]);
+        matrix_problem.SetFluxAtBoundaryNode(*(matrix_problem.rGetMesh().GetNode(7u)), pressure_driven_flux[6]);
+        matrix_problem.Solve();
+        std::vector<double> matrix_flux, matrix_pressure;
+        matrix_problem.GetSolutionAsFluxesAndPressures(matrix_flux, matrix_pressure);
+        for (unsigned i=0; i<pressure.size(); i++)
+        {
+            TS_ASSERT_DELTA(pressure[i], matrix_pressure[i], 1e-4);
+        }
+
+        // Mixed conditions are not supported by the iterative solver
+        mixed_problem.SetUseTreeSolver(false);
+        TS_ASSERT_THROWS_THIS(mixed_problem.Solve(), "Mixed pressure and flux boundary conditions are only supported by the tree solver");
+    }
+
     void TestExceptions()
     {
         TS_ASSERT_THROWS_THIS(VentilationProblem bad_problem("mesh/test/data/y_branch_3d_mesh", 1u),
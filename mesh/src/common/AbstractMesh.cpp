@@ -479,6 +479,11 @@ void AbstractMesh<ELEMENT_DIM, SPACE_DIM>::RefreshMesh()
 {
 }
 
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractMesh<ELEMENT_DIM, SPACE_DIM>::InvalidateGeometryCache()
+{
+}
+
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 bool AbstractMesh<ELEMENT_DIM, SPACE_DIM>::IsMeshChanging() const
 {
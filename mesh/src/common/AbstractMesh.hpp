@@ -430,6 +430,13 @@ public:
      */
     virtual void RefreshMesh();
 
+    /**
+     * Mark any geometric quantities cached by the mesh (such as element volumes) as out
+     * of date. Must be called after node locations have been changed directly rather
+     * than through the mesh. Does nothing by default.
+     */
+    virtual void InvalidateGeometryCache();
+
     /**
      * @return Whether the mesh changes (used in archiving).
      */
@@ -120,7 +120,7 @@ private:
         archive & boost::serialization::base_object<AbstractMesh<ELEMENT_DIM,SPACE_DIM> >(*this);
         archive & mMeshIsLinear;
         // Create a mesh writer pointing to the correct file and directory
-        TrianglesMeshWriter<ELEMENT_DIM,SPACE_DIM> mesh_writer(ArchiveLocationInfo::GetArchiveRelativePath(),
+        TrianglesMeshWriter<ELEMENT_DIM,SPACE_DIM> mesh_writer(ArchiveLocationInfo::GetMeshRelativePath(),
                                                                ArchiveLocationInfo::GetMeshFilename(),
                                                                false);
         // Binary meshes have similar content to the original Triangle/Tetgen format, but take up less space on disk
@@ -136,7 +136,15 @@ private:
             archive & rPermutation;
         }
 
-        if (!this->IsMeshOnDisk() || this->mMeshChangesDuringSimulation)
+        // A static mesh in a shared mesh directory only needs writing by the first archive that uses it
+        // (this is decided by the caller, so that every process agrees on it)
+        bool mesh_already_shared = ArchiveLocationInfo::IsSharedMeshWritten() && !this->mMeshChangesDuringSimulation;
+
+        if (mesh_already_shared)
+        {
+            // Nothing to write
+        }
+        else if (!this->IsMeshOnDisk() || this->mMeshChangesDuringSimulation)
         {
             mesh_writer.WriteFilesUsingMesh(*(const_cast<AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>*>(this)));
         }
@@ -159,7 +167,7 @@ private:
                     FileFinder mesh_folder = mesh_base.GetParent();
                     std::string mesh_leaf_name = mesh_base.GetLeafNameNoExtension();
                     std::vector<FileFinder> mesh_files = mesh_folder.FindMatches(mesh_leaf_name + ".*");
-                    FileFinder dest_dir(ArchiveLocationInfo::GetArchiveDirectory());
+                    FileFinder dest_dir(ArchiveLocationInfo::GetMeshDirectory());
                     BOOST_FOREACH(const FileFinder& r_mesh_file, mesh_files)
                     {
                         FileFinder dest_file(ArchiveLocationInfo::GetMeshFilename() + r_mesh_file.GetExtension(),
@@ -230,7 +238,7 @@ private:
         if (mMeshIsLinear)
         {
             // I am a linear mesh
-            TrianglesMeshReader<ELEMENT_DIM,SPACE_DIM> mesh_reader(ArchiveLocationInfo::GetArchiveDirectory() + ArchiveLocationInfo::GetMeshFilename());
+            TrianglesMeshReader<ELEMENT_DIM,SPACE_DIM> mesh_reader(ArchiveLocationInfo::GetMeshDirectory() + ArchiveLocationInfo::GetMeshFilename());
 
             if (permutation_available)
             {
@@ -242,7 +250,7 @@ private:
         else
         {
             // I am a quadratic mesh and need quadratic information from the reader
-            TrianglesMeshReader<ELEMENT_DIM,SPACE_DIM> mesh_reader(ArchiveLocationInfo::GetArchiveDirectory() + ArchiveLocationInfo::GetMeshFilename(), 2, 2);
+            TrianglesMeshReader<ELEMENT_DIM,SPACE_DIM> mesh_reader(ArchiveLocationInfo::GetMeshDirectory() + ArchiveLocationInfo::GetMeshFilename(), 2, 2);
             this->ConstructFromMeshReader(mesh_reader);
         }
 
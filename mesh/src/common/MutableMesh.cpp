@@ -33,8 +33,11 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
-#include <map>
+#include <algorithm>
+#include <cfloat>
 #include <cstring>
+#include <iterator>
+#include <map>
 
 #include "MutableMesh.hpp"
 #include "OutputFileHandler.hpp"
@@ -50,13 +53,17 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 MutableMesh<ELEMENT_DIM, SPACE_DIM>::MutableMesh()
-    : mAddedNodes(false)
+    : mAddedNodes(false),
+      mUseIncrementalReMesh(false),
+      mForceFullReMesh(false)
 {
     this->mMeshChangesDuringSimulation = true;
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 MutableMesh<ELEMENT_DIM, SPACE_DIM>::MutableMesh(std::vector<Node<SPACE_DIM> *> nodes)
+    : mUseIncrementalReMesh(false),
+      mForceFullReMesh(false)
 {
     this->mMeshChangesDuringSimulation = true;
     Clear();
@@ -297,6 +304,15 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::DeleteElement(unsigned index)
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableMesh<ELEMENT_DIM, SPACE_DIM>::DeleteNodePriorToReMesh(unsigned index)
 {
+    if (CanReMeshIncrementally() && !mForceFullReMesh)
+    {
+        // Remove the node from the triangulation now, as its index may be reused before ReMesh() is called
+        if (this->mNodes[index]->GetNumContainingElements() > 0
+            && !RemoveNodeFromTriangulation(this->mNodes[index]))
+        {
+            mForceFullReMesh = true;
+        }
+    }
     this->mNodes[index]->MarkAsDeleted();
     mDeletedNodeIndices.push_back(index);
 }
@@ -695,6 +711,12 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh(NodeMap& map)
             this->mpDistributedVectorFactory = new DistributedVectorFactory(this->GetNumNodes());
         }
     }
+    if (CanReMeshIncrementally() && !mForceFullReMesh && ReMeshIncrementally(map))
+    {
+        return;
+    }
+    mForceFullReMesh = false;
+
     if (SPACE_DIM == 1)
     {
         // Store the node locations
@@ -811,6 +833,439 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh()
     ReMesh(map);
 }
 
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void MutableMesh<ELEMENT_DIM, SPACE_DIM>::SetUseIncrementalReMesh(bool useIncrementalReMesh)
+{
+    mUseIncrementalReMesh = useIncrementalReMesh;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MutableMesh<ELEMENT_DIM, SPACE_DIM>::GetUseIncrementalReMesh() const
+{
+    return mUseIncrementalReMesh;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MutableMesh<ELEMENT_DIM, SPACE_DIM>::CanReMeshIncrementally() const
+{
+    return mUseIncrementalReMesh && SPACE_DIM == 2 && ELEMENT_DIM == 2;
+}
+
+/**
+ * Helper function for incremental remeshing.
+ *
+ * @param rA location of the first point
+ * @param rB location of the second point
+ * @param rC location of the third point
+ * @return twice the signed area of the triangle ABC, which is positive if the points are anticlockwise
+ */
+template <unsigned SPACE_DIM>
+static double TwiceSignedArea(const c_vector<double, SPACE_DIM>& rA, const c_vector<double, SPACE_DIM>& rB, const c_vector<double, SPACE_DIM>& rC)
+{
+    return (rB[0] - rA[0])*(rC[1] - rA[1]) - (rB[1] - rA[1])*(rC[0] - rA[0]);
+}
+
+/**
+ * Helper function for incremental remeshing.
+ *
+ * @param rA location of the first vertex of an anticlockwise triangle
+ * @param rB location of the second vertex of the triangle
+ * @param rC location of the third vertex of the triangle
+ * @param rD location of a point
+ * @return whether the point lies strictly inside the circumcircle of the triangle, relative to a small tolerance
+ */
+template <unsigned SPACE_DIM>
+static bool IsInCircumcircle(const c_vector<double, SPACE_DIM>& rA, const c_vector<double, SPACE_DIM>& rB,
+                             const c_vector<double, SPACE_DIM>& rC, const c_vector<double, SPACE_DIM>& rD)
+{
+    double adx = rA[0] - rD[0], ady = rA[1] - rD[1];
+    double bdx = rB[0] - rD[0], bdy = rB[1] - rD[1];
+    double cdx = rC[0] - rD[0], cdy = rC[1] - rD[1];
+    double ad = adx*adx + ady*ady;
+    double bd = bdx*bdx + bdy*bdy;
+    double cd = cdx*cdx + cdy*cdy;
+
+    double det = adx*(bdy*cd - bd*cdy) - ady*(bdx*cd - bd*cdx) + ad*(bdx*cdy - bdy*cdx);
+
+    // Scale the tolerance so that (nearly) cocircular points do not cause flips back and forth
+    double scale = std::max(ad, std::max(bd, cd));
+    return det > 1e-12*scale*scale;
+}
+
+/**
+ * Helper function for incremental remeshing.
+ *
+ * @param pElement pointer to an element
+ * @param pNode pointer to a node of the element
+ * @return the local index of the node in the element
+ */
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+static unsigned GetLocalIndexOfNode(const Element<ELEMENT_DIM, SPACE_DIM>* pElement, const Node<SPACE_DIM>* pNode)
+{
+    unsigned local_index = 0;
+    while (pElement->GetNode(local_index) != pNode)
+    {
+        local_index++;
+        assert(local_index < pElement->GetNumNodes());
+    }
+    return local_index;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+Element<ELEMENT_DIM, SPACE_DIM>* MutableMesh<ELEMENT_DIM, SPACE_DIM>::CreateElement(const std::vector<Node<SPACE_DIM>*>& rNodes)
+{
+    unsigned new_elt_index;
+    if (mDeletedElementIndices.empty())
+    {
+        new_elt_index = this->mElements.size();
+    }
+    else
+    {
+        new_elt_index = mDeletedElementIndices.back();
+        mDeletedElementIndices.pop_back();
+    }
+
+    Element<ELEMENT_DIM, SPACE_DIM>* p_new_element = new Element<ELEMENT_DIM, SPACE_DIM>(new_elt_index, rNodes);
+
+    if (new_elt_index == this->mElements.size())
+    {
+        this->mElements.push_back(p_new_element);
+    }
+    else
+    {
+        delete this->mElements[new_elt_index];
+        this->mElements[new_elt_index] = p_new_element;
+    }
+    return p_new_element;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MutableMesh<ELEMENT_DIM, SPACE_DIM>::RemoveNodeFromTriangulation(Node<SPACE_DIM>* pNode)
+{
+    assert(SPACE_DIM == 2 && ELEMENT_DIM == 2);     // LCOV_EXCL_LINE
+
+    // Removing a boundary node changes the convex hull, which we leave to triangle
+    if (pNode->IsBoundaryNode())
+    {
+        return false;
+    }
+
+    // Each (anticlockwise) element containing the node contributes one edge of the polygon surrounding it
+    std::set<unsigned> star_element_indices = pNode->rGetContainingElementIndices();
+    std::map<Node<SPACE_DIM>*, Node<SPACE_DIM>*> next_polygon_node;
+    for (std::set<unsigned>::iterator it = star_element_indices.begin();
+         it != star_element_indices.end();
+         ++it)
+    {
+        Element<ELEMENT_DIM, SPACE_DIM>* p_element = this->mElements[*it];
+        if (TwiceSignedArea<SPACE_DIM>(p_element->GetNode(0)->rGetLocation(), p_element->GetNode(1)->rGetLocation(), p_element->GetNode(2)->rGetLocation()) <= DBL_EPSILON)
+        {
+            // Node movement has inverted the element, so the polygon may not be simple
+            return false;
+        }
+        unsigned local_index = GetLocalIndexOfNode(p_element, pNode);
+        next_polygon_node[p_element->GetNode((local_index+1)%3)] = p_element->GetNode((local_index+2)%3);
+    }
+
+    std::vector<Node<SPACE_DIM>*> polygon;
+    Node<SPACE_DIM>* p_polygon_node = next_polygon_node.begin()->first;
+    do
+    {
+        polygon.push_back(p_polygon_node);
+        typename std::map<Node<SPACE_DIM>*, Node<SPACE_DIM>*>::iterator next_it = next_polygon_node.find(p_polygon_node);
+        if (next_it == next_polygon_node.end() || polygon.size() > star_element_indices.size())
+        {
+            return false;
+        }
+        p_polygon_node = next_it->second;
+    }
+    while (p_polygon_node != polygon[0]);
+
+    if (polygon.size() != star_element_indices.size())
+    {
+        return false;
+    }
+
+    // Triangulate the polygon by repeatedly clipping off a valid ear
+    std::vector<std::vector<Node<SPACE_DIM>*> > new_elements;
+    while (polygon.size() > 3)
+    {
+        unsigned num_vertices = polygon.size();
+        bool found_ear = false;
+        for (unsigned i=0; i<num_vertices && !found_ear; i++)
+        {
+            Node<SPACE_DIM>* p_prev = polygon[(i + num_vertices - 1)%num_vertices];
+            Node<SPACE_DIM>* p_this = polygon[i];
+            Node<SPACE_DIM>* p_next = polygon[(i+1)%num_vertices];
+            if (TwiceSignedArea<SPACE_DIM>(p_prev->rGetLocation(), p_this->rGetLocation(), p_next->rGetLocation()) <= DBL_EPSILON)
+            {
+                continue;
+            }
+
+            // The ear must not contain any other polygon vertex
+            bool is_ear = true;
+            for (unsigned j=0; j<num_vertices && is_ear; j++)
+            {
+                Node<SPACE_DIM>* p_other = polygon[j];
+                if (p_other != p_prev && p_other != p_this && p_other != p_next
+                    && TwiceSignedArea<SPACE_DIM>(p_prev->rGetLocation(), p_this->rGetLocation(), p_other->rGetLocation()) >= 0.0
+                    && TwiceSignedArea<SPACE_DIM>(p_this->rGetLocation(), p_next->rGetLocation(), p_other->rGetLocation()) >= 0.0
+                    && TwiceSignedArea<SPACE_DIM>(p_next->rGetLocation(), p_prev->rGetLocation(), p_other->rGetLocation()) >= 0.0)
+                {
+                    is_ear = false;
+                }
+            }
+
+            if (is_ear)
+            {
+                std::vector<Node<SPACE_DIM>*> ear;
+                ear.push_back(p_prev);
+                ear.push_back(p_this);
+                ear.push_back(p_next);
+                new_elements.push_back(ear);
+                polygon.erase(polygon.begin() + i);
+                found_ear = true;
+            }
+        }
+        if (!found_ear)
+        {
+            return false;
+        }
+    }
+    if (TwiceSignedArea<SPACE_DIM>(polygon[0]->rGetLocation(), polygon[1]->rGetLocation(), polygon[2]->rGetLocation()) <= DBL_EPSILON)
+    {
+        return false;
+    }
+    new_elements.push_back(polygon);
+
+    // Replace the elements surrounding the node; the mesh is only modified from here on
+    for (std::set<unsigned>::iterator it = star_element_indices.begin();
+         it != star_element_indices.end();
+         ++it)
+    {
+        this->mElements[*it]->MarkAsDeleted();
+        mDeletedElementIndices.push_back(*it);
+    }
+    for (unsigned i=0; i<new_elements.size(); i++)
+    {
+        CreateElement(new_elements[i]);
+    }
+    return true;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MutableMesh<ELEMENT_DIM, SPACE_DIM>::ReMeshIncrementally(NodeMap& rMap)
+{
+    assert(SPACE_DIM == 2 && ELEMENT_DIM == 2);     // LCOV_EXCL_LINE
+
+    // There must be an existing triangulation to repair
+    if (GetNumElements() == 0 || GetNumBoundaryElements() == 0)
+    {
+        return false;
+    }
+
+    // Node movement must not have inverted any element
+    for (typename AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ElementIterator elem_iter = this->GetElementIteratorBegin();
+         elem_iter != this->GetElementIteratorEnd();
+         ++elem_iter)
+    {
+        if (TwiceSignedArea<SPACE_DIM>(elem_iter->GetNode(0)->rGetLocation(), elem_iter->GetNode(1)->rGetLocation(), elem_iter->GetNode(2)->rGetLocation()) <= DBL_EPSILON)
+        {
+            return false;
+        }
+    }
+
+    // Deleted nodes must already have been removed from the triangulation
+    for (unsigned i=0; i<mDeletedNodeIndices.size(); i++)
+    {
+        if (this->mNodes[mDeletedNodeIndices[i]]->GetNumContainingElements() > 0)
+        {
+            return false;
+        }
+    }
+
+    /*
+     * The mesh covers the convex hull of the nodes only if its boundary has no reflex corners.
+     * Orient each boundary edge anticlockwise using the element containing it, then check each corner.
+     */
+    std::map<Node<SPACE_DIM>*, Node<SPACE_DIM>*> next_boundary_node;
+    for (typename TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::BoundaryElementIterator b_elem_iter = this->GetBoundaryElementIteratorBegin();
+         b_elem_iter != this->GetBoundaryElementIteratorEnd();
+         ++b_elem_iter)
+    {
+        Node<SPACE_DIM>* p_node_a = (*b_elem_iter)->GetNode(0);
+        Node<SPACE_DIM>* p_node_b = (*b_elem_iter)->GetNode(1);
+
+        std::set<unsigned> shared_elements;
+        std::set_intersection(p_node_a->rGetContainingElementIndices().begin(), p_node_a->rGetContainingElementIndices().end(),
+                              p_node_b->rGetContainingElementIndices().begin(), p_node_b->rGetContainingElementIndices().end(),
+                              std::inserter(shared_elements, shared_elements.begin()));
+        if (shared_elements.size() != 1)
+        {
+            return false;
+        }
+
+        Element<ELEMENT_DIM, SPACE_DIM>* p_element = this->mElements[*(shared_elements.begin())];
+        unsigned local_index_a = GetLocalIndexOfNode(p_element, p_node_a);
+        if (p_element->GetNode((local_index_a+1)%3) == p_node_b)
+        {
+            next_boundary_node[p_node_a] = p_node_b;
+        }
+        else
+        {
+            next_boundary_node[p_node_b] = p_node_a;
+        }
+    }
+    for (typename std::map<Node<SPACE_DIM>*, Node<SPACE_DIM>*>::iterator it = next_boundary_node.begin();
+         it != next_boundary_node.end();
+         ++it)
+    {
+        typename std::map<Node<SPACE_DIM>*, Node<SPACE_DIM>*>::iterator next_it = next_boundary_node.find(it->second);
+        if (next_it == next_boundary_node.end()
+            || TwiceSignedArea<SPACE_DIM>(it->first->rGetLocation(), it->second->rGetLocation(), next_it->second->rGetLocation()) < 0.0)
+        {
+            return false;
+        }
+    }
+
+    // Insert any new nodes by splitting the elements containing them
+    for (unsigned node_index=0; node_index<this->mNodes.size(); node_index++)
+    {
+        Node<SPACE_DIM>* p_node = this->mNodes[node_index];
+        if (p_node->IsDeleted() || p_node->GetNumContainingElements() > 0)
+        {
+            continue;
+        }
+
+        Element<ELEMENT_DIM, SPACE_DIM>* p_containing_element = nullptr;
+        for (typename AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ElementIterator elem_iter = this->GetElementIteratorBegin();
+             elem_iter != this->GetElementIteratorEnd() && p_containing_element == nullptr;
+             ++elem_iter)
+        {
+            const c_vector<double, SPACE_DIM>& r_location = p_node->rGetLocation();
+            double area_0 = TwiceSignedArea<SPACE_DIM>(elem_iter->GetNode(1)->rGetLocation(), elem_iter->GetNode(2)->rGetLocation(), r_location);
+            double area_1 = TwiceSignedArea<SPACE_DIM>(elem_iter->GetNode(2)->rGetLocation(), elem_iter->GetNode(0)->rGetLocation(), r_location);
+            double area_2 = TwiceSignedArea<SPACE_DIM>(elem_iter->GetNode(0)->rGetLocation(), elem_iter->GetNode(1)->rGetLocation(), r_location);
+            if (area_0 > DBL_EPSILON && area_1 > DBL_EPSILON && area_2 > DBL_EPSILON)
+            {
+                p_containing_element = &(*elem_iter);
+            }
+            else if (area_0 >= 0.0 && area_1 >= 0.0 && area_2 >= 0.0)
+            {
+                // The node lies on (or very close to) an edge or another node
+                return false;
+            }
+        }
+        if (p_containing_element == nullptr)
+        {
+            // The node lies outside the mesh
+            return false;
+        }
+
+        Node<SPACE_DIM>* p_node_0 = p_containing_element->GetNode(0);
+        Node<SPACE_DIM>* p_node_1 = p_containing_element->GetNode(1);
+        Node<SPACE_DIM>* p_node_2 = p_containing_element->GetNode(2);
+
+        std::vector<Node<SPACE_DIM>*> nodes;
+        nodes.push_back(p_node_1);
+        nodes.push_back(p_node_2);
+        nodes.push_back(p_node);
+        CreateElement(nodes);
+
+        nodes[0] = p_node_2;
+        nodes[1] = p_node_0;
+        CreateElement(nodes);
+
+        p_containing_element->ReplaceNode(p_node_2, p_node);
+    }
+
+    /*
+     * Restore the Delaunay property by flipping any edge whose opposite node lies inside the
+     * circumcircle of the element on the other side (Lawson's algorithm). Every edge is checked
+     * since any of them may have been affected by node movement.
+     */
+    std::vector<std::pair<Node<SPACE_DIM>*, Node<SPACE_DIM>*> > edges_to_check;
+    for (typename AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ElementIterator elem_iter = this->GetElementIteratorBegin();
+         elem_iter != this->GetElementIteratorEnd();
+         ++elem_iter)
+    {
+        for (unsigned i=0; i<3; i++)
+        {
+            Node<SPACE_DIM>* p_node_a = elem_iter->GetNode(i);
+            Node<SPACE_DIM>* p_node_b = elem_iter->GetNode((i+1)%3);
+            if (p_node_a->GetIndex() < p_node_b->GetIndex())
+            {
+                edges_to_check.push_back(std::make_pair(p_node_a, p_node_b));
+            }
+        }
+    }
+
+    unsigned num_flips = 0;
+    const unsigned max_num_flips = 10*GetNumElements() + 100;
+    while (!edges_to_check.empty())
+    {
+        Node<SPACE_DIM>* p_node_a = edges_to_check.back().first;
+        Node<SPACE_DIM>* p_node_b = edges_to_check.back().second;
+        edges_to_check.pop_back();
+
+        // Find the element in which a->b is anticlockwise, and the element on the other side of the edge
+        Element<ELEMENT_DIM, SPACE_DIM>* p_element_1 = nullptr;
+        Element<ELEMENT_DIM, SPACE_DIM>* p_element_2 = nullptr;
+        for (std::set<unsigned>::const_iterator it = p_node_a->rGetContainingElementIndices().begin();
+             it != p_node_a->rGetContainingElementIndices().end();
+             ++it)
+        {
+            Element<ELEMENT_DIM, SPACE_DIM>* p_element = this->mElements[*it];
+            unsigned local_index_a = GetLocalIndexOfNode(p_element, p_node_a);
+            if (p_element->GetNode((local_index_a+1)%3) == p_node_b)
+            {
+                p_element_1 = p_element;
+            }
+            else if (p_element->GetNode((local_index_a+2)%3) == p_node_b)
+            {
+                p_element_2 = p_element;
+            }
+        }
+        if (p_element_1 == nullptr || p_element_2 == nullptr)
+        {
+            // This is a boundary edge
+            continue;
+        }
+
+        Node<SPACE_DIM>* p_node_c = p_element_1->GetNode((GetLocalIndexOfNode(p_element_1, p_node_b)+1)%3);
+        Node<SPACE_DIM>* p_node_d = p_element_2->GetNode((GetLocalIndexOfNode(p_element_2, p_node_a)+1)%3);
+
+        if (IsInCircumcircle<SPACE_DIM>(p_node_a->rGetLocation(), p_node_b->rGetLocation(), p_node_c->rGetLocation(), p_node_d->rGetLocation()))
+        {
+            // Replace edge a-b by edge c-d, provided that both new elements are valid
+            if (TwiceSignedArea<SPACE_DIM>(p_node_a->rGetLocation(), p_node_d->rGetLocation(), p_node_c->rGetLocation()) <= DBL_EPSILON
+                || TwiceSignedArea<SPACE_DIM>(p_node_d->rGetLocation(), p_node_b->rGetLocation(), p_node_c->rGetLocation()) <= DBL_EPSILON)
+            {
+                continue;
+            }
+            if (++num_flips > max_num_flips)
+            {
+                return false;
+            }
+
+            p_element_1->ReplaceNode(p_node_b, p_node_d);
+            p_element_2->ReplaceNode(p_node_a, p_node_c);
+
+            edges_to_check.push_back(std::make_pair(p_node_a, p_node_c));
+            edges_to_check.push_back(std::make_pair(p_node_c, p_node_b));
+            edges_to_check.push_back(std::make_pair(p_node_b, p_node_d));
+            edges_to_check.push_back(std::make_pair(p_node_d, p_node_a));
+        }
+    }
+
+    // Update the cached Jacobians and remove any deleted nodes and elements
+    this->RefreshJacobianCachedData();
+    mAddedNodes = false;
+    ReIndex(rMap);
+
+    return true;
+}
+
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 std::vector<c_vector<unsigned, 5> > MutableMesh<ELEMENT_DIM, SPACE_DIM>::SplitLongEdges(double cutoffLength)
 {
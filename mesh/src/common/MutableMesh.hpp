@@ -37,6 +37,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define MUTABLEMESH_HPP_
 
 #include "ChasteSerialization.hpp"
+#include "ChasteSerializationVersion.hpp"
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/split_member.hpp>
 
@@ -62,6 +63,7 @@ class MutableMesh : public TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>
     void save(Archive & archive, const unsigned int version) const
     {
         archive & boost::serialization::base_object<TetrahedralMesh<ELEMENT_DIM, SPACE_DIM> >(*this);
+        archive & mUseIncrementalReMesh;
 
         // Assume that the first node is indicative of the rest.
         bool does_have_attributes = this->mNodes[0]->HasNodeAttributes();
@@ -93,6 +95,10 @@ class MutableMesh : public TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>
     void load(Archive & archive, const unsigned int version)
     {
         archive & boost::serialization::base_object<TetrahedralMesh<ELEMENT_DIM, SPACE_DIM> >(*this);
+        if (version >= 1)
+        {
+            archive & mUseIncrementalReMesh;
+        }
 
         bool does_have_attributes;
 
@@ -150,8 +156,60 @@ protected:
     /** Whether any nodes have been added to the mesh. */
     bool mAddedNodes;
 
+    /**
+     * Whether ReMesh() should, in 2D, try to repair the existing Delaunay triangulation
+     * locally before falling back to rebuilding it with triangle (defaults to false).
+     */
+    bool mUseIncrementalReMesh;
+
+    /**
+     * Whether the next call to ReMesh() must rebuild the mesh from scratch, because a node
+     * could not be removed from the triangulation by DeleteNodePriorToReMesh().
+     */
+    bool mForceFullReMesh;
+
+    /**
+     * @return whether ReMesh() and DeleteNodePriorToReMesh() may update the triangulation
+     * in place, which is the case for 2D meshes if SetUseIncrementalReMesh(true) has been
+     * called. Subclasses whose ReMesh() adds temporary nodes before calling ReMesh() on this
+     * class may override this method to always rebuild the mesh.
+     */
+    virtual bool CanReMeshIncrementally() const;
+
 private:
 
+    /**
+     * Try to update a 2D Delaunay triangulation in place, rather than rebuilding it.
+     *
+     * Nodes added since the last remesh are inserted into the triangles containing them,
+     * and edges failing the in-circle test are then flipped until the mesh is Delaunay again.
+     * The attempt fails, leaving the nodes but not the elements valid, if any element has
+     * been inverted by node movement, the boundary is no longer convex, or a new node lies
+     * on an edge or outside the mesh.
+     *
+     * @param rMap is a NodeMap which associates the indices of nodes in the old mesh
+     * with indices of nodes in the new mesh
+     * @return whether the mesh was successfully updated
+     */
+    bool ReMeshIncrementally(NodeMap& rMap);
+
+    /**
+     * Remove an interior node from a 2D triangulation, filling the hole left by the
+     * elements containing it with new elements. The mesh is not modified if this fails.
+     *
+     * @param pNode pointer to the node
+     * @return whether the node was removed
+     */
+    bool RemoveNodeFromTriangulation(Node<SPACE_DIM>* pNode);
+
+    /**
+     * Create an element from the given nodes, reusing the index of a deleted element if possible.
+     *
+     * @param rNodes the nodes of the new element
+     * @return pointer to the new element
+     */
+    Element<ELEMENT_DIM, SPACE_DIM>* CreateElement(const std::vector<Node<SPACE_DIM>*>& rNodes);
+
     /**
      * @return true if the mesh is Voronoi local to the given element.
      * Check whether any neighbouring node is inside the circumsphere of this element.
@@ -272,6 +330,9 @@ public:
      * to a ReMesh() being called. (Thus saves work compared to DeleteNode()
      * function and does not MoveMerge the node and elements).
      *
+     * If incremental remeshing is enabled, an interior node is also removed from
+     * the triangulation here, so that the next ReMesh() need not start from scratch.
+     *
      * @param index The index of the node to delete
      */
     void DeleteNodePriorToReMesh(unsigned index);
@@ -309,7 +370,11 @@ public:
 
 
     /**
-     * Re-mesh a mesh using triangle (via library calls) or tetgen
+     * Re-mesh a mesh using triangle (via library calls) or tetgen.
+     *
+     * If SetUseIncrementalReMesh(true) has been called, a 2D mesh is instead updated by
+     * inserting new nodes and flipping edges, and is only rebuilt with triangle if this fails.
+     *
      * @param map is a NodeMap which associates the indices of nodes in the old mesh
      * with indices of nodes in the new mesh.  This should be created with the correct size (NumAllNodes)
      */
@@ -322,6 +387,18 @@ public:
      */
     void ReMesh();
 
+    /**
+     * Set whether ReMesh() should try to update a 2D mesh incrementally.
+     *
+     * @param useIncrementalReMesh the new value of mUseIncrementalReMesh
+     */
+    void SetUseIncrementalReMesh(bool useIncrementalReMesh);
+
+    /**
+     * @return mUseIncrementalReMesh
+     */
+    bool GetUseIncrementalReMesh() const;
+
 
     /**
      * Find edges in the mesh longer than the given cutoff length and split them creating new elements as required.
@@ -350,6 +427,23 @@ public:
     bool CheckIsVoronoi(double maxPenetration=0.0);
 };
 
+namespace boost {
+namespace serialization {
+/**
+ * Specify a version number for archive backwards compatibility.
+ *
+ * This is how to do BOOST_CLASS_VERSION(MutableMesh, 1)
+ * with a templated class.
+ */
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+struct version<MutableMesh<ELEMENT_DIM, SPACE_DIM> >
+{
+    ///Macro to set the version number of templated archive in known versions of Boost
+    CHASTE_VERSION_CONTENT(1);
+};
+} // namespace serialization
+} // namespace boost
+
 #include "SerializationExportWrapper.hpp"
 EXPORT_TEMPLATE_CLASS_ALL_DIMS(MutableMesh)
 
@@ -327,6 +327,11 @@ void Cylindrical2dMesh::ReMesh(NodeMap& rMap)
     mRightPeriodicBoundaryElementIndices.clear();
 }
 
+bool Cylindrical2dMesh::CanReMeshIncrementally() const
+{
+    return false;
+}
+
 void Cylindrical2dMesh::ReconstructCylindricalMesh()
 {
     /*
@@ -249,6 +249,17 @@ public:
      */
     void ReMesh(NodeMap& rMap);
 
+    /**
+     * Overridden CanReMeshIncrementally() method.
+     *
+     * The parent ReMesh() is called on a mesh extended by mirror and halo nodes, whose
+     * elements are rebuilt from scratch, so a cylindrical mesh is always remeshed in full,
+     * even if SetUseIncrementalReMesh(true) has been called.
+     *
+     * @return false
+     */
+    bool CanReMeshIncrementally() const;
+
     /**
      * Overridden GetVectorFromAtoB() method.
      *
@@ -448,6 +448,11 @@ void Toroidal2dMesh::ReMesh(NodeMap& rMap)
 
 }
 
+bool Toroidal2dMesh::CanReMeshIncrementally() const
+{
+    return false;
+}
+
 void Toroidal2dMesh::ReconstructCylindricalMesh()
 {
     /*
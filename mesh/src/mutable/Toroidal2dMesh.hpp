@@ -277,6 +277,17 @@ public:
      */
     void ReMesh(NodeMap& rMap);
 
+    /**
+     * Overridden CanReMeshIncrementally() method.
+     *
+     * The parent ReMesh() is called on a mesh extended by mirror nodes, whose elements
+     * are rebuilt from scratch, so a toroidal mesh is always remeshed in full,
+     * even if SetUseIncrementalReMesh(true) has been called.
+     *
+     * @return false
+     */
+    bool CanReMeshIncrementally() const;
+
     /**
      * Overridden GetVectorFromAtoB() method.
      *
@@ -33,6 +33,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#include <algorithm>
 #include "DistanceMapCalculator.hpp"
 #include "DistributedTetrahedralMesh.hpp" // For dynamic cast
 
@@ -41,7 +42,6 @@ DistanceMapCalculator<ELEMENT_DIM, SPACE_DIM>::DistanceMapCalculator(
             AbstractTetrahedralMesh<ELEMENT_DIM,SPACE_DIM>& rMesh)
     : mrMesh(rMesh),
       mWorkOnEntireMesh(true),
-      mNumHalosPerProcess(nullptr),
       mRoundCounter(0u),
       mPopCounter(0u),
       mTargetNodeIndex(UINT_MAX),
@@ -63,13 +63,8 @@ DistanceMapCalculator<ELEMENT_DIM, SPACE_DIM>::DistanceMapCalculator(
         mLo = mrMesh.GetDistributedVectorFactory()->GetLow();
         mHi = mrMesh.GetDistributedVectorFactory()->GetHigh();
 
-        // Get local halo information
-        p_distributed_mesh->GetHaloNodeIndices(mHaloNodeIndices);
-
-        // Share information on the number of halo nodes
-        unsigned my_size = mHaloNodeIndices.size();
-        mNumHalosPerProcess = new unsigned[PetscTools::GetNumProcs()];
-        MPI_Allgather(&my_size, 1, MPI_UNSIGNED, mNumHalosPerProcess, 1, MPI_UNSIGNED, PETSC_COMM_WORLD);
+        // Ownership ranges are contiguous, so these tell us which process owns each halo node
+        mProcessLows = mrMesh.GetDistributedVectorFactory()->rGetGlobalLows();
     }
 }
 
@@ -84,6 +79,7 @@ void DistanceMapCalculator<ELEMENT_DIM, SPACE_DIM>::ComputeDistanceMap(
         rNodeDistances[index] = DBL_MAX;
     }
     assert(mActivePriorityNodeIndexQueue.empty());
+    mUpdatedHaloNodes.clear();
 
     if (mSingleTarget)
     {
@@ -148,48 +144,67 @@ bool DistanceMapCalculator<ELEMENT_DIM, SPACE_DIM>::UpdateQueueFromRemote(std::v
         // This update does nowt
         return !mActivePriorityNodeIndexQueue.empty();
     }
-    for (unsigned bcast_process=0; bcast_process<PetscTools::GetNumProcs(); bcast_process++)
+    unsigned num_procs = PetscTools::GetNumProcs();
+
+    // Each improved halo node is sent once, with its latest distance
+    std::sort(mUpdatedHaloNodes.begin(), mUpdatedHaloNodes.end());
+    mUpdatedHaloNodes.erase(std::unique(mUpdatedHaloNodes.begin(), mUpdatedHaloNodes.end()), mUpdatedHaloNodes.end());
+
+    /*
+     * Pack index/distance pairs into a single array of doubles (indices are exact in a double),
+     * grouped by owner.  Since the indices are sorted and ownership ranges are contiguous, the
+     * groups come out in process order.
+     */
+    std::vector<int> send_counts(num_procs, 0);
+    std::vector<double> send_buffer;
+    send_buffer.reserve(2*mUpdatedHaloNodes.size());
+    unsigned owner = 0;
+    for (unsigned i=0; i<mUpdatedHaloNodes.size(); i++)
     {
-        // Process packs cart0/cart1/...euclid/index into a 1-d array
-        double* dist_exchange = new double[ mNumHalosPerProcess[bcast_process] ];
-        unsigned* index_exchange = new unsigned[ mNumHalosPerProcess[bcast_process] ];
-        if (PetscTools::GetMyRank() == bcast_process)
+        unsigned global_index = mUpdatedHaloNodes[i];
+        while (owner+1 < num_procs && global_index >= mProcessLows[owner+1])
         {
-            // Broadcaster fills the array
-            for (unsigned index=0; index<mHaloNodeIndices.size();index++)
-            {
-                dist_exchange[index] = rNodeDistances[mHaloNodeIndices[index]];
-                index_exchange[index] = mHaloNodeIndices[index];
-            }
+            owner++;
         }
+        assert(owner != PetscTools::GetMyRank());
+        send_counts[owner] += 2;
+        send_buffer.push_back(global_index);
+        send_buffer.push_back(rNodeDistances[global_index]);
+    }
+    mUpdatedHaloNodes.clear();
+
+    // Exchange the batch sizes, then the batches themselves
+    std::vector<int> receive_counts(num_procs);
+    MPI_Alltoall(&send_counts[0], 1, MPI_INT, &receive_counts[0], 1, MPI_INT, PETSC_COMM_WORLD);
+
+    std::vector<int> send_displacements(num_procs, 0);
+    std::vector<int> receive_displacements(num_procs, 0);
+    for (unsigned process=1; process<num_procs; process++)
+    {
+        send_displacements[process] = send_displacements[process-1] + send_counts[process-1];
+        receive_displacements[process] = receive_displacements[process-1] + receive_counts[process-1];
+    }
+    std::vector<double> receive_buffer(receive_displacements[num_procs-1] + receive_counts[num_procs-1]);
 
-        /*
-         * Broadcast - this is can be done by casting indices to double and
-         * packing everything into a single array. That would be better for
-         * latency, but this is probably more readable.
-         */
-        MPI_Bcast(dist_exchange, mNumHalosPerProcess[bcast_process], MPI_DOUBLE,
-                  bcast_process, PETSC_COMM_WORLD);
-        MPI_Bcast(index_exchange, mNumHalosPerProcess[bcast_process], MPI_UNSIGNED,
-                  bcast_process, PETSC_COMM_WORLD);
-        if (PetscTools::GetMyRank() != bcast_process)
+    MPI_Alltoallv(send_buffer.data(), &send_counts[0], &send_displacements[0], MPI_DOUBLE,
+                  receive_buffer.data(), &receive_counts[0], &receive_displacements[0], MPI_DOUBLE,
+                  PETSC_COMM_WORLD);
+
+    // Take the updates for the nodes we own
+    for (unsigned i=0; i<receive_buffer.size(); i+=2)
+    {
+        unsigned global_index = static_cast<unsigned>(receive_buffer[i]);
+        double distance = receive_buffer[i+1];
+        assert(mLo<=global_index && global_index<mHi);
+
+        // Is it a better answer?
+        if (distance < rNodeDistances[global_index]*(1.0-2*DBL_EPSILON) )
         {
-            // Receiving process take updates
-            for (unsigned index=0; index<mNumHalosPerProcess[bcast_process];index++)
-            {
-                unsigned global_index=index_exchange[index];
-                // Is it a better answer?
-                if (dist_exchange[index] < rNodeDistances[global_index]*(1.0-2*DBL_EPSILON) )
-                {
-                    // Copy across - this may be unnecessary when PushLocal isn't going to push because it's not local
-                    rNodeDistances[global_index] = dist_exchange[index];
-                    PushLocal(rNodeDistances[global_index], global_index);
-                }
-            }
+            rNodeDistances[global_index] = distance;
+            PushLocal(rNodeDistances[global_index], global_index);
         }
-        delete [] dist_exchange;
-        delete [] index_exchange;
     }
+
     // Is any queue non-empty?
     bool non_empty_queue = PetscTools::ReplicateBool(!mActivePriorityNodeIndexQueue.empty());
     return(non_empty_queue);
@@ -251,6 +266,11 @@ bool DistanceMapCalculator<ELEMENT_DIM, SPACE_DIM>::WorkOnLocalQueue(std::vector
                         {
                             rNodeDistances[neighbour_node_index] = updated_distance;
                             PushLocal(updated_distance, neighbour_node_index);
+                            if (!mWorkOnEntireMesh && !(mLo<=neighbour_node_index && neighbour_node_index<mHi))
+                            {
+                                // A halo node: its owner is told at the next exchange
+                                mUpdatedHaloNodes.push_back(neighbour_node_index);
+                            }
                         }
                     }
                 }
@@ -308,6 +328,7 @@ double DistanceMapCalculator<ELEMENT_DIM, SPACE_DIM>::SingleDistance(unsigned so
     {
         mActivePriorityNodeIndexQueue = std::priority_queue<std::pair<double, unsigned> >();
     }
+    mUpdatedHaloNodes.clear();
 
     return distances[targetNodeIndex];
 }
@@ -64,10 +64,13 @@ private:
     unsigned mHi;
     /** Whether we should work on the entire mesh.  True if sequential.  True is the mesh is a plain TetrahedralMesh.*/
     bool mWorkOnEntireMesh;
-    /** (Only used when mWorkOnEntrireMesh == false).  This forms an array of with the number of halo nodes known by each process.*/
-    unsigned *mNumHalosPerProcess;
-    /** (Only used when mWorkOnEntrireMesh == false).  This is a local cache of halo node indices.*/
-    std::vector<unsigned> mHaloNodeIndices;
+    /** (Only used when mWorkOnEntrireMesh == false).  The first node index owned by each process.*/
+    std::vector<unsigned> mProcessLows;
+    /**
+     * (Only used when mWorkOnEntrireMesh == false).  Halo nodes whose distance has improved locally
+     * since the last exchange (possibly with repeats).  Only these are sent, and only to their owners.
+     */
+    std::vector<unsigned> mUpdatedHaloNodes;
     /** Used to check parallel implementation*/
     unsigned mRoundCounter;
     /** Used to check implementation for number of queue pops per calculation*/
@@ -100,6 +103,10 @@ private:
     /**
      * Update the local Queue of node indices using data that are from the halo nodes of remote processes.
      *
+     * Each process sends the halo distances it has improved during the last round directly to the
+     * processes owning those nodes, in one batch per neighbouring process (a single all-to-all exchange),
+     * rather than broadcasting every halo value to every process.
+     *
      * @param rNodeDistances distance map computed
      *
      * @return true when this update was active => there are non-empty queues left to work on
@@ -133,14 +140,6 @@ public:
      */
     DistanceMapCalculator(AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>& rMesh);
 
-     /**
-     * Destructor - cleans up mNumHalosPerProcess (which is normally set to NULL anyway).
-     */
-    ~DistanceMapCalculator()
-    {
-        delete [] mNumHalosPerProcess;
-    }
-
     /**
      *  Generates a distance map of all the nodes of the mesh to the given source
      *
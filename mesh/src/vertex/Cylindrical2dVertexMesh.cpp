@@ -348,6 +348,11 @@ double Cylindrical2dVertexMesh::GetWidth(const unsigned& rDimension) const
     return width;
 }
 
+bool Cylindrical2dVertexMesh::HasPeriodicGeometry() const
+{
+    return true;
+}
+
 unsigned Cylindrical2dVertexMesh::AddNode(Node<2>* pNewNode)
 {
     CheckNodeLocation(pNewNode);
@@ -89,6 +89,13 @@ private:
      */
     Cylindrical2dVertexMesh();
 
+    /**
+     * Overridden HasPeriodicGeometry() method.
+     *
+     * @return true, since this mesh is periodic.
+     */
+    bool HasPeriodicGeometry() const;
+
 public:
 
     /**
@@ -383,6 +383,7 @@ unsigned MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::AddElement(VertexElement<ELE
         this->mElements[new_element_index] = pNewElement;
     }
     pNewElement->RegisterWithNodes();
+    this->InvalidateGeometryCache();
     return pNewElement->GetIndex();
 }
 
@@ -390,6 +391,7 @@ template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::SetNode(unsigned nodeIndex, ChastePoint<SPACE_DIM> point)
 {
     this->mNodes[nodeIndex]->SetPoint(point);
+    this->InvalidateGeometryCacheAtNode(nodeIndex);
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -714,6 +716,7 @@ unsigned MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DivideElement(VertexElement<
         }
     }
 
+    this->InvalidateGeometryCache();
     return new_element_index;
 }
 
@@ -739,6 +742,7 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DeleteElementPriorToReMesh(unsig
     // Mark this element as deleted
     this->mElements[index]->MarkAsDeleted();
     mDeletedElementIndices.push_back(index);
+    this->InvalidateGeometryCache();
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -746,6 +750,7 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DeleteNodePriorToReMesh(unsigned
 {
     this->mNodes[index]->MarkAsDeleted();
     mDeletedNodeIndices.push_back(index);
+    this->InvalidateGeometryCache();
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -822,6 +827,7 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DivideEdge(Node<SPACE_DIM>* pNod
         // Add new node to this element
         this->GetElement(*iter)->AddNode(p_new_node, index);
     }
+    this->InvalidateGeometryCache();
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -904,6 +910,13 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh(VertexElementMap& rElemen
 
     if (SPACE_DIM == 2)
     {
+        /*
+         * Swaps change the geometry of elements as they are performed, so any cached element
+         * geometry is bypassed until remeshing is complete.
+         */
+        bool use_geometry_cache = this->mUseGeometryCache;
+        this->mUseGeometryCache = false;
+
         // Make sure the map is big enough
         rElementMap.Resize(this->GetNumAllElements());
 
@@ -935,6 +948,9 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh(VertexElementMap& rElemen
          * (see #2664).
          */
         this->CheckForRosettes();
+
+        this->mUseGeometryCache = use_geometry_cache;
+        this->InvalidateGeometryCache();
     }
     else // 3D
     {
@@ -1132,7 +1148,55 @@ bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckForIntersections()
             }
         }
 
-        // Second: Check intersections only for those nodes and elements within
+        /*
+         * Second: bucket the boundary element centroids into boxes of width slightly greater than
+         * mDistanceForT3SwapChecking, so that each boundary node need only be compared with the
+         * centroids in its own box and the neighbouring boxes. This relies on distances being
+         * Euclidean in the node coordinates, so for periodic meshes every pair is compared.
+         */
+        unsigned num_boundary_elements = boundary_element_indices.size();
+        double box_width = 1.01*mDistanceForT3SwapChecking;
+        bool use_boxes = (!HasPeriodicGeometry()) && (num_boundary_elements > 0) && (box_width > 0.0);
+
+        c_vector<double, SPACE_DIM> box_origin = zero_vector<double>(SPACE_DIM);
+        c_vector<double, SPACE_DIM> num_boxes = zero_vector<double>(SPACE_DIM);
+        std::map<unsigned long long, std::vector<unsigned> > boxes;
+        if (use_boxes)
+        {
+            c_vector<double, SPACE_DIM> box_max = boundary_element_centroids[0];
+            box_origin = boundary_element_centroids[0];
+            for (unsigned i=1; i<num_boundary_elements; i++)
+            {
+                for (unsigned dim=0; dim<SPACE_DIM; dim++)
+                {
+                    box_origin[dim] = std::min(box_origin[dim], boundary_element_centroids[i][dim]);
+                    box_max[dim] = std::max(box_max[dim], boundary_element_centroids[i][dim]);
+                }
+            }
+            for (unsigned dim=0; dim<SPACE_DIM; dim++)
+            {
+                num_boxes[dim] = floor((box_max[dim] - box_origin[dim])/box_width) + 1.0;
+
+                // Avoid an excessive number of boxes when the checking distance is very small
+                use_boxes = use_boxes && (num_boxes[dim] < 1e5);
+            }
+        }
+        if (use_boxes)
+        {
+            // Boxes are labelled by their linear index
+            for (unsigned i=0; i<num_boundary_elements; i++)
+            {
+                unsigned long long linear_index = 0;
+                for (unsigned dim=SPACE_DIM; dim>0; dim--)
+                {
+                    double box_coordinate = floor((boundary_element_centroids[i][dim-1] - box_origin[dim-1])/box_width);
+                    linear_index = linear_index*(unsigned long long)num_boxes[dim-1] + (unsigned long long)box_coordinate;
+                }
+                boxes[linear_index].push_back(i);
+            }
+        }
+
+        // Third: Check intersections only for those nodes and elements within
         // mDistanceForT3SwapChecking within each other (node<-->element centroid)
         for (typename AbstractMesh<ELEMENT_DIM, SPACE_DIM>::NodeIterator node_iter = this->GetNodeIteratorBegin();
                 node_iter != this->GetNodeIteratorEnd();
@@ -1142,14 +1206,62 @@ bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckForIntersections()
             {
                 assert(!(node_iter->IsDeleted()));
 
-                // index in boundary_element_centroids and boundary_element_indices
-                unsigned boundary_element_index = 0;
-                for (std::vector<unsigned>::iterator elem_iter = boundary_element_indices.begin();
-                        elem_iter != boundary_element_indices.end();
-                        ++elem_iter)
+                // Find the positions in boundary_element_indices of the elements that may be close enough to check
+                std::vector<unsigned> candidates;
+                if (use_boxes)
+                {
+                    c_vector<double, SPACE_DIM> node_box_coordinates;
+                    for (unsigned dim=0; dim<SPACE_DIM; dim++)
+                    {
+                        node_box_coordinates[dim] = floor((node_iter->rGetLocation()[dim] - box_origin[dim])/box_width);
+                    }
+
+                    // Loop over the 3^SPACE_DIM boxes around the node's box
+                    unsigned num_neighbouring_boxes = (SPACE_DIM == 1) ? 3 : ((SPACE_DIM == 2) ? 9 : 27);
+                    for (unsigned neighbour=0; neighbour<num_neighbouring_boxes; neighbour++)
+                    {
+                        bool box_exists = true;
+                        unsigned long long linear_index = 0;
+                        for (unsigned dim=SPACE_DIM; dim>0; dim--)
+                        {
+                            unsigned power_of_three = (dim == 1) ? 1 : ((dim == 2) ? 3 : 9);
+                            double box_coordinate = node_box_coordinates[dim-1] + (double)((neighbour/power_of_three)%3) - 1.0;
+                            box_exists = box_exists && (box_coordinate >= 0.0) && (box_coordinate < num_boxes[dim-1]);
+                            if (box_exists)
+                            {
+                                linear_index = linear_index*(unsigned long long)num_boxes[dim-1] + (unsigned long long)box_coordinate;
+                            }
+                        }
+                        if (box_exists)
+                        {
+                            std::map<unsigned long long, std::vector<unsigned> >::iterator box_iter = boxes.find(linear_index);
+                            if (box_iter != boxes.end())
+                            {
+                                candidates.insert(candidates.end(), box_iter->second.begin(), box_iter->second.end());
+                            }
+                        }
+                    }
+
+                    // Check candidates in the same order as an exhaustive search would
+                    std::sort(candidates.begin(), candidates.end());
+                }
+                else
+                {
+                    for (unsigned i=0; i<num_boundary_elements; i++)
+                    {
+                        candidates.push_back(i);
+                    }
+                }
+
+                for (std::vector<unsigned>::iterator candidate_iter = candidates.begin();
+                        candidate_iter != candidates.end();
+                        ++candidate_iter)
                 {
+                    unsigned boundary_element_index = *candidate_iter;
+                    unsigned elem_index = boundary_element_indices[boundary_element_index];
+
                     // Check that the node is not part of this element
-                    if (node_iter->rGetContainingElementIndices().count(*elem_iter) == 0)
+                    if (node_iter->rGetContainingElementIndices().count(elem_index) == 0)
                     {
                         c_vector<double, SPACE_DIM> node_location = node_iter->rGetLocation();
                         c_vector<double, SPACE_DIM> element_centroid = boundary_element_centroids[boundary_element_index];
@@ -1157,15 +1269,13 @@ bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckForIntersections()
 
                         if ( node_element_distance < mDistanceForT3SwapChecking )
                         {
-                            if (this->ElementIncludesPoint(node_iter->rGetLocation(), *elem_iter))
+                            if (this->ElementIncludesPoint(node_iter->rGetLocation(), elem_index))
                             {
-                                this->PerformT3Swap(&(*node_iter), *elem_iter);
+                                this->PerformT3Swap(&(*node_iter), elem_index);
                                 return true;
                             }
                         }
                     }
-                    // increment the boundary element index
-                    boundary_element_index +=1u;
                 }
             }
         }
@@ -1174,6 +1284,12 @@ bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckForIntersections()
     return false;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::HasPeriodicGeometry() const
+{
+    return false;
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::IdentifySwapType(Node<SPACE_DIM>* pNodeA, Node<SPACE_DIM>* pNodeB)
 {
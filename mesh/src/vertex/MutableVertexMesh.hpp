@@ -174,6 +174,16 @@ protected:
      */
     bool CheckForIntersections();
 
+    /**
+     * Helper method for CheckForIntersections().
+     *
+     * @return whether GetVectorFromAtoB() may differ from the difference between two
+     * locations, as in a periodic mesh. If so, candidate node/element pairs for T3 swaps
+     * cannot be found by bucketing node locations, so every pair is checked instead.
+     * Overridden to return true in periodic subclasses.
+     */
+    virtual bool HasPeriodicGeometry() const;
+
     /**
      * Helper method for ReMesh(), called by CheckForSwapsFromShortEdges() when
      * neighbouring nodes in an element have been found to be closer than the mCellRearrangementThreshold
@@ -375,6 +375,11 @@ double Toroidal2dVertexMesh::GetWidth(const unsigned& rDimension) const
     return width;
 }
 
+bool Toroidal2dVertexMesh::HasPeriodicGeometry() const
+{
+    return true;
+}
+
 void Toroidal2dVertexMesh::SetHeight(double height)
 {
     assert(height > 0);
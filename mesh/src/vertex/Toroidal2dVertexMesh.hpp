@@ -90,6 +90,13 @@ private:
         mpMeshForVtk = nullptr;
     }
 
+    /**
+     * Overridden HasPeriodicGeometry() method.
+     *
+     * @return true, since this mesh is periodic.
+     */
+    bool HasPeriodicGeometry() const;
+
 public:
 
     /**
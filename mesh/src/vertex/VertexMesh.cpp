@@ -41,7 +41,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexMesh(std::vector<Node<SPACE_DIM>*> nodes,
                                                std::vector<VertexElement<ELEMENT_DIM, SPACE_DIM>*> vertexElements)
-        : mpDelaunayMesh(nullptr)
+        : mpDelaunayMesh(nullptr),
+          mUseGeometryCache(false),
+          mGeometryCacheIsDirty(true)
 {
 
     // Reset member variables and clear mNodes and mElements
@@ -105,7 +107,9 @@ template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexMesh(std::vector<Node<SPACE_DIM>*> nodes,
                                                std::vector<VertexElement<ELEMENT_DIM - 1, SPACE_DIM>*> faces,
                                                std::vector<VertexElement<ELEMENT_DIM, SPACE_DIM>*> vertexElements)
-        : mpDelaunayMesh(nullptr)
+        : mpDelaunayMesh(nullptr),
+          mUseGeometryCache(false),
+          mGeometryCacheIsDirty(true)
 {
     // Reset member variables and clear mNodes, mFaces and mElements
     Clear();
@@ -149,7 +153,9 @@ VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexMesh(std::vector<Node<SPACE_DIM>*> nod
  */
 template <>
 VertexMesh<2, 2>::VertexMesh(TetrahedralMesh<2, 2>& rMesh, bool isPeriodic, bool isBounded)
-        : mpDelaunayMesh(&rMesh)
+        : mpDelaunayMesh(&rMesh),
+          mUseGeometryCache(false),
+          mGeometryCacheIsDirty(true)
 {
     //Note  !isPeriodic is not used except through polymorphic calls in rMesh
 
@@ -345,7 +351,9 @@ VertexMesh<2, 2>::VertexMesh(TetrahedralMesh<2, 2>& rMesh, bool isPeriodic, bool
  */
 template <>
 VertexMesh<3, 3>::VertexMesh(TetrahedralMesh<3, 3>& rMesh)
-        : mpDelaunayMesh(&rMesh)
+        : mpDelaunayMesh(&rMesh),
+          mUseGeometryCache(false),
+          mGeometryCacheIsDirty(true)
 {
     // Reset member variables and clear mNodes, mFaces and mElements
     Clear();
@@ -574,6 +582,8 @@ template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexMesh()
 {
     mpDelaunayMesh = nullptr;
+    mUseGeometryCache = false;
+    mGeometryCacheIsDirty = true;
     this->mMeshChangesDuringSimulation = false;
     Clear();
 }
@@ -705,6 +715,13 @@ void VertexMesh<ELEMENT_DIM, SPACE_DIM>::Clear()
         delete this->mNodes[i];
     }
     this->mNodes.clear();
+
+    // Discard any cached element geometry
+    mElementGeometryIsDirty.clear();
+    mCachedElementVolumes.clear();
+    mCachedElementSurfaceAreas.clear();
+    mCachedElementCentroids.clear();
+    mGeometryCacheIsDirty = true;
 }
 
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -747,6 +764,20 @@ VertexElement<ELEMENT_DIM - 1, SPACE_DIM>* VertexMesh<ELEMENT_DIM, SPACE_DIM>::G
 
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetCentroidOfElement(unsigned index)
+{
+    if (mUseGeometryCache)
+    {
+        UpdateGeometryCache();
+        if (!mElementGeometryIsDirty[index])
+        {
+            return mCachedElementCentroids[index];
+        }
+    }
+    return CalculateCentroidOfElement(index);
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::CalculateCentroidOfElement(unsigned index)
 {
     VertexElement<ELEMENT_DIM, SPACE_DIM>* p_element = GetElement(index);
     unsigned num_nodes = p_element->GetNumNodes();
@@ -1148,8 +1179,158 @@ c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetVectorFromAto
     return vector;
 }
 
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::SetUseGeometryCache(bool useGeometryCache)
+{
+    mUseGeometryCache = useGeometryCache;
+    InvalidateGeometryCache();
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetUseGeometryCache() const
+{
+    return mUseGeometryCache;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::InvalidateGeometryCache()
+{
+    mElementGeometryIsDirty.assign(mElementGeometryIsDirty.size(), true);
+    mGeometryCacheIsDirty = true;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::RefreshMesh()
+{
+    InvalidateGeometryCache();
+    AbstractMesh<ELEMENT_DIM, SPACE_DIM>::RefreshMesh();
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::InvalidateGeometryCacheAtNode(unsigned nodeIndex)
+{
+    if (mUseGeometryCache)
+    {
+        const std::set<unsigned>& r_containing_elements = this->mNodes[nodeIndex]->rGetContainingElementIndices();
+        for (std::set<unsigned>::const_iterator iter = r_containing_elements.begin();
+             iter != r_containing_elements.end();
+             ++iter)
+        {
+            if (*iter < mElementGeometryIsDirty.size())
+            {
+                mElementGeometryIsDirty[*iter] = true;
+                mGeometryCacheIsDirty = true;
+            }
+        }
+    }
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::UpdateGeometryCache()
+{
+    unsigned num_elements = mElements.size();
+    if (mElementGeometryIsDirty.size() != num_elements)
+    {
+        // Elements have been added or removed, so recompute everything
+        mElementGeometryIsDirty.assign(num_elements, true);
+        mCachedElementVolumes.resize(num_elements);
+        mCachedElementSurfaceAreas.resize(num_elements);
+        mCachedElementCentroids.resize(num_elements);
+        mGeometryCacheIsDirty = true;
+    }
+    if (!mGeometryCacheIsDirty)
+    {
+        return;
+    }
+
+    for (unsigned elem_index = 0; elem_index < num_elements; elem_index++)
+    {
+        VertexElement<ELEMENT_DIM, SPACE_DIM>* p_element = mElements[elem_index];
+        if (!mElementGeometryIsDirty[elem_index] || p_element->IsDeleted())
+        {
+            continue;
+        }
+
+        if (SPACE_DIM == 2)
+        {
+            /*
+             * Accumulate the signed area, centroid and perimeter in one loop over the nodes. The
+             * arithmetic matches that of CalculateVolumeOfElement(), CalculateCentroidOfElement()
+             * and CalculateSurfaceAreaOfElement(), so cached and uncached values are identical.
+             */
+            unsigned num_nodes = p_element->GetNumNodes();
+            c_vector<double, SPACE_DIM> first_node_location = p_element->GetNodeLocation(0);
+            c_vector<double, SPACE_DIM> pos_1 = zero_vector<double>(SPACE_DIM);
+            unsigned this_node_index = p_element->GetNodeGlobalIndex(0);
+
+            double centroid_x = 0.0;
+            double centroid_y = 0.0;
+            double element_signed_area = 0.0;
+            double surface_area = 0.0;
+            for (unsigned local_index = 0; local_index < num_nodes; local_index++)
+            {
+                unsigned next_local_index = (local_index + 1) % num_nodes;
+                c_vector<double, SPACE_DIM> next_node_location = p_element->GetNodeLocation(next_local_index);
+                c_vector<double, SPACE_DIM> pos_2 = GetVectorFromAtoB(first_node_location, next_node_location);
+
+                double signed_area_term = pos_1[0] * pos_2[1] - pos_1[1] * pos_2[0];
+                centroid_x += (pos_1[0] + pos_2[0]) * signed_area_term;
+                centroid_y += (pos_1[1] + pos_2[1]) * signed_area_term;
+                element_signed_area += 0.5 * signed_area_term;
+
+                unsigned next_node_index = p_element->GetNodeGlobalIndex(next_local_index);
+                surface_area += this->GetDistanceBetweenNodes(this_node_index, next_node_index);
+                this_node_index = next_node_index;
+
+                pos_1 = pos_2;
+            }
+
+            // The centroid of a degenerate element is undefined, so leave this element to be computed directly
+            if (element_signed_area == 0.0)
+            {
+                continue;
+            }
+
+            c_vector<double, SPACE_DIM> centroid = first_node_location;
+            centroid(0) += centroid_x / (6.0 * element_signed_area);
+            centroid(1) += centroid_y / (6.0 * element_signed_area);
+
+            mCachedElementVolumes[elem_index] = fabs(element_signed_area);
+            mCachedElementSurfaceAreas[elem_index] = surface_area;
+            mCachedElementCentroids[elem_index] = centroid;
+        }
+        else if (SPACE_DIM == 3)
+        {
+            mCachedElementVolumes[elem_index] = CalculateVolumeOfElement(elem_index);
+            mCachedElementSurfaceAreas[elem_index] = CalculateSurfaceAreaOfElement(elem_index);
+            mCachedElementCentroids[elem_index] = CalculateCentroidOfElement(elem_index);
+        }
+        else
+        {
+            // Volumes are not defined in 1D
+            continue;
+        }
+        mElementGeometryIsDirty[elem_index] = false;
+    }
+    mGeometryCacheIsDirty = false;
+}
+
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 double VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetVolumeOfElement(unsigned index)
+{
+    if (mUseGeometryCache)
+    {
+        UpdateGeometryCache();
+        if (!mElementGeometryIsDirty[index])
+        {
+            return mCachedElementVolumes[index];
+        }
+    }
+    return CalculateVolumeOfElement(index);
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+double VertexMesh<ELEMENT_DIM, SPACE_DIM>::CalculateVolumeOfElement(unsigned index)
 {
     assert(SPACE_DIM == 2 || SPACE_DIM == 3); // LCOV_EXCL_LINE - code will be removed at compile time
 
@@ -1207,6 +1388,20 @@ double VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetVolumeOfElement(unsigned index)
 
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 double VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetSurfaceAreaOfElement(unsigned index)
+{
+    if (mUseGeometryCache)
+    {
+        UpdateGeometryCache();
+        if (!mElementGeometryIsDirty[index])
+        {
+            return mCachedElementSurfaceAreas[index];
+        }
+    }
+    return CalculateSurfaceAreaOfElement(index);
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+double VertexMesh<ELEMENT_DIM, SPACE_DIM>::CalculateSurfaceAreaOfElement(unsigned index)
 {
     assert(SPACE_DIM == 2 || SPACE_DIM == 3); // LCOV_EXCL_LINE - code will be removed at compile time
 
@@ -47,6 +47,7 @@ class VertexMeshWriter;
 #include <boost/serialization/split_member.hpp>
 #include <boost/serialization/vector.hpp>
 #include "ChasteSerialization.hpp"
+#include "ChasteSerializationVersion.hpp"
 
 #include "AbstractMesh.hpp"
 #include "ArchiveLocationInfo.hpp"
@@ -100,6 +101,27 @@ protected:
      */
     TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>* mpDelaunayMesh;
 
+    /**
+     * Whether to cache the volume, surface area and centroid of each element
+     * between node movements. Defaults to false.
+     */
+    bool mUseGeometryCache;
+
+    /** Whether the cached geometry of any element may be out of date. */
+    bool mGeometryCacheIsDirty;
+
+    /** Whether the cached geometry of each element is out of date, indexed by element index. */
+    std::vector<bool> mElementGeometryIsDirty;
+
+    /** Cached element volumes, indexed by element index. */
+    std::vector<double> mCachedElementVolumes;
+
+    /** Cached element surface areas, indexed by element index. */
+    std::vector<double> mCachedElementSurfaceAreas;
+
+    /** Cached element centroids, indexed by element index. */
+    std::vector<c_vector<double, SPACE_DIM> > mCachedElementCentroids;
+
     /**
      * Solve node mapping method. This overridden method is required
      * as it is pure virtual in the base class.
@@ -169,6 +191,55 @@ protected:
      */
     unsigned GetLocalIndexForElementEdgeClosestToPoint(const c_vector<double, SPACE_DIM>& rTestPoint, unsigned elementIndex);
 
+    /**
+     * Compute the centroid of an element directly from the locations of its nodes.
+     * Called by GetCentroidOfElement() and UpdateGeometryCache().
+     *
+     * @param index  the global index of a specified vertex element
+     *
+     * @return the centroid of the element
+     */
+    c_vector<double, SPACE_DIM> CalculateCentroidOfElement(unsigned index);
+
+    /**
+     * Compute the volume of an element directly from the locations of its nodes.
+     * Called by GetVolumeOfElement() and UpdateGeometryCache().
+     *
+     * @param index  the global index of a specified vertex element
+     *
+     * @return the volume of the element
+     */
+    double CalculateVolumeOfElement(unsigned index);
+
+    /**
+     * Compute the surface area of an element directly from the locations of its nodes.
+     * Called by GetSurfaceAreaOfElement() and UpdateGeometryCache().
+     *
+     * @param index  the global index of a specified vertex element
+     *
+     * @return the surface area of the element
+     */
+    double CalculateSurfaceAreaOfElement(unsigned index);
+
+    /**
+     * Recompute the cached volume, surface area and centroid of every element whose
+     * cached geometry is out of date, in a single sweep over the elements. In 2D the
+     * three quantities are accumulated in one loop over each element's nodes.
+     *
+     * Elements whose geometry cannot be cached (deleted or degenerate elements, and
+     * all elements in 1D) are left marked as out of date, so that the Get...OfElement()
+     * methods compute them directly.
+     */
+    void UpdateGeometryCache();
+
+    /**
+     * Mark the cached geometry of each element containing a given node as out of date.
+     * Called when the node is moved.
+     *
+     * @param nodeIndex global index of the node
+     */
+    void InvalidateGeometryCacheAtNode(unsigned nodeIndex);
+
     /** Needed for serialization. */
     friend class boost::serialization::access;
 
@@ -183,6 +254,7 @@ protected:
     void save(Archive& archive, const unsigned int version) const
     {
         archive& boost::serialization::base_object<AbstractMesh<ELEMENT_DIM, SPACE_DIM> >(*this);
+        archive& mUseGeometryCache;
 
         // Create a mesh writer pointing to the correct file and directory
         VertexMeshWriter<ELEMENT_DIM, SPACE_DIM> mesh_writer(ArchiveLocationInfo::GetArchiveRelativePath(),
@@ -201,6 +273,10 @@ protected:
     void load(Archive& archive, const unsigned int version)
     {
         archive& boost::serialization::base_object<AbstractMesh<ELEMENT_DIM, SPACE_DIM> >(*this);
+        if (version >= 1)
+        {
+            archive& mUseGeometryCache;
+        }
 
         VertexMeshReader<ELEMENT_DIM, SPACE_DIM> mesh_reader(ArchiveLocationInfo::GetArchiveDirectory() + ArchiveLocationInfo::GetMeshFilename());
         this->ConstructFromMeshReader(mesh_reader);
@@ -383,6 +459,41 @@ public:
     virtual c_vector<double, SPACE_DIM> GetVectorFromAtoB(const c_vector<double, SPACE_DIM>& rLocationA,
                                                           const c_vector<double, SPACE_DIM>& rLocationB);
 
+    /**
+     * Set whether to cache the volume, surface area and centroid of each element.
+     *
+     * When the cache is used, these quantities are computed for all out-of-date elements
+     * the first time any of them is requested, and are then reused until the element
+     * changes. The cache is updated automatically when nodes are moved using SetNode(),
+     * Scale(), Translate() or Rotate(), and when the mesh connectivity is changed by
+     * MutableVertexMesh. If node locations
+     * are modified directly, for example through Node::rGetModifiableLocation(), then
+     * InvalidateGeometryCache() must be called before the next query.
+     *
+     * @param useGeometryCache whether to use the cache
+     */
+    void SetUseGeometryCache(bool useGeometryCache);
+
+    /**
+     * @return mUseGeometryCache
+     */
+    bool GetUseGeometryCache() const;
+
+    /**
+     * Overridden InvalidateGeometryCache() method.
+     *
+     * Mark the cached geometry of every element as out of date.
+     */
+    virtual void InvalidateGeometryCache();
+
+    /**
+     * Overridden RefreshMesh() method.
+     *
+     * Mark the cached geometry of every element as out of date, since this is called
+     * after nodes have been moved directly, for example by Scale(), Translate() or Rotate().
+     */
+    virtual void RefreshMesh();
+
     /**
      * Get the volume (or area in 2D, or length in 1D) of an element.
      *
@@ -669,6 +780,22 @@ public:
     };
 };
 
+namespace boost
+{
+namespace serialization
+{
+/**
+ * Specify a version number for VertexMesh, to allow mUseGeometryCache to be archived.
+ */
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+struct version<VertexMesh<ELEMENT_DIM, SPACE_DIM> >
+{
+    ///Macro to set the version number of templated archive in known versions of Boost
+    CHASTE_VERSION_CONTENT(1);
+};
+} // namespace serialization
+} // namespace boost
+
 #include "SerializationExportWrapper.hpp"
 EXPORT_TEMPLATE_CLASS_ALL_DIMS(VertexMesh)
 
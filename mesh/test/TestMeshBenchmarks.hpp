@@ -0,0 +1,123 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTMESHBENCHMARKS_HPP_
+#define TESTMESHBENCHMARKS_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include "BenchmarkRecorder.hpp"
+#include "DistributedTetrahedralMesh.hpp"
+#include "OutputFileHandler.hpp"
+#include "TetrahedralMesh.hpp"
+#include "TrianglesMeshReader.hpp"
+#include "TrianglesMeshWriter.hpp"
+
+#include "PetscSetupAndFinalize.hpp"
+
+/**
+ * Benchmarks of reading meshes from disk, for tracking performance and scaling.
+ *
+ * A cube of N x N x N cuboids (6 tetrahedra each) is written in binary triangles
+ * format, then read back. N is taken from the command line option -benchmark_size
+ * (default 20).
+ *
+ * Results are written to $CHASTE_TEST_OUTPUT/Benchmarks/mesh.json
+ * (see BenchmarkRecorder for how to change this).
+ */
+class TestMeshBenchmarks : public CxxTest::TestSuite
+{
+private:
+    /** Records the timings of all the benchmarks in this suite. */
+    BenchmarkRecorder mRecorder;
+
+    /**
+     * Write the cube mesh to disk.
+     *
+     * @return the path of the mesh files, without extension
+     */
+    std::string WriteMesh()
+    {
+        const unsigned size = BenchmarkRecorder::GetUnsignedOption("-benchmark_size", 20u);
+        TetrahedralMesh<3,3> mesh;
+        mesh.ConstructCuboid(size, size, size);
+        TrianglesMeshWriter<3,3> writer("BenchmarkMeshLoad", "cube");
+        writer.SetWriteFilesAsBinary();
+        writer.WriteFilesUsingMesh(mesh);
+
+        OutputFileHandler handler("BenchmarkMeshLoad", false);
+        return handler.GetOutputDirectoryFullPath() + "cube";
+    }
+
+    /**
+     * Time reading the cube mesh into a mesh of the given type.
+     *
+     * @param rName  the benchmark name
+     */
+    template<class MESH>
+    void RunLoadBenchmark(const std::string& rName)
+    {
+        std::string mesh_path = WriteMesh();
+
+        mRecorder.StartBenchmark(rName);
+        TrianglesMeshReader<3,3> reader(mesh_path);
+        MESH mesh;
+        mesh.ConstructFromMeshReader(reader);
+        mRecorder.StopBenchmark();
+
+        mRecorder.AddParameter("size", BenchmarkRecorder::GetUnsignedOption("-benchmark_size", 20u));
+        mRecorder.AddParameter("num_nodes", mesh.GetNumNodes());
+        mRecorder.AddParameter("num_elements", mesh.GetNumElements());
+        mRecorder.WriteJson();
+    }
+
+public:
+    TestMeshBenchmarks()
+        : mRecorder("mesh")
+    {
+    }
+
+    void TestLoadTetrahedralMesh()
+    {
+        RunLoadBenchmark<TetrahedralMesh<3,3> >("LoadTetrahedralMesh");
+    }
+
+    void TestLoadDistributedTetrahedralMesh()
+    {
+        RunLoadBenchmark<DistributedTetrahedralMesh<3,3> >("LoadDistributedTetrahedralMesh");
+    }
+};
+
+#endif /*TESTMESHBENCHMARKS_HPP_*/
@@ -38,8 +38,11 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define TESTMUTABLEMESHREMESH_HPP_
 
 #include <cxxtest/TestSuite.h>
+#include <algorithm>
 #include <cmath>
+#include <set>
 #include "MutableMesh.hpp"
+#include "RandomNumberGenerator.hpp"
 #include "TrianglesMeshReader.hpp"
 
 #include "PetscSetupAndFinalize.hpp"
@@ -56,6 +59,46 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 class TestMutableMeshRemesh : public CxxTest::TestSuite
 {
+private:
+
+    /**
+     * @return the elements of a 2D mesh, each given by its sorted node indices.
+     * @param rMesh the mesh
+     */
+    std::set<std::vector<unsigned> > GetElementNodeIndices(MutableMesh<2,2>& rMesh)
+    {
+        std::set<std::vector<unsigned> > elements;
+        for (MutableMesh<2,2>::ElementIterator elem_iter = rMesh.GetElementIteratorBegin();
+             elem_iter != rMesh.GetElementIteratorEnd();
+             ++elem_iter)
+        {
+            std::vector<unsigned> node_indices;
+            for (unsigned i=0; i<3; i++)
+            {
+                node_indices.push_back(elem_iter->GetNodeGlobalIndex(i));
+            }
+            std::sort(node_indices.begin(), node_indices.end());
+            elements.insert(node_indices);
+        }
+        return elements;
+    }
+
+    /**
+     * @return the elements (as for GetElementNodeIndices()) of a mesh remeshed from scratch, with nodes
+     * at the same locations as those of a given 2D mesh.
+     * @param rMesh the mesh
+     */
+    std::set<std::vector<unsigned> > GetFullyRemeshedElementNodeIndices(MutableMesh<2,2>& rMesh)
+    {
+        std::vector<Node<2>*> nodes;
+        for (unsigned i=0; i<rMesh.GetNumNodes(); i++)
+        {
+            nodes.push_back(new Node<2>(i, rMesh.GetNode(i)->rGetLocation()));
+        }
+        MutableMesh<2,2> full_mesh(nodes);
+        return GetElementNodeIndices(full_mesh);
+    }
+
 public:
 
     /**
@@ -927,6 +970,93 @@ public:
             TS_ASSERT_EQUALS(changeHistory[4][4], UNSIGNED_UNSET);
         }
     }
+
+    void TestIncrementalReMesh2d()
+    {
+        RandomNumberGenerator* p_gen = RandomNumberGenerator::Instance();
+        p_gen->Reseed(0);
+
+        // Create a jittered lattice of nodes in a square
+        std::vector<Node<2>*> nodes;
+        for (unsigned j=0; j<8; j++)
+        {
+            for (unsigned i=0; i<8; i++)
+            {
+                bool is_boundary = (i==0 || j==0 || i==7 || j==7);
+                double x = i + (is_boundary ? 0.0 : 0.4*(p_gen->ranf() - 0.5));
+                double y = j + (is_boundary ? 0.0 : 0.4*(p_gen->ranf() - 0.5));
+                nodes.push_back(new Node<2>(nodes.size(), is_boundary, x, y));
+            }
+        }
+        MutableMesh<2,2> mesh(nodes);
+        TS_ASSERT_EQUALS(mesh.GetUseIncrementalReMesh(), false);
+        mesh.SetUseIncrementalReMesh(true);
+        TS_ASSERT_EQUALS(mesh.GetUseIncrementalReMesh(), true);
+
+        unsigned num_elements = mesh.GetNumElements();
+        unsigned num_boundary_elements = mesh.GetNumBoundaryElements();
+        double area = mesh.GetVolume();
+
+        // Move the interior nodes a little; the mesh is repaired in place, so the nodes are not recreated
+        Node<2>* p_node_0 = mesh.GetNode(0);
+        for (unsigned i=0; i<mesh.GetNumNodes(); i++)
+        {
+            if (!mesh.GetNode(i)->IsBoundaryNode())
+            {
+                c_vector<double, 2>& r_location = mesh.GetNode(i)->rGetModifiableLocation();
+                r_location[0] += 0.2*(p_gen->ranf() - 0.5);
+                r_location[1] += 0.2*(p_gen->ranf() - 0.5);
+            }
+        }
+        NodeMap map(mesh.GetNumNodes());
+        mesh.ReMesh(map);
+
+        TS_ASSERT(map.IsIdentityMap());
+        TS_ASSERT_EQUALS(mesh.GetNode(0), p_node_0);
+        TS_ASSERT_EQUALS(mesh.GetNumElements(), num_elements);
+        TS_ASSERT_EQUALS(mesh.GetNumBoundaryElements(), num_boundary_elements);
+        TS_ASSERT_DELTA(mesh.GetVolume(), area, 1e-10);
+        TS_ASSERT(mesh.CheckIsVoronoi());
+        TS_ASSERT(GetElementNodeIndices(mesh) == GetFullyRemeshedElementNodeIndices(mesh));
+
+        // Delete two interior nodes and add a new node, as for cell death and division
+        mesh.DeleteNodePriorToReMesh(9);
+        mesh.DeleteNodePriorToReMesh(27);
+        c_vector<double, 2> new_location = mesh.GetNode(44)->rGetLocation();
+        new_location[0] += 0.31;
+        new_location[1] += 0.17;
+        unsigned new_index = mesh.AddNode(new Node<2>(0, new_location));
+        TS_ASSERT_EQUALS(new_index, 27u);
+
+        map.Resize(mesh.GetNumAllNodes());
+        map.ResetToIdentity();
+        mesh.ReMesh(map);
+
+        TS_ASSERT_EQUALS(mesh.GetNode(0), p_node_0);
+        TS_ASSERT_EQUALS(mesh.GetNumNodes(), 63u);
+        TS_ASSERT_EQUALS(mesh.GetNumAllNodes(), 63u);
+        TS_ASSERT(map.IsDeleted(9));
+        TS_ASSERT_EQUALS(map.GetNewIndex(8), 8u);
+        TS_ASSERT_EQUALS(map.GetNewIndex(10), 9u);
+        TS_ASSERT_EQUALS(map.GetNewIndex(27), 26u);
+        TS_ASSERT_EQUALS(mesh.GetNumElements(), num_elements - 2);
+        TS_ASSERT_EQUALS(mesh.GetNumAllElements(), num_elements - 2);
+        TS_ASSERT_DELTA(mesh.GetVolume(), area, 1e-10);
+        TS_ASSERT(mesh.CheckIsVoronoi());
+        TS_ASSERT(GetElementNodeIndices(mesh) == GetFullyRemeshedElementNodeIndices(mesh));
+
+        // Moving a node far enough to invert elements causes a full remesh, which recreates the nodes
+        c_vector<double, 2>& r_location = mesh.GetNode(20)->rGetModifiableLocation();
+        r_location[0] += 1.6;
+        map.Resize(mesh.GetNumAllNodes());
+        map.ResetToIdentity();
+        mesh.ReMesh(map);
+
+        TS_ASSERT(map.IsIdentityMap());
+        TS_ASSERT_DIFFERS(mesh.GetNode(0), p_node_0);
+        TS_ASSERT_DELTA(mesh.GetVolume(), area, 1e-10);
+        TS_ASSERT(mesh.CheckIsVoronoi());
+    }
 };
 
 #endif /*TESTMUTABLEMESHREMESH_HPP_*/
@@ -307,6 +307,73 @@ public:
         }
    }
 
+    void TestCylindricalReMeshWithIncrementalReMeshing()
+    {
+        unsigned cells_across = 6;
+        unsigned cells_up = 12;
+        unsigned thickness_of_ghost_layer = 0;
+
+        // Set up two identical meshes, one of which is set to use incremental remeshing
+        CylindricalHoneycombMeshGenerator generator(cells_across, cells_up, thickness_of_ghost_layer);
+        Cylindrical2dMesh* p_mesh = generator.GetCylindricalMesh();
+
+        CylindricalHoneycombMeshGenerator incremental_generator(cells_across, cells_up, thickness_of_ghost_layer);
+        Cylindrical2dMesh* p_incremental_mesh = incremental_generator.GetCylindricalMesh();
+        p_incremental_mesh->SetUseIncrementalReMesh(true);
+        TS_ASSERT_EQUALS(p_incremental_mesh->GetUseIncrementalReMesh(), true);
+
+        // Delete a node, move a node on the periodic boundary and add a new node in both meshes
+        std::vector<Cylindrical2dMesh*> meshes;
+        meshes.push_back(p_mesh);
+        meshes.push_back(p_incremental_mesh);
+        std::vector<NodeMap> maps;
+        for (unsigned i=0; i<meshes.size(); i++)
+        {
+            meshes[i]->DeleteNodePriorToReMesh(15);
+
+            ChastePoint<2> moved_point = meshes[i]->GetNode(24)->GetPoint();
+            moved_point.rGetLocation()[0] -= 0.3;
+            meshes[i]->SetNode(24, moved_point, false);
+
+            c_vector<double, 2> new_location;
+            new_location[0] = 2.3;
+            new_location[1] = 4.1;
+            meshes[i]->AddNode(new Node<2>(0u, new_location));
+
+            NodeMap map(meshes[i]->GetNumAllNodes());
+            meshes[i]->ReMesh(map);
+            maps.push_back(map);
+        }
+
+        /*
+         * A cylindrical mesh is always remeshed in full, since the parent ReMesh() works on a
+         * mesh extended by mirror and halo nodes, so the two meshes should be identical.
+         */
+        TS_ASSERT_EQUALS(p_incremental_mesh->GetNumNodes(), cells_across*cells_up);
+        TS_ASSERT_EQUALS(p_incremental_mesh->GetNumNodes(), p_mesh->GetNumNodes());
+        TS_ASSERT_EQUALS(p_incremental_mesh->GetNumElements(), p_mesh->GetNumElements());
+        TS_ASSERT_EQUALS(p_incremental_mesh->GetNumBoundaryElements(), 1u);
+
+        TS_ASSERT_EQUALS(maps[1].GetSize(), maps[0].GetSize());
+        TS_ASSERT_EQUALS(maps[1].IsDeleted(15), true);
+        for (unsigned i=0; i<maps[0].GetSize(); i++)
+        {
+            if (!maps[0].IsDeleted(i))
+            {
+                TS_ASSERT_EQUALS(maps[1].GetNewIndex(i), maps[0].GetNewIndex(i));
+            }
+        }
+
+        for (unsigned elem_index=0; elem_index<p_mesh->GetNumElements(); elem_index++)
+        {
+            for (unsigned local_index=0; local_index<3; local_index++)
+            {
+                TS_ASSERT_EQUALS(p_incremental_mesh->GetElement(elem_index)->GetNodeGlobalIndex(local_index),
+                                 p_mesh->GetElement(elem_index)->GetNodeGlobalIndex(local_index));
+            }
+        }
+    }
+
     void TestCylindricalReMeshOnSmallMesh()
     {
         unsigned cells_across = 3;
@@ -300,6 +300,49 @@ public:
         }
     }
 
+    void TestRepeatedDistanceMapsAfterSingleDistance()
+    {
+        TrianglesMeshReader<3,3> mesh_reader("mesh/test/data/cube_21_nodes_side/Cube21"); // 5x5x5mm cube (internode distance = 0.25mm)
+
+        DistributedTetrahedralMesh<3,3> parallel_mesh;
+        parallel_mesh.ConstructFromMeshReader(mesh_reader);
+
+        std::vector<unsigned> map_left;
+        for (unsigned index=0; index<parallel_mesh.GetNumNodes(); index++)
+        {
+            try
+            {
+                if (parallel_mesh.GetNode(index)->rGetLocation()[0] + 0.25 < 1e-6)
+                {
+                    map_left.push_back(index);
+                }
+            }
+            catch (Exception&)
+            {
+            }
+        }
+
+        DistanceMapCalculator<3,3> parallel_distance_calculator(parallel_mesh);
+        std::vector<double> first_distances;
+        parallel_distance_calculator.ComputeDistanceMap(map_left, first_distances);
+
+        // Point-to-point distances terminate early, possibly with halo updates still to be sent
+        for (unsigned i=0; i<3; i++)
+        {
+            TS_ASSERT_LESS_THAN(0.0, parallel_distance_calculator.SingleDistance(0u, 9260u - 3000u*i));
+        }
+
+        // ...which must not leak into the next map
+        std::vector<double> second_distances;
+        parallel_distance_calculator.ComputeDistanceMap(map_left, second_distances);
+        TS_ASSERT_EQUALS(second_distances.size(), first_distances.size());
+        for (unsigned index=0; index<first_distances.size(); index++)
+        {
+            TS_ASSERT_DELTA(second_distances[index], first_distances[index], 1e-15);
+            TS_ASSERT_LESS_THAN_EQUALS(second_distances[index], 0.5 + 1e-12);
+        }
+    }
+
     void TestDistancesWithEmptySource()
     {
         TrianglesMeshReader<3,3> mesh_reader("mesh/test/data/cube_21_nodes_side/Cube21"); // 5x5x5mm cube (internode distance = 0.25mm)
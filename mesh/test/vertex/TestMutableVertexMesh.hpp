@@ -1821,6 +1821,108 @@ public:
         TS_ASSERT_EQUALS(new_distance, 10.0);
     }
 
+    void TestGeometryCache()
+    {
+        // Create two identical meshes, only one of which caches element geometry
+        HoneycombVertexMeshGenerator generator(4, 4);
+        MutableVertexMesh<2,2>* p_mesh = generator.GetMesh();
+        HoneycombVertexMeshGenerator uncached_generator(4, 4);
+        MutableVertexMesh<2,2>* p_uncached_mesh = uncached_generator.GetMesh();
+
+        TS_ASSERT_EQUALS(p_mesh->GetUseGeometryCache(), false);
+        p_mesh->SetUseGeometryCache(true);
+        TS_ASSERT_EQUALS(p_mesh->GetUseGeometryCache(), true);
+
+        for (unsigned elem_index=0; elem_index<p_mesh->GetNumElements(); elem_index++)
+        {
+            TS_ASSERT_DELTA(p_mesh->GetVolumeOfElement(elem_index), p_uncached_mesh->GetVolumeOfElement(elem_index), 1e-12);
+            TS_ASSERT_DELTA(p_mesh->GetSurfaceAreaOfElement(elem_index), p_uncached_mesh->GetSurfaceAreaOfElement(elem_index), 1e-12);
+            TS_ASSERT_DELTA(p_mesh->GetCentroidOfElement(elem_index)[0], p_uncached_mesh->GetCentroidOfElement(elem_index)[0], 1e-12);
+            TS_ASSERT_DELTA(p_mesh->GetCentroidOfElement(elem_index)[1], p_uncached_mesh->GetCentroidOfElement(elem_index)[1], 1e-12);
+        }
+
+        // Moving a node with SetNode() updates the geometry of the elements containing it
+        unsigned node_index = 12;
+        ChastePoint<2> point = p_mesh->GetNode(node_index)->GetPoint();
+        point.SetCoordinate(0, point[0] + 0.1);
+        point.SetCoordinate(1, point[1] - 0.05);
+        p_mesh->SetNode(node_index, point);
+        p_uncached_mesh->SetNode(node_index, point);
+
+        for (unsigned elem_index=0; elem_index<p_mesh->GetNumElements(); elem_index++)
+        {
+            TS_ASSERT_DELTA(p_mesh->GetVolumeOfElement(elem_index), p_uncached_mesh->GetVolumeOfElement(elem_index), 1e-12);
+            TS_ASSERT_DELTA(p_mesh->GetSurfaceAreaOfElement(elem_index), p_uncached_mesh->GetSurfaceAreaOfElement(elem_index), 1e-12);
+            TS_ASSERT_DELTA(p_mesh->GetCentroidOfElement(elem_index)[0], p_uncached_mesh->GetCentroidOfElement(elem_index)[0], 1e-12);
+            TS_ASSERT_DELTA(p_mesh->GetCentroidOfElement(elem_index)[1], p_uncached_mesh->GetCentroidOfElement(elem_index)[1], 1e-12);
+        }
+
+        // Moving a node directly is not seen until the cache is invalidated
+        unsigned moved_elem_index = *(p_mesh->GetNode(node_index)->rGetContainingElementIndices().begin());
+        double old_volume = p_mesh->GetVolumeOfElement(moved_elem_index);
+        p_mesh->GetNode(node_index)->rGetModifiableLocation()[0] += 0.05;
+        p_uncached_mesh->GetNode(node_index)->rGetModifiableLocation()[0] += 0.05;
+        TS_ASSERT_DELTA(p_mesh->GetVolumeOfElement(moved_elem_index), old_volume, 1e-12);
+
+        // Invalidate through the generic mesh interface, as OffLatticeSimulation does
+        AbstractMesh<2,2>& r_abstract_mesh = *p_mesh;
+        r_abstract_mesh.InvalidateGeometryCache();
+        TS_ASSERT_DELTA(p_mesh->GetVolumeOfElement(moved_elem_index), p_uncached_mesh->GetVolumeOfElement(moved_elem_index), 1e-12);
+        TS_ASSERT_DIFFERS(p_mesh->GetVolumeOfElement(moved_elem_index), old_volume);
+
+        // Dividing an element adds an element to the cache
+        double old_total_volume = p_mesh->GetVolumeOfElement(5);
+        unsigned new_elem_index = p_mesh->DivideElementAlongShortAxis(p_mesh->GetElement(5), true);
+        p_uncached_mesh->DivideElementAlongShortAxis(p_uncached_mesh->GetElement(5), true);
+        TS_ASSERT_EQUALS(new_elem_index, 16u);
+        TS_ASSERT_DELTA(p_mesh->GetVolumeOfElement(5) + p_mesh->GetVolumeOfElement(16), old_total_volume, 1e-12);
+
+        // Deleting an element and remeshing changes the element indices
+        p_mesh->DeleteElementPriorToReMesh(0);
+        p_uncached_mesh->DeleteElementPriorToReMesh(0);
+        p_mesh->ReMesh();
+        p_uncached_mesh->ReMesh();
+        TS_ASSERT_EQUALS(p_mesh->GetNumElements(), 16u);
+        TS_ASSERT_EQUALS(p_mesh->GetUseGeometryCache(), true);
+
+        for (unsigned elem_index=0; elem_index<p_mesh->GetNumElements(); elem_index++)
+        {
+            TS_ASSERT_DELTA(p_mesh->GetVolumeOfElement(elem_index), p_uncached_mesh->GetVolumeOfElement(elem_index), 1e-12);
+            TS_ASSERT_DELTA(p_mesh->GetSurfaceAreaOfElement(elem_index), p_uncached_mesh->GetSurfaceAreaOfElement(elem_index), 1e-12);
+            TS_ASSERT_DELTA(p_mesh->GetCentroidOfElement(elem_index)[0], p_uncached_mesh->GetCentroidOfElement(elem_index)[0], 1e-12);
+            TS_ASSERT_DELTA(p_mesh->GetCentroidOfElement(elem_index)[1], p_uncached_mesh->GetCentroidOfElement(elem_index)[1], 1e-12);
+        }
+    }
+
+    void TestGeometryCacheAfterScaleTranslateAndRotate()
+    {
+        HoneycombVertexMeshGenerator generator(3, 3);
+        MutableVertexMesh<2,2>* p_mesh = generator.GetMesh();
+        p_mesh->SetUseGeometryCache(true);
+
+        unsigned elem_index = 4;
+        double volume = p_mesh->GetVolumeOfElement(elem_index);
+        c_vector<double, 2> centroid = p_mesh->GetCentroidOfElement(elem_index);
+
+        // Scaling moves all the nodes, so the cached geometry must be updated
+        p_mesh->Scale(2.0, 3.0);
+        TS_ASSERT_DELTA(p_mesh->GetVolumeOfElement(elem_index), 6.0*volume, 1e-12);
+        TS_ASSERT_DELTA(p_mesh->GetCentroidOfElement(elem_index)[0], 2.0*centroid[0], 1e-12);
+        TS_ASSERT_DELTA(p_mesh->GetCentroidOfElement(elem_index)[1], 3.0*centroid[1], 1e-12);
+
+        // Likewise for translation...
+        p_mesh->Translate(1.0, -2.0);
+        TS_ASSERT_DELTA(p_mesh->GetVolumeOfElement(elem_index), 6.0*volume, 1e-12);
+        TS_ASSERT_DELTA(p_mesh->GetCentroidOfElement(elem_index)[0], 2.0*centroid[0] + 1.0, 1e-12);
+        TS_ASSERT_DELTA(p_mesh->GetCentroidOfElement(elem_index)[1], 3.0*centroid[1] - 2.0, 1e-12);
+
+        // ...and rotation by a quarter turn, which maps (x,y) to (-y,x)
+        p_mesh->Rotate(0.5*M_PI);
+        TS_ASSERT_DELTA(p_mesh->GetVolumeOfElement(elem_index), 6.0*volume, 1e-12);
+        TS_ASSERT_DELTA(p_mesh->GetCentroidOfElement(elem_index)[0], -(3.0*centroid[1] - 2.0), 1e-12);
+        TS_ASSERT_DELTA(p_mesh->GetCentroidOfElement(elem_index)[1], 2.0*centroid[0] + 1.0, 1e-12);
+    }
+
     void TestHandleHighOrderJunctions()
     {
         //\todo need to re-implement this
@@ -2492,6 +2492,41 @@ public:
         TS_ASSERT(comparer2.CompareFiles());
     }
 
+    void TestReMeshForT3SwapsWithShortCheckingDistance()
+    {
+        /*
+         * Repeat the previous test with a checking distance that is short compared with the
+         * size of the mesh but longer than the distance from any element centroid to its
+         * vertices, so that T3 swap candidates are found using boxes. The same swaps should
+         * be performed.
+         */
+        VertexMeshReader<2, 2> mesh_reader("cell_based/test/data/TestMutableVertexMesh/vertex_remesh_T3");
+        MutableVertexMesh<2, 2> vertex_mesh;
+        vertex_mesh.ConstructFromMeshReader(mesh_reader);
+
+        vertex_mesh.SetDistanceForT3SwapChecking(2.0);
+        vertex_mesh.SetCellRearrangementThreshold(0.1 * 1.0 / 1.5);
+
+        vertex_mesh.ReMesh();
+
+        TS_ASSERT_EQUALS(vertex_mesh.GetNumElements(), 29u);
+        TS_ASSERT_EQUALS(vertex_mesh.GetNumNodes(), 72u);
+
+        std::string dirname = "TestVertexMeshReMesh";
+        std::string mesh_filename = "vertex_remesh_T3_short_distance";
+        VertexMeshWriter<2, 2> mesh_writer(dirname, mesh_filename, false);
+        mesh_writer.WriteFilesUsingMesh(vertex_mesh);
+
+        OutputFileHandler handler("TestVertexMeshReMesh", false);
+        std::string results_file1 = handler.GetOutputDirectoryFullPath() + "vertex_remesh_T3_short_distance.node";
+        std::string results_file2 = handler.GetOutputDirectoryFullPath() + "vertex_remesh_T3_short_distance.cell";
+
+        FileComparison comparer1(results_file1, "cell_based/test/data/TestMutableVertexMesh/vertex_remesh_T3_after_remesh.node");
+        TS_ASSERT(comparer1.CompareFiles());
+        FileComparison comparer2(results_file2, "cell_based/test/data/TestMutableVertexMesh/vertex_remesh_T3_after_remesh.cell");
+        TS_ASSERT(comparer2.CompareFiles());
+    }
+
     void TestReMeshForRemovingVoids()
     {
         /*
@@ -225,9 +225,9 @@ OdeSolution AbstractCvodeSystem::Solve(realtype tStart,
 
     // Set up ODE solution
     OdeSolution solutions;
+    solutions.SetSink(mpSolutionSink);
     solutions.SetNumberOfTimeSteps(stepper.EstimateTimeSteps());
-    solutions.rGetSolutions().push_back(MakeStdVec(mStateVariables));
-    solutions.rGetTimes().push_back(tStart);
+    solutions.AddSample(tStart, MakeStdVec(mStateVariables));
     solutions.SetOdeSystemInformation(mpSystemInfo);
 
     // Main time sampling loop
@@ -256,8 +256,7 @@ OdeSolution AbstractCvodeSystem::Solve(realtype tStart,
         VerifyStateVariables();
 #endif
         // Store solution
-        solutions.rGetSolutions().push_back(MakeStdVec(mStateVariables));
-        solutions.rGetTimes().push_back(cvode_stopped_at);
+        solutions.AddSample(cvode_stopped_at, MakeStdVec(mStateVariables));
         stepper.AdvanceOneTimeStep();
     }
 
@@ -327,6 +326,16 @@ void AbstractCvodeSystem::Solve(realtype tStart,
 #endif
 }
 
+void AbstractCvodeSystem::SetSolutionSink(boost::shared_ptr<AbstractOdeSolutionSink> pSink)
+{
+    mpSolutionSink = pSink;
+}
+
+boost::shared_ptr<AbstractOdeSolutionSink> AbstractCvodeSystem::GetSolutionSink() const
+{
+    return mpSolutionSink;
+}
+
 void AbstractCvodeSystem::SetMaxSteps(long int numSteps)
 {
     mMaxSteps = numSteps;
@@ -307,6 +307,12 @@ protected:
     /** The size of the previous timestep. */
     double mLastInternalStepSize;
 
+    /**
+     * If set, the samples computed by the sampling Solve method are passed to this sink
+     * rather than stored in the returned OdeSolution.  Not archived.
+     */
+    boost::shared_ptr<AbstractOdeSolutionSink> mpSolutionSink;
+
     /**
      * @b Must be called by concrete subclass constructors to initialise the state
      * variables, after setting #mpSystemInfo.
@@ -453,6 +459,19 @@ public:
                realtype tEnd,
                realtype maxDt);
 
+    /**
+     * Stream the samples computed by the sampling Solve method to a sink, rather than storing
+     * them in the returned OdeSolution.
+     *
+     * @param pSink  the sink (an empty pointer means store samples as normal)
+     */
+    void SetSolutionSink(boost::shared_ptr<AbstractOdeSolutionSink> pSink);
+
+    /**
+     * @return the sink that samples are streamed to, if any.
+     */
+    boost::shared_ptr<AbstractOdeSolutionSink> GetSolutionSink() const;
+
     /**
      * Change the maximum number of steps to be taken by the solver
      * in its attempt to reach the next output time.  Default is 500 (set by CVODE).
@@ -0,0 +1,123 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "ColumnDataOdeSolutionSink.hpp"
+
+#include <cassert>
+#include <sstream>
+
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+
+ColumnDataOdeSolutionSink::ColumnDataOdeSolutionSink(const std::string& directoryName,
+                                                     const std::string& baseResultsFilename,
+                                                     boost::shared_ptr<const AbstractOdeSystemInformation> pOdeSystemInformation,
+                                                     const std::string& timeUnits,
+                                                     unsigned stepsPerRow,
+                                                     bool cleanDirectory,
+                                                     unsigned precision)
+    : mWriter(directoryName, baseResultsFilename, cleanDirectory, precision),
+      mpOdeSystemInformation(pOdeSystemInformation),
+      mTimeUnits(timeUnits),
+      mStepsPerRow(stepsPerRow),
+      mNumSamples(0u),
+      mColumnsDefined(false),
+      mTimeVarId(-1)
+{
+    if (mStepsPerRow == 0u)
+    {
+        EXCEPTION("The number of steps per row must be positive");
+    }
+    assert(mpOdeSystemInformation.get() != nullptr);
+}
+
+void ColumnDataOdeSolutionSink::DefineColumns(unsigned numVars)
+{
+    mTimeVarId = mWriter.DefineUnlimitedDimension("Time", mTimeUnits);
+
+    // Either: the ODE system should have no names&units defined, or it should
+    // the same number as the number of state variables.
+    const std::vector<std::string>& r_names = mpOdeSystemInformation->rGetStateVariableNames();
+    assert(r_names.size() == 0 || r_names.size() == numVars);
+
+    mVarIds.reserve(numVars);
+    for (unsigned i=0; i<numVars; i++)
+    {
+        if (r_names.size() > 0)
+        {
+            mVarIds.push_back(mWriter.DefineVariable(r_names[i], mpOdeSystemInformation->rGetStateVariableUnits()[i]));
+        }
+        else
+        {
+            std::stringstream string_stream;
+            string_stream << "var_" << i;
+            mVarIds.push_back(mWriter.DefineVariable(string_stream.str(), ""));
+        }
+    }
+    mWriter.EndDefineMode();
+    mColumnsDefined = true;
+}
+
+void ColumnDataOdeSolutionSink::AddSample(double time, const std::vector<double>& rState)
+{
+    const unsigned sample = mNumSamples++;
+    if (!PetscTools::AmMaster() || sample % mStepsPerRow != 0u)
+    {
+        // Only the master actually writes to file
+        return;
+    }
+    if (!mColumnsDefined)
+    {
+        DefineColumns(rState.size());
+    }
+    assert(rState.size() == mVarIds.size());
+
+    mWriter.PutVariable(mTimeVarId, time);
+    for (unsigned j=0; j<rState.size(); j++)
+    {
+        mWriter.PutVariable(mVarIds[j], rState[j]);
+    }
+    mWriter.AdvanceAlongUnlimitedDimension();
+}
+
+unsigned ColumnDataOdeSolutionSink::GetNumberOfSamples() const
+{
+    return mNumSamples;
+}
+
+void ColumnDataOdeSolutionSink::Close()
+{
+    mWriter.Close();
+}
@@ -0,0 +1,128 @@
+/*
+
+Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef COLUMNDATAODESOLUTIONSINK_HPP_
+#define COLUMNDATAODESOLUTIONSINK_HPP_
+
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+
+#include "AbstractOdeSolutionSink.hpp"
+#include "AbstractOdeSystemInformation.hpp"
+#include "ColumnDataWriter.hpp"
+
+/**
+ * An ODE solution sink which writes each sample straight to file with a ColumnDataWriter,
+ * in the same format as OdeSolution::WriteToFile (without parameters or derived quantities).
+ *
+ * As for OdeSolution::WriteToFile, only the master process writes to file.
+ */
+class ColumnDataOdeSolutionSink : public AbstractOdeSolutionSink
+{
+private:
+
+    /** The writer for the output file. */
+    ColumnDataWriter mWriter;
+
+    /** Information about the ODE system, used to get names and units into the file. */
+    boost::shared_ptr<const AbstractOdeSystemInformation> mpOdeSystemInformation;
+
+    /** Name of the units of time. */
+    std::string mTimeUnits;
+
+    /** Only every this many samples is written. */
+    unsigned mStepsPerRow;
+
+    /** The number of samples received so far. */
+    unsigned mNumSamples;
+
+    /** Whether the columns of the file have been defined yet. */
+    bool mColumnsDefined;
+
+    /** Column id for time. */
+    int mTimeVarId;
+
+    /** Column ids for the state variables. */
+    std::vector<int> mVarIds;
+
+    /**
+     * Define the columns of the output file.
+     *
+     * @param numVars  the number of state variables
+     */
+    void DefineColumns(unsigned numVars);
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param directoryName  the directory in which to write the data to file
+     * @param baseResultsFilename  the name of the file in which to write the data
+     * @param pOdeSystemInformation  information about the ODE system being solved
+     * @param timeUnits  name of the units of time used
+     * @param stepsPerRow  only write every this many samples (defaults to 1)
+     * @param cleanDirectory  whether to clean the directory (defaults to true)
+     * @param precision  the precision with which to write the data (defaults to 8)
+     */
+    ColumnDataOdeSolutionSink(const std::string& directoryName,
+                              const std::string& baseResultsFilename,
+                              boost::shared_ptr<const AbstractOdeSystemInformation> pOdeSystemInformation,
+                              const std::string& timeUnits,
+                              unsigned stepsPerRow=1,
+                              bool cleanDirectory=true,
+                              unsigned precision=8);
+
+    /**
+     * Write a sample to file (if it falls on an output row).
+     *
+     * @param time  the sampling time
+     * @param rState  the state variables at that time
+     */
+    void AddSample(double time, const std::vector<double>& rState);
+
+    /**
+     * @return the number of samples received so far.
+     */
+    unsigned GetNumberOfSamples() const;
+
+    /**
+     * Close the output file.  This is also done on destruction.
+     */
+    void Close();
+};
+
+#endif /*COLUMNDATAODESOLUTIONSINK_HPP_*/
@@ -35,6 +35,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "OdeSolution.hpp"
 
+#include <algorithm>
 #include <sstream>
 
 #include "ColumnDataWriter.hpp"
@@ -48,6 +49,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 OdeSolution::OdeSolution()
     : mNumberOfTimeSteps(0u),
+      mNumberOfStateVariables(0u),
+      mSolutionsNested(false),
       mpOdeSystemInformation()
 {
 }
@@ -62,8 +65,98 @@ unsigned OdeSolution::GetNumberOfTimeSteps() const
 void OdeSolution::SetNumberOfTimeSteps(unsigned numTimeSteps)
 {
     mNumberOfTimeSteps = numTimeSteps;
-    mTimes.reserve(numTimeSteps+1);
-    mSolutions.reserve(numTimeSteps);
+    if (!mpSink)
+    {
+        // There is one more sample than time step, since the initial condition is included
+        mTimes.reserve(numTimeSteps+1);
+        if (mSolutionsNested)
+        {
+            mSolutions.reserve(numTimeSteps+1);
+        }
+        else if (mNumberOfStateVariables > 0)
+        {
+            mSolutionData.reserve((numTimeSteps+1)*mNumberOfStateVariables);
+        }
+    }
+}
+
+void OdeSolution::AddSample(double time, const std::vector<double>& rState)
+{
+    if (mpSink)
+    {
+        mpSink->AddSample(time, rState);
+        return;
+    }
+
+    mTimes.push_back(time);
+    if (mSolutionsNested)
+    {
+        mSolutions.push_back(rState);
+    }
+    else
+    {
+        if (mSolutionData.empty())
+        {
+            // Now we know the row size, reserve space for the number of samples expected
+            mNumberOfStateVariables = rState.size();
+            mSolutionData.reserve(std::max(mTimes.capacity(), (std::size_t)1u) * mNumberOfStateVariables);
+        }
+        assert(rState.size() == mNumberOfStateVariables);
+        mSolutionData.insert(mSolutionData.end(), rState.begin(), rState.end());
+    }
+}
+
+void OdeSolution::SetSink(boost::shared_ptr<AbstractOdeSolutionSink> pSink)
+{
+    mpSink = pSink;
+}
+
+void OdeSolution::MoveToNestedStorage() const
+{
+    if (!mSolutionsNested)
+    {
+        const unsigned num_samples = (mNumberOfStateVariables == 0u) ? 0u : mSolutionData.size()/mNumberOfStateVariables;
+        mSolutions.reserve(std::max((std::size_t)num_samples, mTimes.capacity()));
+        for (unsigned i=0; i<num_samples; i++)
+        {
+            mSolutions.push_back(std::vector<double>(mSolutionData.begin() + i*mNumberOfStateVariables,
+                                                     mSolutionData.begin() + (i+1)*mNumberOfStateVariables));
+        }
+        // Release the contiguous storage
+        std::vector<double>().swap(mSolutionData);
+        mSolutionsNested = true;
+    }
+}
+
+unsigned OdeSolution::GetNumberOfStoredStateVariables() const
+{
+    if (mSolutionsNested)
+    {
+        return mSolutions.empty() ? 0u : mSolutions[0].size();
+    }
+    return mNumberOfStateVariables;
+}
+
+double OdeSolution::GetStateValue(unsigned timeIndex, unsigned varIndex) const
+{
+    if (mSolutionsNested)
+    {
+        return mSolutions[timeIndex][varIndex];
+    }
+    return mSolutionData[timeIndex*mNumberOfStateVariables + varIndex];
+}
+
+void OdeSolution::GetState(unsigned timeIndex, std::vector<double>& rState) const
+{
+    if (mSolutionsNested)
+    {
+        rState = mSolutions[timeIndex];
+    }
+    else
+    {
+        rState.assign(mSolutionData.begin() + timeIndex*mNumberOfStateVariables,
+                      mSolutionData.begin() + (timeIndex+1)*mNumberOfStateVariables);
+    }
 }
 
 
@@ -77,15 +170,16 @@ std::vector<double> OdeSolution::GetVariableAtIndex(unsigned index) const
     std::vector<double> answer;
     answer.reserve(mTimes.size());
     double temp_number;
+    const unsigned num_vars = GetNumberOfStoredStateVariables();
     for (unsigned i=0; i< mTimes.size(); ++i)
     {
-        if (index < mSolutions[0].size())
+        if (index < num_vars)
         {
-            temp_number = mSolutions[i][index];
+            temp_number = GetStateValue(i, index);
         }
         else
         {
-            unsigned offset = mSolutions[0].size();
+            unsigned offset = num_vars;
             if (index - offset < mParameters.size())
             {
                 temp_number = mParameters[index - offset];
@@ -125,11 +219,13 @@ const std::vector<double>& OdeSolution::rGetTimes() const
 
 std::vector<std::vector<double> >& OdeSolution::rGetSolutions()
 {
+    MoveToNestedStorage();
     return mSolutions;
 }
 
 const std::vector<std::vector<double> >& OdeSolution::rGetSolutions() const
 {
+    MoveToNestedStorage();
     return mSolutions;
 }
 
@@ -165,11 +261,12 @@ std::vector<std::vector<double> >& OdeSolution::rGetDerivedQuantities(AbstractPa
     assert(pOdeSystem != nullptr);
     if (mDerivedQuantities.empty() && pOdeSystem->GetNumberOfDerivedQuantities() > 0)
     {
-        assert(mTimes.size() == mSolutions.size()); // Paranoia
         mDerivedQuantities.reserve(mTimes.size());
+        std::vector<double> state;
         for (unsigned i=0; i<mTimes.size(); i++)
         {
-            mDerivedQuantities.push_back(pOdeSystem->ComputeDerivedQuantities(mTimes[i], mSolutions[i]));
+            GetState(i, state);
+            mDerivedQuantities.push_back(pOdeSystem->ComputeDerivedQuantities(mTimes[i], state));
         }
     }
     return mDerivedQuantities;
@@ -181,17 +278,18 @@ std::vector<std::vector<double> >& OdeSolution::rGetDerivedQuantities(AbstractPa
     assert(pOdeSystem != nullptr);
     if (mDerivedQuantities.empty() && pOdeSystem->GetNumberOfDerivedQuantities() > 0)
     {
-        const unsigned num_solutions = mSolutions.size();
-        assert(mTimes.size() == num_solutions); // Paranoia
+        const unsigned num_solutions = mTimes.size();
         mDerivedQuantities.resize(mTimes.size());
 #if CHASTE_SUNDIALS_VERSION >= 60000
-        N_Vector state_vars = num_solutions > 0 ? N_VNew_Serial(mSolutions[0].size(), CvodeContextManager::Instance()->GetSundialsContext()) : nullptr;
+        N_Vector state_vars = num_solutions > 0 ? N_VNew_Serial(GetNumberOfStoredStateVariables(), CvodeContextManager::Instance()->GetSundialsContext()) : nullptr;
 #else
-        N_Vector state_vars = num_solutions > 0 ? N_VNew_Serial(mSolutions[0].size()) : nullptr;
+        N_Vector state_vars = num_solutions > 0 ? N_VNew_Serial(GetNumberOfStoredStateVariables()) : nullptr;
 #endif
+        std::vector<double> state;
         for (unsigned i=0; i<num_solutions; i++)
         {
-            CopyFromStdVector(mSolutions[i], state_vars);
+            GetState(i, state);
+            CopyFromStdVector(state, state_vars);
             N_Vector dqs = pOdeSystem->ComputeDerivedQuantities(mTimes[i], state_vars);
             CopyToStdVector(dqs, mDerivedQuantities[i]);
             DeleteVector(dqs);
@@ -214,7 +312,6 @@ void OdeSolution::WriteToFile(std::string directoryName,
 {
     assert(stepsPerRow > 0);
     assert(mTimes.size() > 0);
-    assert(mTimes.size() == mSolutions.size());
     assert(mpOdeSystemInformation.get() != nullptr);
     if (mpOdeSystemInformation->GetNumberOfParameters()==0 && mpOdeSystemInformation->GetNumberOfDerivedQuantities() == 0)
     {
@@ -243,9 +340,9 @@ void OdeSolution::WriteToFile(std::string directoryName,
     // Either: the ODE system should have no names&units defined, or it should
     // the same number as the number of solutions per timestep.
     assert(  mpOdeSystemInformation->rGetStateVariableNames().size()==0 ||
-            (mpOdeSystemInformation->rGetStateVariableNames().size()==mSolutions[0].size()) );
+            (mpOdeSystemInformation->rGetStateVariableNames().size()==GetNumberOfStoredStateVariables()) );
 
-    unsigned num_vars = mSolutions[0].size();
+    unsigned num_vars = GetNumberOfStoredStateVariables();
     unsigned num_params = mpOdeSystemInformation->GetNumberOfParameters();
     unsigned num_derived_quantities = mpOdeSystemInformation->GetNumberOfDerivedQuantities();
 
@@ -291,12 +388,12 @@ void OdeSolution::WriteToFile(std::string directoryName,
 
     writer.EndDefineMode();
 
-    for (unsigned i=0; i<mSolutions.size(); i+=stepsPerRow)
+    for (unsigned i=0; i<mTimes.size(); i+=stepsPerRow)
     {
         writer.PutVariable(time_var_id, mTimes[i]);
         for (unsigned j=0; j<num_vars; j++)
         {
-            writer.PutVariable(var_ids[j], mSolutions[i][j]);
+            writer.PutVariable(var_ids[j], GetStateValue(i, j));
         }
         if (includeDerivedQuantities)
         {
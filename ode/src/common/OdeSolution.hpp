@@ -42,6 +42,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cassert>
 #include <boost/shared_ptr.hpp>
 
+#include "AbstractOdeSolutionSink.hpp"
 #include "AbstractOdeSystemInformation.hpp"
 #include "AbstractParameterisedSystem.hpp"
 
@@ -54,6 +55,12 @@ class AbstractOdeSystem; // Avoid cyclic include issues
 
 /**
  * A class that that stores the output data from solving a system of ODEs, and allows us to save it to file.
+ *
+ * Samples added with AddSample() are stored contiguously (one row of state variables per sample),
+ * with storage reserved up front from SetNumberOfTimeSteps().  The std::vector-of-vectors view
+ * returned by rGetSolutions() is only created if that method is called, after which the solution
+ * is stored in that form.  Alternatively, samples can be passed straight on to a sink (see SetSink())
+ * and not stored at all.
  */
 class OdeSolution
 {
@@ -64,8 +71,23 @@ private:
     /** A vector of times at each timestep. */
     std::vector<double> mTimes;
 
-    /** Solutions for each variable at each timestep. */
-    std::vector<std::vector<double> > mSolutions;
+    /** Solutions for each variable at each timestep, stored row by row (used until #mSolutionsNested is set). */
+    mutable std::vector<double> mSolutionData;
+
+    /** The number of state variables in each row of #mSolutionData. */
+    unsigned mNumberOfStateVariables;
+
+    /**
+     * Solutions for each variable at each timestep, as returned by rGetSolutions().
+     * Only used once #mSolutionsNested is set.
+     */
+    mutable std::vector<std::vector<double> > mSolutions;
+
+    /** Whether the solution has been moved from #mSolutionData to #mSolutions. */
+    mutable bool mSolutionsNested;
+
+    /** If set, samples are passed to this sink rather than stored. */
+    boost::shared_ptr<AbstractOdeSolutionSink> mpSink;
 
     /** Derived quantities at each timestep. */
     std::vector<std::vector<double> > mDerivedQuantities;
@@ -83,6 +105,32 @@ private:
      */
     boost::shared_ptr<const AbstractOdeSystemInformation> mpOdeSystemInformation;
 
+    /**
+     * Move the stored solution into the std::vector-of-vectors form returned by rGetSolutions().
+     */
+    void MoveToNestedStorage() const;
+
+    /**
+     * @return the number of state variables in each stored sample (zero if there are none).
+     */
+    unsigned GetNumberOfStoredStateVariables() const;
+
+    /**
+     * @return the value of a state variable at a stored sample.
+     *
+     * @param timeIndex  the index of the sample
+     * @param varIndex  the index of the state variable
+     */
+    double GetStateValue(unsigned timeIndex, unsigned varIndex) const;
+
+    /**
+     * Copy the state variables at a stored sample into a vector.
+     *
+     * @param timeIndex  the index of the sample
+     * @param rState  filled in with the state variables
+     */
+    void GetState(unsigned timeIndex, std::vector<double>& rState) const;
+
 public:
     /**
      * Public constructor - ensures data is empty to start with.
@@ -103,6 +151,22 @@ public:
      */
     void SetNumberOfTimeSteps(unsigned numTimeSteps);
 
+    /**
+     * Record the solution at a sampling time.  If a sink has been set, the sample is passed
+     * to it instead of being stored.
+     *
+     * @param time  the sampling time
+     * @param rState  the state variables at that time
+     */
+    void AddSample(double time, const std::vector<double>& rState);
+
+    /**
+     * Pass samples added with AddSample() to a sink rather than storing them.
+     *
+     * @param pSink  the sink (an empty pointer means store samples as normal)
+     */
+    void SetSink(boost::shared_ptr<AbstractOdeSolutionSink> pSink);
+
     /**
      * Set the ODE system information
      *
@@ -145,6 +209,9 @@ public:
     /**
      * @return the values of the solution to the ODE system at each timestep.
      *
+     * Note that this converts the stored solution to a std::vector of std::vectors, so
+     * GetVariableAtIndex() is more efficient when only some variables are needed.
+     *
      * @return #mSolutions.
      */
     std::vector<std::vector<double> >& rGetSolutions();
@@ -71,3 +71,13 @@ double AbstractIvpOdeSolver::GetStoppingTime()
 {
     return mStoppingTime;
 }
+
+void AbstractIvpOdeSolver::SetSolutionSink(boost::shared_ptr<AbstractOdeSolutionSink> pSink)
+{
+    mpSolutionSink = pSink;
+}
+
+boost::shared_ptr<AbstractOdeSolutionSink> AbstractIvpOdeSolver::GetSolutionSink() const
+{
+    return mpSolutionSink;
+}
@@ -37,6 +37,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define _ABSTRACTIVPODESOLVER_HPP_
 
 #include <vector>
+#include <boost/shared_ptr.hpp>
 
 #include "ChasteSerialization.hpp"
 #include "ClassIsAbstract.hpp"
@@ -77,6 +78,12 @@ protected:
     /** If a stopping event occurred the time is stored here.  (Only valid when mStoppingEventOccurred==true) */
     double mStoppingTime;
 
+    /**
+     * If set, the samples computed by the sampling Solve method are passed to this sink
+     * rather than stored in the returned OdeSolution.  Not archived.
+     */
+    boost::shared_ptr<AbstractOdeSolutionSink> mpSolutionSink;
+
 public:
 
     /**
@@ -154,6 +161,20 @@ public:
      */
     double GetStoppingTime();
 
+    /**
+     * Stream the samples computed by the sampling Solve method to a sink, rather than storing
+     * them in the returned OdeSolution.  This keeps memory use independent of the length of
+     * the simulation.
+     *
+     * @param pSink  the sink (an empty pointer means store samples as normal)
+     */
+    void SetSolutionSink(boost::shared_ptr<AbstractOdeSolutionSink> pSink);
+
+    /**
+     * @return the sink that samples are streamed to, if any.
+     */
+    boost::shared_ptr<AbstractOdeSolutionSink> GetSolutionSink() const;
+
     /**
      * Constructor.
      */
@@ -59,9 +59,9 @@ OdeSolution AbstractOneStepIvpOdeSolver::Solve(AbstractOdeSystem* pOdeSystem,
 
     // setup solutions if output is required
     OdeSolution solutions;
+    solutions.SetSink(mpSolutionSink);
     solutions.SetNumberOfTimeSteps(stepper.EstimateTimeSteps());
-    solutions.rGetSolutions().push_back(rYValues);
-    solutions.rGetTimes().push_back(startTime);
+    solutions.AddSample(startTime, rYValues);
     solutions.SetOdeSystemInformation(pOdeSystem->GetSystemInformation());
     solutions.SetSolverName( GetIdentifier() );
 
@@ -72,17 +72,8 @@ OdeSolution AbstractOneStepIvpOdeSolver::Solve(AbstractOdeSystem* pOdeSystem,
     {
         InternalSolve(pOdeSystem, rYValues, mWorkingMemory, stepper.GetTime(), stepper.GetNextTime(), timeStep);
         stepper.AdvanceOneTimeStep();
-        // write current solution into solutions
-        solutions.rGetSolutions().push_back(rYValues);
-        // Push back new time into the time solution vector
-        if (mStoppingEventOccurred)
-        {
-            solutions.rGetTimes().push_back(mStoppingTime);
-        }
-        else
-        {
-            solutions.rGetTimes().push_back(stepper.GetTime());
-        }
+        // write current solution and time into solutions
+        solutions.AddSample(mStoppingEventOccurred ? mStoppingTime : stepper.GetTime(), rYValues);
     }
 
     // stepper.EstimateTimeSteps may have been an overestimate...
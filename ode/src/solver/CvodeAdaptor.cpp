@@ -460,9 +460,9 @@ OdeSolution CvodeAdaptor::Solve(AbstractOdeSystem* pOdeSystem,
 
     // Set up ODE solution
     OdeSolution solutions;
+    solutions.SetSink(mpSolutionSink);
     solutions.SetNumberOfTimeSteps(stepper.EstimateTimeSteps());
-    solutions.rGetSolutions().push_back(rYValues);
-    solutions.rGetTimes().push_back(startTime);
+    solutions.AddSample(startTime, rYValues);
     solutions.SetOdeSystemInformation(pOdeSystem->GetSystemInformation());
 
     // Main time sampling loop
@@ -482,8 +482,7 @@ OdeSolution CvodeAdaptor::Solve(AbstractOdeSystem* pOdeSystem,
             CvodeError(ierr, "CVODE failed to solve system");
         }
         // Store solution
-        solutions.rGetSolutions().push_back(rYValues);
-        solutions.rGetTimes().push_back(tend);
+        solutions.AddSample(tend, rYValues);
         if (ierr == CV_ROOT_RETURN)
         {
             // Stopping event occurred
@@ -76,8 +76,7 @@ void RungeKuttaFehlbergIvpOdeSolver::InternalSolve(OdeSolution& rSolution,
 
     if (outputSolution)
     {   // Write out ICs
-        rSolution.rGetTimes().push_back(current_time);
-        rSolution.rGetSolutions().push_back(rYValues);
+        rSolution.AddSample(current_time, rYValues);
     }
 
     // should never get here if this bool has been set to true;
@@ -120,8 +119,7 @@ void RungeKuttaFehlbergIvpOdeSolver::InternalSolve(OdeSolution& rSolution,
                 if (outputSolution)
                 {   // Write out ICs
                     //std::cout << "In solver Time = " << current_time << " y = " << rWorkingMemory[0] << "\n" << std::flush;
-                    rSolution.rGetTimes().push_back(current_time);
-                    rSolution.rGetSolutions().push_back(rWorkingMemory);
+                    rSolution.AddSample(current_time, rWorkingMemory);
                     number_of_time_steps++;
                 }
             }
@@ -301,6 +299,7 @@ OdeSolution RungeKuttaFehlbergIvpOdeSolver::Solve(AbstractOdeSystem* pOdeSystem,
     std::vector<double> working_memory(rYValues.size());
     // And solve...
     OdeSolution solutions;
+    solutions.SetSink(mpSolutionSink);
     //solutions.SetNumberOfTimeSteps((unsigned)(10.0*(startTime-endTime)/timeStep));
     bool return_solution = true;
     InternalSolve(solutions, pOdeSystem, rYValues, working_memory, startTime, endTime, timeStep, 1e-5, tolerance, return_solution);
@@ -45,6 +45,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ParameterisedCvode.hpp"
 #include "TwoDimCvodeSystem.hpp"
 
+#include "ColumnDataOdeSolutionSink.hpp"
+#include "NumericFileComparison.hpp"
 #include "OdeSolution.hpp"
 #include "OutputFileHandler.hpp"
 #include "VectorHelperFunctions.hpp"
@@ -383,6 +385,39 @@ public:
 #endif // CHASTE_CVODE
     }
 
+    void TestSolveStreamingToSink()
+    {
+#ifdef CHASTE_CVODE
+        CvodeFirstOrder ode_system;
+        ode_system.SetMaxSteps(1000);
+
+        // With a sink, nothing is stored but every sample is written to file
+        boost::shared_ptr<ColumnDataOdeSolutionSink> p_sink(
+            new ColumnDataOdeSolutionSink("CvodeSolutionSink", "streamed", ode_system.GetSystemInformation(), "time"));
+        ode_system.SetSolutionSink(p_sink);
+        TS_ASSERT_EQUALS(ode_system.GetSolutionSink(), p_sink);
+        OdeSolution streamed = ode_system.Solve(0.0, 2.0, 0.01, 0.1);
+        TS_ASSERT_EQUALS(streamed.rGetTimes().size(), 0u);
+        TS_ASSERT_EQUALS(p_sink->GetNumberOfSamples(), 21u);
+        p_sink->Close();
+        double streamed_final_value = ode_system.GetStateVariable(0u);
+
+        // Without one, the same samples are stored as normal
+        ode_system.SetSolutionSink(boost::shared_ptr<AbstractOdeSolutionSink>());
+        ode_system.ResetToInitialConditions();
+        OdeSolution stored = ode_system.Solve(0.0, 2.0, 0.01, 0.1);
+        TS_ASSERT_EQUALS(stored.rGetTimes().size(), 21u);
+        TS_ASSERT_DELTA(stored.rGetSolutions().back()[0], streamed_final_value, 1e-12);
+        stored.WriteToFile("CvodeSolutionSink", "stored", "time", 1, false);
+
+        NumericFileComparison comparer(OutputFileHandler::GetChasteTestOutputDirectory() + "CvodeSolutionSink/streamed.dat",
+                                       OutputFileHandler::GetChasteTestOutputDirectory() + "CvodeSolutionSink/stored.dat");
+        TS_ASSERT(comparer.CompareFiles(1e-12));
+#else
+        std::cout << "Cvode is not enabled.\n";
+#endif // CHASTE_CVODE
+    }
+
     void TestSequentialSolveCalls()
     {
         /*
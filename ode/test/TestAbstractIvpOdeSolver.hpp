@@ -49,6 +49,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "RungeKutta2IvpOdeSolver.hpp"
 #include "RungeKutta4IvpOdeSolver.hpp"
 #include "OdeSolution.hpp"
+#include "AbstractOdeSolutionSink.hpp"
+#include "ColumnDataOdeSolutionSink.hpp"
 
 #include "Ode1.hpp"
 #include "Ode2.hpp"
@@ -69,6 +71,39 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ArchiveLocationInfo.hpp"
 
 
+/**
+ * A sink which just remembers the last sample it was given, for testing.
+ */
+class LastSampleSink : public AbstractOdeSolutionSink
+{
+public:
+    /** The number of samples received. */
+    unsigned mNumSamples;
+    /** The last time received. */
+    double mLastTime;
+    /** The last state received. */
+    std::vector<double> mLastState;
+
+    /** Constructor. */
+    LastSampleSink()
+        : mNumSamples(0u),
+          mLastTime(0.0)
+    {
+    }
+
+    /**
+     * Remember the sample.
+     * @param time  the sampling time
+     * @param rState  the state variables at that time
+     */
+    void AddSample(double time, const std::vector<double>& rState)
+    {
+        mNumSamples++;
+        mLastTime = time;
+        mLastState = rState;
+    }
+};
+
 class TestAbstractIvpOdeSolver: public CxxTest::TestSuite
 {
 private:
@@ -205,6 +240,67 @@ public:
         TS_ASSERT(file_comparer.CompareFiles());
     }
 
+    void TestContiguousStorageAndSinks()
+    {
+        Ode2 ode_system;
+        EulerIvpOdeSolver solver;
+
+        // Samples are stored contiguously until the nested vectors are asked for
+        std::vector<double> state_variables = ode_system.GetInitialConditions();
+        OdeSolution solutions = solver.Solve(&ode_system, state_variables, 0.0, 1.0, 0.01, 0.1);
+        TS_ASSERT_EQUALS(solutions.rGetTimes().size(), 11u);
+        std::vector<double> y0 = solutions.GetVariableAtIndex(0);
+        TS_ASSERT_EQUALS(y0.size(), 11u);
+
+        const std::vector<std::vector<double> >& r_nested = solutions.rGetSolutions();
+        TS_ASSERT_EQUALS(r_nested.size(), 11u);
+        for (unsigned i=0; i<r_nested.size(); i++)
+        {
+            TS_ASSERT_EQUALS(r_nested[i].size(), 1u);
+            TS_ASSERT_EQUALS(r_nested[i][0], y0[i]);
+        }
+        TS_ASSERT_DELTA(r_nested.back()[0], state_variables[0], 1e-12);
+
+        // Samples can still be added after conversion
+        solutions.AddSample(1.1, state_variables);
+        TS_ASSERT_EQUALS(solutions.rGetSolutions().size(), 12u);
+        TS_ASSERT_EQUALS(solutions.GetVariableAtIndex(0).size(), 12u);
+
+        // With a sink, nothing is stored but the sink sees every sample
+        boost::shared_ptr<LastSampleSink> p_sink(new LastSampleSink);
+        solver.SetSolutionSink(p_sink);
+        TS_ASSERT_EQUALS(solver.GetSolutionSink(), p_sink);
+        state_variables = ode_system.GetInitialConditions();
+        OdeSolution streamed = solver.Solve(&ode_system, state_variables, 0.0, 1.0, 0.01, 0.1);
+        TS_ASSERT_EQUALS(streamed.rGetTimes().size(), 0u);
+        TS_ASSERT_EQUALS(p_sink->mNumSamples, 11u);
+        TS_ASSERT_DELTA(p_sink->mLastTime, 1.0, 1e-12);
+        TS_ASSERT_EQUALS(p_sink->mLastState.size(), 1u);
+        TS_ASSERT_EQUALS(p_sink->mLastState[0], y0.back());
+
+        // Streaming to file gives the same state variable columns as writing afterwards
+        {
+            boost::shared_ptr<ColumnDataOdeSolutionSink> p_file_sink(
+                new ColumnDataOdeSolutionSink("OdeSolutionSink", "Ode2_streamed", ode_system.GetSystemInformation(), "time", 2u));
+            solver.SetSolutionSink(p_file_sink);
+            state_variables = ode_system.GetInitialConditions();
+            solver.Solve(&ode_system, state_variables, 0.0, 1.0, 0.01, 0.1);
+            TS_ASSERT_EQUALS(p_file_sink->GetNumberOfSamples(), 11u);
+            p_file_sink->Close();
+        }
+        solver.SetSolutionSink(boost::shared_ptr<AbstractOdeSolutionSink>());
+        solutions.WriteToFile("OdeSolutionSink", "Ode2_stored", "time", 2, false);
+        PetscTools::Barrier("TestContiguousStorageAndSinks");
+
+        // The stored solution has one extra sample at the end, which falls outside the output rows
+        NumericFileComparison comparer(OutputFileHandler::GetChasteTestOutputDirectory() + "OdeSolutionSink/Ode2_streamed.dat",
+                                       OutputFileHandler::GetChasteTestOutputDirectory() + "OdeSolutionSink/Ode2_stored.dat");
+        TS_ASSERT(comparer.CompareFiles(1e-12));
+
+        TS_ASSERT_THROWS_THIS(ColumnDataOdeSolutionSink("OdeSolutionSink", "bad", ode_system.GetSystemInformation(), "time", 0u, false),
+                              "The number of steps per row must be positive");
+    }
+
     void TestEulerSolver()
     {
         EulerIvpOdeSolver euler_solver;
@@ -34,6 +34,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "AbstractHdf5Converter.hpp"
+#include "PetscTools.hpp"
 #include "Version.hpp"
 
 
@@ -236,6 +237,61 @@ herr_t op_func (hid_t loc_id, const char *name,
     return 0;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned AbstractHdf5Converter<ELEMENT_DIM,SPACE_DIM>::GetBlockOnMaster(const std::vector<Vec>& rData,
+                                                                        unsigned process,
+                                                                        std::vector<std::vector<double> >& rBlocks)
+{
+    assert(!rData.empty());
+    const unsigned num_vecs = rData.size();
+    const unsigned my_rank = PetscTools::GetMyRank();
+    const int tag = 1157;
+
+    // Global index of the first entry, and number of entries, owned by the process
+    unsigned block_info[2] = {0u, 0u};
+
+    if (process == my_rank)
+    {
+        PetscInt lo, hi;
+        VecGetOwnershipRange(rData[0], &lo, &hi);
+        block_info[0] = lo;
+        block_info[1] = hi - lo;
+
+        rBlocks.resize(num_vecs);
+        for (unsigned vec=0; vec<num_vecs; vec++)
+        {
+            double* p_data;
+            VecGetArray(rData[vec], &p_data);
+            rBlocks[vec].assign(p_data, p_data + block_info[1]);
+            VecRestoreArray(rData[vec], &p_data);
+        }
+
+        if (!PetscTools::AmMaster())
+        {
+            MPI_Send(block_info, 2, MPI_UNSIGNED, 0, tag, PETSC_COMM_WORLD);
+            for (unsigned vec=0; vec<num_vecs; vec++)
+            {
+                MPI_Send(rBlocks[vec].data(), block_info[1], MPI_DOUBLE, 0, tag, PETSC_COMM_WORLD);
+            }
+            // Only the master keeps the data
+            rBlocks.clear();
+        }
+    }
+    else if (PetscTools::AmMaster())
+    {
+        MPI_Status status;
+        MPI_Recv(block_info, 2, MPI_UNSIGNED, process, tag, PETSC_COMM_WORLD, &status);
+        rBlocks.resize(num_vecs);
+        for (unsigned vec=0; vec<num_vecs; vec++)
+        {
+            rBlocks[vec].resize(block_info[1]);
+            MPI_Recv(rBlocks[vec].data(), block_info[1], MPI_DOUBLE, process, tag, PETSC_COMM_WORLD, &status);
+        }
+    }
+
+    return block_info[0];
+}
+
 // Explicit instantiation
 template class AbstractHdf5Converter<1,1>;
 template class AbstractHdf5Converter<1,2>;
@@ -112,6 +112,23 @@ protected:
      */
     bool MoveOntoNextDataset();
 
+    /**
+     * Collect on the master process the entries of some distributed vectors that are owned
+     * by a given process.
+     *
+     * Converters that write files from the master call this for each process in turn, writing
+     * each block out as it arrives. No process then holds more than one process's share of the
+     * data, where replicating each vector would need the whole of it on every process.
+     *
+     * @note Both the master and the given process must call this method.
+     *
+     * @param rData  distributed vectors, all with the same parallel layout
+     * @param process  the process whose entries are wanted
+     * @param rBlocks  filled on the master with the locally owned entries of each of rData on the given process
+     * @return on the master, the global index of the first entry of the blocks
+     */
+    unsigned GetBlockOnMaster(const std::vector<Vec>& rData, unsigned process, std::vector<std::vector<double> >& rBlocks);
+
 public:
 
     /**
@@ -39,7 +39,6 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UblasCustomFunctions.hpp"
 #include "PetscTools.hpp"
 #include "Exception.hpp"
-#include "ReplicatableVector.hpp"
 #include "DistributedVector.hpp"
 #include "DistributedVectorFactory.hpp"
 #include "Version.hpp"
@@ -72,24 +71,26 @@ void Hdf5ToMeshalyzerConverter<ELEMENT_DIM,SPACE_DIM>::Write(std::string type)
 
     DistributedVectorFactory factory(num_nodes);
 
-    Vec data = factory.CreateVec();
-    ReplicatableVector repl_data(num_nodes);
+    // Each process reads its own part of the data, which is streamed to the master one process at a time
+    std::vector<Vec> data(1, factory.CreateVec());
+    std::vector<std::vector<double> > blocks;
     for (unsigned time_step=0; time_step<num_timesteps; time_step++)
     {
-        this->mpReader->GetVariableOverNodes(data, type, time_step);
-        repl_data.ReplicatePetscVector(data);
+        this->mpReader->GetVariableOverNodes(data[0], type, time_step);
 
-        assert(repl_data.GetSize() == num_nodes);
-
-        if (PetscTools::AmMaster())
+        for (unsigned process=0; process<PetscTools::GetNumProcs(); process++)
         {
-            for (unsigned i=0; i<num_nodes; i++)
+            this->GetBlockOnMaster(data, process, blocks);
+            if (PetscTools::AmMaster())
             {
-                *p_file << repl_data[i] << "\n";
+                for (unsigned i=0; i<blocks[0].size(); i++)
+                {
+                    *p_file << blocks[0][i] << "\n";
+                }
             }
         }
     }
-    PetscTools::Destroy(data);
+    PetscTools::Destroy(data[0]);
     if (PetscTools::AmMaster())
     {
         std::string comment = "# " + ChasteBuildInfo::GetProvenanceString();
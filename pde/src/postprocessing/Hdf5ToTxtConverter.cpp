@@ -37,7 +37,6 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Hdf5ToTxtConverter.hpp"
 #include "PetscTools.hpp"
 #include "Exception.hpp"
-#include "ReplicatableVector.hpp"
 #include "DistributedVector.hpp"
 #include "DistributedVectorFactory.hpp"
 #include "DistributedTetrahedralMesh.hpp"
@@ -55,12 +54,12 @@ Hdf5ToTxtConverter<ELEMENT_DIM, SPACE_DIM>::Hdf5ToTxtConverter(const FileFinder&
     FileFinder output_directory(this->mRelativeSubdirectory,rInputDirectory);
     OutputFileHandler handler(output_directory);
 
-    unsigned num_nodes = pMesh->GetNumNodes();
     unsigned num_timesteps = this->mpReader->GetUnlimitedDimensionValues().size();
 
+    // Each process reads its own part of the data, which is streamed to the master one process at a time
     DistributedVectorFactory* p_factory = pMesh->GetDistributedVectorFactory();
-    Vec data = p_factory->CreateVec();
-    ReplicatableVector repl_data(num_nodes);
+    std::vector<Vec> data(1, p_factory->CreateVec());
+    std::vector<std::vector<double> > blocks;
 
     // Loop over time steps
     for (unsigned time_step=0; time_step<num_timesteps; time_step++)
@@ -73,26 +72,35 @@ Hdf5ToTxtConverter<ELEMENT_DIM, SPACE_DIM>::Hdf5ToTxtConverter(const FileFinder&
             // Create a .txt file for this time step and this variable
             std::stringstream file_name;
             file_name << rFileBaseName << "_" << variable_name << "_" << time_step << ".txt";
-            out_stream p_file = handler.OpenOutputFile(file_name.str());
-
-            this->mpReader->GetVariableOverNodes(data, variable_name, time_step);
-            repl_data.ReplicatePetscVector(data);
+            out_stream p_file = out_stream(nullptr);
+            if (PetscTools::AmMaster())
+            {
+                p_file = handler.OpenOutputFile(file_name.str());
+            }
 
-            assert(repl_data.GetSize() == num_nodes);
+            this->mpReader->GetVariableOverNodes(data[0], variable_name, time_step);
 
-            if (PetscTools::AmMaster())
+            for (unsigned process=0; process<PetscTools::GetNumProcs(); process++)
             {
-                for (unsigned i=0; i<num_nodes; i++)
+                this->GetBlockOnMaster(data, process, blocks);
+                if (PetscTools::AmMaster())
                 {
-                    *p_file << repl_data[i] << "\n";
+                    for (unsigned i=0; i<blocks[0].size(); i++)
+                    {
+                        *p_file << blocks[0][i] << "\n";
+                    }
                 }
             }
-            p_file->close();
+
+            if (PetscTools::AmMaster())
+            {
+                p_file->close();
+            }
         }
     }
 
     // Tidy up
-    PetscTools::Destroy(data);
+    PetscTools::Destroy(data[0]);
 }
 
 // Explicit instantiation
@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+
+"""Copyright (c) 2005-2023, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+"""
+Read, or convert to CSV, a binary cell column file (results.cellcols) written by a cell
+population on which SetUseBinaryCellWriterOutput(true) has been called.
+
+Each output time is converted to a file <output_prefix>_<index>.csv with one row per cell,
+holding the cell ID followed by one column per data column (the first of which are the cell
+locations). These files can be loaded into ParaView as a file series, and viewed with the
+"Table To Points" filter.
+
+The function ReadCellColumns may be imported for use from other Python scripts.
+"""
+import struct
+import sys
+
+
+def ReadCellColumns(file_name):
+    """Read a binary cell column file.
+
+    Returns a pair (column_names, time_steps), where time_steps is a list of tuples
+    (time, cell_ids, columns) and columns holds a list of values for each column name.
+    """
+    in_file = open(file_name, 'rb')
+    headers = in_file.readline().decode('utf-8').split()
+    if len(headers) != 4 or headers[0] != 'CHASTE_CELL_COLUMNS' or headers[1] != '1':
+        raise ValueError('%s is not a binary cell column file' % file_name)
+    byte_order = '<' if headers[2] == 'LittleEndian' else '>'
+    num_columns = int(headers[3])
+    column_names = [in_file.readline().decode('utf-8').rstrip('\n') for i in range(num_columns)]
+    data = in_file.read()
+    in_file.close()
+
+    time_steps = []
+    offset = 0
+    while offset < len(data):
+        time, num_cells = struct.unpack_from(byte_order + 'dI', data, offset)
+        offset += 12
+        cell_ids = list(struct.unpack_from(byte_order + '%dI' % num_cells, data, offset))
+        offset += 4*num_cells
+        values = struct.unpack_from(byte_order + '%dd' % (num_cells*num_columns), data, offset)
+        offset += 8*num_cells*num_columns
+        columns = [list(values[i*num_cells:(i+1)*num_cells]) for i in range(num_columns)]
+
+        # Chunks written by different processes at the same time are merged
+        if time_steps and time_steps[-1][0] == time:
+            time_steps[-1][1].extend(cell_ids)
+            for i in range(num_columns):
+                time_steps[-1][2][i].extend(columns[i])
+        else:
+            time_steps.append((time, cell_ids, columns))
+    return column_names, time_steps
+
+
+if __name__ == "__main__":
+    # Checking command line arguments
+    if len(sys.argv) != 3:
+        print("Usage: %s <input_cellcols_file> <output_prefix>" % sys.argv[0], file=sys.stderr)
+        sys.exit(1)
+    input_name = sys.argv[1]
+    output_prefix = sys.argv[2]
+
+    column_names, time_steps = ReadCellColumns(input_name)
+    for index, (time, cell_ids, columns) in enumerate(time_steps):
+        out_file = open('%s_%d.csv' % (output_prefix, index), 'w')
+        out_file.write(','.join(['"cell_id"'] + ['"%s"' % name for name in column_names]) + '\n')
+        for cell in range(len(cell_ids)):
+            out_file.write(','.join([str(cell_ids[cell])] + [repr(column[cell]) for column in columns]) + '\n')
+        out_file.close()
+    print("Converted %d time steps, from t=%g to t=%g" % (len(time_steps), time_steps[0][0], time_steps[-1][0]) if time_steps else "No time steps found")